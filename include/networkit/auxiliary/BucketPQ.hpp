@@ -9,7 +9,7 @@
 #define NETWORKIT_AUXILIARY_BUCKET_PQ_HPP_
 
 #include <limits>
-#include <list>
+#include <vector>
 
 #include <networkit/Globals.hpp>
 #include <networkit/auxiliary/PrioQueue.hpp>
@@ -18,7 +18,6 @@ namespace Aux {
 
 using index = NetworKit::index;
 using count = NetworKit::count;
-using Bucket = std::list<index>;
 constexpr int64_t none = std::numeric_limits<int64_t>::max();
 
 /**
@@ -27,33 +26,24 @@ constexpr int64_t none = std::numeric_limits<int64_t>::max();
  * minPrio and maxPrio can be positive or negative, respectively with
  * the obvious constraint minPrio <= maxPrio.
  * Amortized constant running time for each operation.
+ *
+ * The buckets are doubly-linked lists threaded through arrays indexed by
+ * value, hence no operation allocates memory after construction.
  */
 class BucketPQ : public PrioQueue<int64_t, index> {
 private:
-    std::vector<Bucket> buckets; // the actual buckets
-    static Bucket dummyBucket;
-    static const Bucket::iterator invalidPtr;
-
-    struct OptionalIterator {
-        bool valid;
-        Bucket::iterator iter;
-
-        void reset() {
-            valid = false;
-            iter = invalidPtr;
-        }
-        OptionalIterator() { reset(); }
-        OptionalIterator(bool valid, Bucket::iterator iter) : valid(valid), iter(iter) {}
-    };
-
-    std::vector<OptionalIterator> nodePtr; // keeps track of node positions
-    std::vector<index> myBucket;           // keeps track of current bucket for each value
-    int64_t currentMinKey;                 // current min key
-    int64_t currentMaxKey;                 // current max key
-    int64_t minAdmissibleKey;              // minimum admissible key
-    int64_t maxAdmissibleKey;              // maximum admissible key
-    count numElems;                        // number of elements stored
-    int64_t offset;                        // offset from minAdmissibleKeys to 0
+    static constexpr index nil = std::numeric_limits<index>::max();
+
+    std::vector<index> bucketHead;   // first value of each bucket, nil if empty
+    std::vector<index> nextInBucket; // successor of each value in its bucket
+    std::vector<index> prevInBucket; // predecessor of each value in its bucket
+    std::vector<index> myBucket;     // keeps track of current bucket for each value
+    int64_t currentMinKey;           // current min key
+    int64_t currentMaxKey;           // current max key
+    int64_t minAdmissibleKey;        // minimum admissible key
+    int64_t maxAdmissibleKey;        // maximum admissible key
+    count numElems;                  // number of elements stored
+    int64_t offset;                  // offset from minAdmissibleKeys to 0
 
     /**
      * Constructor. Not to be used, only here for overriding.
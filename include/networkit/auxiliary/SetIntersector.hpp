@@ -8,10 +8,17 @@
 #ifndef NETWORKIT_AUXILIARY_SET_INTERSECTOR_HPP_
 #define NETWORKIT_AUXILIARY_SET_INTERSECTOR_HPP_
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <set>
+#include <type_traits>
 #include <vector>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif // __AVX2__
+
 namespace Aux {
 
 /**
@@ -38,6 +45,116 @@ private:
     uint64_t n;
 };
 
+/**
+ * Intersects two sorted arrays @a a and @a b without duplicates and calls handle(i, j) for all
+ * positions i, j with a[i] == b[j], in unspecified order. No bit vector is needed.
+ * If one array is much shorter than the other one, the elements of the shorter one are searched
+ * in the longer one by galloping (exponential search), in O(|A| log(|B| / |A|)) time. Otherwise,
+ * the arrays are merged in O(|A| + |B|) time; with AVX2, 64-bit entries of long arrays are
+ * compared in blocks of 4x4.
+ */
+template <class T, typename L>
+void forSortedIntersection(const T *a, size_t na, const T *b, size_t nb, L handle);
+
+/**
+ * Returns the size of the intersection of two sorted arrays without duplicates, see
+ * forSortedIntersection().
+ */
+template <class T>
+size_t sortedIntersectionSize(const T *a, size_t na, const T *b, size_t nb) {
+    size_t result = 0;
+    forSortedIntersection(a, na, b, nb, [&](size_t, size_t) { ++result; });
+    return result;
+}
+
+namespace SetIntersectorDetails {
+
+// The shorter array gallops through the longer one if the longer one is this many times larger.
+constexpr size_t gallopingRatio = 32;
+// Short arrays are merged without SIMD, the setup does not pay off for them.
+constexpr size_t minSimdLength = 32;
+
+template <class T, typename L>
+void gallop(const T *a, size_t na, const T *b, size_t nb, L handle) {
+    size_t lo = 0;
+    for (size_t i = 0; i < na && lo < nb; ++i) {
+        const T x = a[i];
+        size_t step = 1, hi = lo;
+        while (hi < nb && b[hi] < x) {
+            lo = hi + 1;
+            hi += step;
+            step *= 2;
+        }
+        const T *pos = std::lower_bound(b + lo, b + std::min(hi + 1, nb), x);
+        lo = static_cast<size_t>(pos - b);
+        if (lo < nb && b[lo] == x)
+            handle(i, lo++);
+    }
+}
+
+template <class T, typename L>
+void merge(const T *a, size_t na, const T *b, size_t nb, size_t i, size_t j, L handle) {
+    while (i < na && j < nb) {
+        const T x = a[i], y = b[j];
+        if (x == y)
+            handle(i, j);
+        i += x <= y;
+        j += y <= x;
+    }
+}
+
+#ifdef __AVX2__
+// Reports the matches of the 4-blocks va = a[i..i+3] and vb = b[j..j+3]; lane l of rotation k
+// compares a[i + l] to b[j + (l + k) % 4].
+template <int K, typename L>
+inline void matchBlocks(__m256i va, __m256i vb, size_t i, size_t j, L &handle) {
+    const __m256i rotated =
+        K == 0 ? vb : _mm256_permute4x64_epi64(vb, (K | ((K + 1) % 4) << 2 | ((K + 2) % 4) << 4
+                                                   | ((K + 3) % 4) << 6));
+    auto mask = static_cast<unsigned>(
+        _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(va, rotated))));
+    for (; mask; mask &= mask - 1) {
+        const auto l = static_cast<size_t>(__builtin_ctz(mask));
+        handle(i + l, j + ((l + K) & 3));
+    }
+}
+#endif // __AVX2__
+
+} // namespace SetIntersectorDetails
+
+template <class T, typename L>
+void forSortedIntersection(const T *a, size_t na, const T *b, size_t nb, L handle) {
+    using namespace SetIntersectorDetails;
+    if (na == 0 || nb == 0)
+        return;
+    if (na * gallopingRatio < nb) {
+        gallop(a, na, b, nb, handle);
+        return;
+    }
+    if (nb * gallopingRatio < na) {
+        gallop(b, nb, a, na, [&](size_t j, size_t i) { handle(i, j); });
+        return;
+    }
+
+    size_t i = 0, j = 0;
+#ifdef __AVX2__
+    if constexpr (std::is_integral_v<T> && sizeof(T) == 8) {
+        while (na >= minSimdLength && nb >= minSimdLength && i + 4 <= na && j + 4 <= nb) {
+            const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+            const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + j));
+            matchBlocks<0>(va, vb, i, j, handle);
+            matchBlocks<1>(va, vb, i, j, handle);
+            matchBlocks<2>(va, vb, i, j, handle);
+            matchBlocks<3>(va, vb, i, j, handle);
+            const T lastA = a[i + 3], lastB = b[j + 3];
+            i += lastA <= lastB ? 4 : 0;
+            j += lastB <= lastA ? 4 : 0;
+        }
+    }
+#endif // __AVX2__
+    merge(a, na, b, nb, i, j, handle);
+}
+
 } // namespace Aux
 
 template <class T>
@@ -14,6 +14,18 @@ namespace NetworKit {
 
 /**
  * @ingroup centrality
+ * Computes betweenness centrality exactly with Brandes' algorithm, running one single-source
+ * shortest path search (BFS or Dijkstra) and dependency accumulation per source node in
+ * parallel.
+ *
+ * The sources are processed in batches. Each thread stores the distances, path counts and
+ * dependencies of its current source compactly for the visited nodes; predecessors are recomputed
+ * from the incoming edges instead of being stored. Path counts are kept as doubles; for sources
+ * from which they overflow, they are recomputed as logarithms. The contributions of the sources
+ * to the node (and edge) scores are appended to sparse per-thread buffers, bucketed by ranges of
+ * ids. At the end of each batch, every thread adds the contributions to its range of ids from all
+ * buffers to the scores, so no atomic operations are needed. The number of sources per batch is
+ * derived from a memory budget.
  */
 class Betweenness final : public Centrality {
 public:
@@ -27,8 +39,15 @@ public:
      * the interval [0,1].
      * @param computeEdgeCentrality Set this parameter to <code>true</code> if edge betweenness
      * should be computed as well.
+     * @param memoryBudget Upper bound in bytes on the memory used by the threads, which determines
+     * the number of sources per batch. Each thread needs about 48 bytes per node (64 for weighted
+     * graphs) for its searches. The contributions of a source need at most 16 bytes per node,
+     * plus 16 bytes per edge if edge betweenness is computed. At least one source per thread is
+     * processed in each batch. 0 means that the contributions of each thread may take up to
+     * 64 MiB per batch.
      */
-    Betweenness(const Graph &G, bool normalized = false, bool computeEdgeCentrality = false);
+    Betweenness(const Graph &G, bool normalized = false, bool computeEdgeCentrality = false,
+                count memoryBudget = 0);
 
     /**
      * Computes betweenness scores on the graph passed in constructor.
@@ -40,6 +59,14 @@ public:
      * nodes (=a star)
      */
     double maximum() override;
+
+    /**
+     * Returns the number of sources that run() processes per batch given the memory budget.
+     */
+    count sourcesPerBatch() const;
+
+private:
+    count memoryBudget;
 };
 
 } /* namespace NetworKit */
@@ -74,7 +74,6 @@ public:
 
 private:
     ClosenessVariant variant;
-    std::vector<std::vector<count>> uDist;
     std::vector<std::vector<double>> dDist;
     std::vector<std::vector<uint8_t>> visited;
     std::vector<uint8_t> ts;
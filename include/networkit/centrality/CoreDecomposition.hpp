@@ -29,9 +29,10 @@ public:
     /**
      * Create CoreDecomposition class for graph @a G. The graph may not contain self-loops.
      *
-     * Contains the parallel algorithm by
+     * Contains a parallel algorithm based on
      * Dasari, N.S.; Desh, R.; Zubair, M., "ParK: An efficient algorithm for k-core decomposition on
-     * multicore processors," in Big Data (Big Data), * 2014 IEEE International Conference.
+     * multicore processors," in Big Data (Big Data), * 2014 IEEE International Conference,
+     * which takes the nodes of each level from buckets instead of scanning all nodes.
      *
      * TODO complexity?
      * @param G The graph.
@@ -43,8 +44,7 @@ public:
      * bucket priority queue algorithm.
      *
      * The algorithm runs in parallel if the usage of a bucket priority queue is not enforced and
-     * if the node ids of the input graph are continuous (i.e., numberOfNodes() =
-     * upperNodeIdBound()).
+     * the graph is undirected.
      */
     CoreDecomposition(const Graph &G, bool normalized = false,
                       bool enforceBucketQueueAlgorithm = false, bool storeNodeOrder = false);
@@ -104,10 +104,15 @@ private:
 
     /**
      * Perform k-core decomposition of graph passed in constructor.
-     * ParK is an algorithm by Naga Shailaja Dasari, Ranjan Desh, and Zubair M.
-     * See http://ieeexplore.ieee.org/stamp/stamp.jsp?tp=&arnumber=7004366 for details.
+     * Peels the nodes level by level like ParK [1], but finds the nodes of the next level in
+     * buckets indexed by the remaining degree instead of scanning all nodes, as in the bucketing
+     * structure of Julienne [2]. Runs in O(n + m) work.
+     *
+     * [1] See http://ieeexplore.ieee.org/stamp/stamp.jsp?tp=&arnumber=7004366 for details.
+     * [2] Laxman Dhulipala, Guy Blelloch, Julian Shun: Julienne: A Framework for Parallel
+     * Graph Algorithms using Work-efficient Bucketing. SPAA 2017.
      */
-    void runWithParK();
+    void runWithParallelBuckets();
 
     /**
      * Perform k-core decomposition of graph passed in constructor.
@@ -115,46 +120,6 @@ private:
      * It is generally slower than ParK but may be more flexible.
      */
     void runWithBucketQueues();
-
-    /**
-     * Determines nodes whose remaining degree equals @a level.
-     * @param[in] level Shell number (= level) currently processed.
-     * @param[in] degrees Remaining degree for each node.
-     * @param[inout] curr Nodes to be processed in current level.
-     */
-    void scan(index level, const std::vector<count> &degrees, std::vector<node> &curr);
-
-    /**
-     * Determines in parallel the nodes whose remaining degree equals @a level.
-     * @param[in] level Shell number (= level) currently processed.
-     * @param[in] degrees Remaining degree for each node.
-     * @param[inout] curr Nodes to be processed in current level.
-     */
-    void scanParallel(index level, const std::vector<count> &degrees, std::vector<node> &curr,
-                      std::vector<char> &active);
-
-    /**
-     * Processes nodes (and their neighbors) identified by previous scan.
-     * @param[in] level Shell number (= level) currently processed.
-     * @param[inout] degrees Remaining degree for each node.
-     * @param[in] curr Nodes to be processed in this call.
-     * @param[inout] next Nodes to be processed next in current level (certain neighbors of nodes in
-     * curr).
-     */
-    void processSublevel(index level, std::vector<count> &degrees, const std::vector<node> &curr,
-                         std::vector<node> &next);
-
-    /**
-     * Processes in parallel nodes (and their neighbors) identified by previous scan.
-     * @param[in] level Shell number (= level) currently processed.
-     * @param[inout] degrees Remaining degree for each node.
-     * @param[in] curr Nodes to be processed in this call.
-     * @param[inout] next Nodes to be processed next in current level (certain neighbors of nodes in
-     * curr).
-     */
-    void processSublevelParallel(index level, std::vector<count> &degrees,
-                                 const std::vector<node> &curr, std::vector<node> &next,
-                                 std::vector<char> &active);
 };
 
 } /* namespace NetworKit */
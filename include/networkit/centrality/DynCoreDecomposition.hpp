@@ -0,0 +1,122 @@
+/*
+ * DynCoreDecomposition.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CENTRALITY_DYN_CORE_DECOMPOSITION_HPP_
+#define NETWORKIT_CENTRALITY_DYN_CORE_DECOMPOSITION_HPP_
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include <networkit/base/DynAlgorithm.hpp>
+#include <networkit/centrality/Centrality.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Maintains the core numbers of an undirected graph without self-loops under edge insertions
+ * and removals, without recomputing them from scratch. The scores are the same as the ones of
+ * CoreDecomposition (without normalization).
+ *
+ * Removals: the old core numbers are upper bounds of the new ones. Starting from them, the core
+ * number of each affected node is replaced by the h-index of the core numbers of its
+ * neighbors until nothing changes [1]; only the neighbors of nodes whose core number dropped
+ * are re-evaluated.
+ *
+ * Insertions are handled one edge at a time by a traversal [2]: only nodes with core number
+ * k = min(core(u), core(v)) that are connected to the new edge {u, v} via such nodes, and that
+ * have more than k neighbors with core number at least k, can be promoted (to k + 1). These
+ * candidates are collected by a search from the endpoints, and candidates that would not have
+ * more than k neighbors in the (k + 1)-core are evicted repeatedly. The remaining candidates
+ * are promoted.
+ *
+ * [1] Alberto Montresor, Francesco De Pellegrini, Daniele Miorandi: Distributed k-Core
+ * Decomposition. IEEE TPDS 24(2), 2013.
+ * [2] Ahmet Erdem Sarıyüce, Buğra Gedik, Gabriela Jacques-Silva, Kun-Lung Wu, Ümit V.
+ * Çatalyürek: Streaming Algorithms for k-core Decomposition. VLDB 2013.
+ */
+class DynCoreDecomposition final : public Centrality, public DynAlgorithm {
+
+public:
+    /**
+     * @param G An undirected graph without self-loops.
+     */
+    DynCoreDecomposition(const Graph &G);
+
+    /**
+     * Computes the core numbers from scratch.
+     */
+    void run() override;
+
+    /**
+     * Updates the core numbers after a batch of events that has already been applied to the
+     * graph. Supported are edge additions and removals (weight changes are ignored) as well as
+     * node additions and removals; the edges of a removed node must be reported as removals
+     * too.
+     *
+     * @param batch The graph events.
+     */
+    void updateBatch(const std::vector<GraphEvent> &batch) override;
+
+    void update(GraphEvent e) override { updateBatch({e}); }
+
+    /**
+     * Get maximum core number.
+     *
+     * @return The maximum core number
+     */
+    index maxCoreNumber() const;
+
+    /**
+     * Get the theoretical maximum of centrality score in the given graph.
+     *
+     * @return The theoretical maximum centrality score.
+     */
+    double maximum() override;
+
+private:
+    std::vector<count> core;
+
+    // Inserted edges of the current batch that have not been processed yet. They are ignored by
+    // all traversals, such that the core numbers are always the ones of the processed graph.
+    std::unordered_set<uint64_t> pending;
+
+    // Scratch space: state of the nodes in the current traversal, and the number of neighbors
+    // that count towards the next core
+    enum class State : uint8_t { UNSEEN, CANDIDATE, REJECTED, EVICTED };
+    std::vector<State> state;
+    std::vector<count> support;
+    std::vector<node> seen, stack;
+    std::vector<uint8_t> inQueue;
+    std::vector<count> histogram;
+
+    uint64_t edgeKey(node u, node v) const {
+        if (u > v)
+            std::swap(u, v);
+        return static_cast<uint64_t>(u) * G.upperNodeIdBound() + v;
+    }
+
+    template <typename F>
+    void forProcessedNeighborsOf(node u, F handle) const {
+        if (pending.empty()) {
+            G.forNeighborsOf(u, handle);
+        } else {
+            G.forNeighborsOf(u, [&](node v) {
+                if (!pending.count(edgeKey(u, v)))
+                    handle(v);
+            });
+        }
+    }
+
+    void decreaseCores(std::vector<node> &queue);
+    void insertEdge(node u, node v);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CENTRALITY_DYN_CORE_DECOMPOSITION_HPP_
@@ -0,0 +1,109 @@
+/*
+ * DynPageRank.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CENTRALITY_DYN_PAGE_RANK_HPP_
+#define NETWORKIT_CENTRALITY_DYN_PAGE_RANK_HPP_
+
+#include <cmath>
+#include <queue>
+#include <vector>
+
+#include <networkit/base/DynAlgorithm.hpp>
+#include <networkit/centrality/Centrality.hpp>
+#include <networkit/centrality/PageRank.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Maintains PageRank (as computed by PageRank without sink handling) under edge insertions,
+ * removals and weight changes.
+ *
+ * The algorithm keeps an estimate x of the solution of (I - damp * P) x = (1 - damp) / n and
+ * its residual r = (1 - damp) / n - (I - damp * P) x, which is the difference between x and the
+ * next power iteration. Like PageRank, it guarantees ||r|| <= tol after run() and after every
+ * update; in the L1 norm, this bounds the error by ||x - x*||_1 <= tol / (1 - damp).
+ *
+ * After an update, the residual only changes at the out-neighbors of the nodes whose out-edges
+ * changed. Starting from the previous estimate, residuals are then pushed along the out-edges,
+ * largest first (Gauss-Southwell, in rounds of halving thresholds), until the bound holds again.
+ *
+ * As in PageRank, the scores of directed graphs are rescaled to sum up to 1.
+ */
+class DynPageRank final : public Centrality, public DynAlgorithm {
+
+public:
+    /**
+     * @param[in] G The graph.
+     * @param[in] damp Damping factor of the PageRank algorithm.
+     * @param[in] tol Error tolerance, i.e., bound on the norm of the residual.
+     */
+    DynPageRank(const Graph &G, double damp = 0.85, double tol = 1e-8);
+
+    /**
+     * Computes PageRank from scratch.
+     */
+    void run() override;
+
+    /**
+     * Updates the scores after a batch of edge insertions, removals or weight changes that has
+     * already been applied to the graph. The set of nodes must not change.
+     *
+     * @param batch The edge events.
+     */
+    void updateBatch(const std::vector<GraphEvent> &batch) override;
+
+    void update(GraphEvent e) override { updateBatch({e}); }
+
+    /**
+     * Returns the maximum PageRank score.
+     */
+    double maximum() override;
+
+    /**
+     * Returns the number of pushes performed by the last update.
+     */
+    count numberOfPushes() const {
+        assureFinished();
+        return pushes;
+    }
+
+    // Norm used as stopping criterion
+    PageRank::Norm norm = PageRank::Norm::L2_NORM;
+
+private:
+    double damp, tol;
+    count n = 0;
+
+    std::vector<double> estimate, residual, invDeg;
+    double estimateSum = 0.0;
+
+    // Sum of |r(u)| or r(u)^2, depending on the norm
+    double residualSum = 0.0;
+    // During an update: the sum over the changed nodes, and its value before the update
+    double changedSum = 0.0, changedOldSum = 0.0;
+
+    // Nodes whose residual changed during the current update, and the push queue with the
+    // nodes whose residual is at least the current threshold
+    std::vector<node> changed;
+    std::vector<bool> isChanged, inQueue;
+    std::queue<node> queue;
+    double threshold = 0.0;
+    count pushes = 0;
+
+    double summand(double r) const {
+        return norm == PageRank::Norm::L2_NORM ? r * r : std::abs(r);
+    }
+
+    void setResidual(node u, double value);
+    double exactResidual(node u) const;
+    void updateScores();
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CENTRALITY_DYN_PAGE_RANK_HPP_
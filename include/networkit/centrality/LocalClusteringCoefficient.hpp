@@ -8,6 +8,8 @@
 #ifndef NETWORKIT_CENTRALITY_LOCAL_CLUSTERING_COEFFICIENT_HPP_
 #define NETWORKIT_CENTRALITY_LOCAL_CLUSTERING_COEFFICIENT_HPP_
 
+#include <tlx/define/deprecated.hpp>
+
 #include <networkit/centrality/Centrality.hpp>
 
 namespace NetworKit {
@@ -22,22 +24,23 @@ public:
      * clustering coefficient scores should be normalized, then set @a normalized to
      * <code>true</code>. The graph may not contain self-loops.
      *
-     * There are two algorithms available. The trivial (parallel) algorithm needs only a small
-     * amount of additional memory. The turbo mode adds a (sequential, but fast) pre-processing step
-     * using ideas from [0]. This reduces the running time significantly for most graphs. However,
-     * the turbo mode needs O(m) additional memory. In practice this should be a bit less than half
-     * of the memory that is needed for the graph itself. The turbo mode is particularly effective
-     * for graphs with nodes of very high degree and a very skewed degree distribution.
+     * The triangles are counted by TriangleCounting, which orients the edges by degree using
+     * ideas from [0] and needs O(m) additional memory. In practice this should be a bit less
+     * than half of the memory that is needed for the graph itself.
      *
      * [0] Triangle Listing Algorithms: Back from the Diversion
      * Mark Ortmann and Ulrik Brandes * 2014 Proceedings of the Sixteenth Workshop on Algorithm
      * Engineering and Experiments (ALENEX). 2014, 1-8
      *
      * @param G The graph.
-     * @param turbo If the turbo mode shall be activated.
-     * TODO running time
      */
-    LocalClusteringCoefficient(const Graph &G, bool turbo = false);
+    LocalClusteringCoefficient(const Graph &G);
+
+    /**
+     * Deprecated, use LocalClusteringCoefficient(G) instead: @a turbo is ignored, the edges are
+     * always oriented by degree.
+     */
+    TLX_DEPRECATED(LocalClusteringCoefficient(const Graph &G, bool turbo));
 
     /**
      * Computes the local clustering coefficient on the graph passed in constructor.
@@ -50,9 +53,6 @@ public:
      * @return The maximum centrality score.
      */
     double maximum() override;
-
-protected:
-    bool turbo;
 };
 
 } /* namespace NetworKit */
@@ -34,6 +34,11 @@ namespace NetworKit {
  * NOTE: There is an inconsistency in the definition in Newman's book (Ch. 7) regarding
  * directed graphs; we follow the verbal description, which requires to sum over the incoming
  * edges (as opposed to outgoing ones).
+ *
+ * The iteration pulls over the incoming edges; the contribution score(v) / deg(v) of each node
+ * is computed once per iteration. The ranks can be stored in single precision (which halves
+ * the memory traffic of the edge sweep), and the update can follow a block Gauss-Seidel scheme,
+ * see UpdateScheme.
  */
 class PageRank final : public Centrality {
 
@@ -47,6 +52,15 @@ public:
 
     enum SinkHandling { NO_SINK_HANDLING, DISTRIBUTE_SINKS };
 
+    /**
+     * SYNCHRONOUS computes all new ranks from the ranks of the previous iteration (Jacobi).
+     * GAUSS_SEIDEL splits the nodes into one block of consecutive ids per thread; within its
+     * block, each thread immediately uses the new ranks of the nodes it already updated. This
+     * usually needs fewer iterations. The result does not depend on the scheduling, but on the
+     * number of threads.
+     */
+    enum UpdateScheme { SYNCHRONOUS, GAUSS_SEIDEL };
+
     /**
      * Constructs the PageRank class for the Graph @a G
      *
@@ -87,6 +101,13 @@ public:
     // Norm used as stopping criterion
     Norm norm = Norm::L2_NORM;
 
+    // Update scheme of the iteration
+    UpdateScheme updateScheme = UpdateScheme::SYNCHRONOUS;
+
+    // Store the ranks in single precision during the iteration. The tolerance is then raised to
+    // the rounding error of float if necessary.
+    bool singlePrecision = false;
+
 private:
     double damp;
     double tol;
@@ -94,6 +115,9 @@ private:
     bool normalized;
     SinkHandling distributeSinks;
     std::atomic<double> max;
+
+    template <typename T>
+    void runWithPrecision();
 };
 
 } /* namespace NetworKit */
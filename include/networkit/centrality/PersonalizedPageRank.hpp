@@ -0,0 +1,85 @@
+/*
+ * PersonalizedPageRank.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CENTRALITY_PERSONALIZED_PAGE_RANK_HPP_
+#define NETWORKIT_CENTRALITY_PERSONALIZED_PAGE_RANK_HPP_
+
+#include <limits>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/centrality/PageRank.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Computes personalized PageRank for a batch of seed sets at once. For each seed set, the
+ * random surfer teleports to a uniformly chosen seed instead of a uniformly chosen node; the
+ * rank of sinks (nodes without outgoing edges) is also returned to the seeds, so that the ranks
+ * of each seed set sum up to 1.
+ *
+ * The ranks of all seed sets are stored next to each other for each node, so that a single
+ * sweep over the incoming edges updates all of them; the per-edge work is a short loop over
+ * contiguous values instead of one random access per seed set and edge.
+ */
+class PersonalizedPageRank final : public Algorithm {
+
+public:
+    /**
+     * @param[in] G Graph to be processed.
+     * @param[in] seedSets The seed sets, each one must be non-empty.
+     * @param[in] damp Damping factor of the PageRank algorithm.
+     * @param[in] tol Error tolerance for the PageRank iteration, it must be reached by all seed
+     * sets.
+     */
+    PersonalizedPageRank(const Graph &G, std::vector<std::vector<node>> seedSets,
+                         double damp = 0.85, double tol = 1e-8);
+
+    void run() override;
+
+    /**
+     * Returns the personalized PageRank scores of all nodes for the i-th seed set.
+     */
+    std::vector<double> scores(index i) const;
+
+    /**
+     * Returns the personalized PageRank score of node @a u for the i-th seed set.
+     */
+    double score(node u, index i) const {
+        assureFinished();
+        return ranks[u * numSets + i];
+    }
+
+    /**
+     * Return the number of iterations performed by the algorithm.
+     */
+    count numberOfIterations() const {
+        assureFinished();
+        return iterations;
+    }
+
+    // Maximum number of iterations allowed
+    count maxIterations = std::numeric_limits<count>::max();
+
+    // Norm used as stopping criterion
+    PageRank::Norm norm = PageRank::Norm::L2_NORM;
+
+private:
+    const Graph *G;
+    std::vector<std::vector<node>> seedSets;
+    double damp, tol;
+    count numSets;
+    count iterations = 0;
+
+    // ranks[u * numSets + i] is the rank of u for the i-th seed set.
+    std::vector<double> ranks;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CENTRALITY_PERSONALIZED_PAGE_RANK_HPP_
@@ -24,6 +24,10 @@ namespace NetworKit {
  * The running time in practice depends on the structure of the graph. In
  * particular for complex networks it is usually quite fast, even graphs with
  * millions of edges can usually be processed in less than a minute.
+ *
+ * The subproblems of the nodes (a node and its neighbors that come later in the degeneracy order)
+ * are solved in parallel. Subproblems with many candidates are split into tasks, and small
+ * candidate sets are handled on adjacency bitmasks.
  */
 class MaximalCliques final : public Algorithm {
 
@@ -47,6 +51,9 @@ public:
      * The callback is called once for each found clique with a reference to the clique.
      * Note that the reference is to an internal object, the callback should not assume that
      * this reference is still valid after it returned.
+     * The cliques are found in parallel, so the callback may be called from different threads,
+     * but never concurrently. If the callback throws an exception, the algorithm stops and run()
+     * rethrows the exception.
      *
      * @param G The graph to list cliques for
      * @param callback The callback to call for each clique.
@@ -1,7 +1,7 @@
 #ifndef NETWORKIT_COMMUNITY_ADJUSTED_RAND_MEASURE_HPP_
 #define NETWORKIT_COMMUNITY_ADJUSTED_RAND_MEASURE_HPP_
 
-#include <networkit/community/DissimilarityMeasure.hpp>
+#include <networkit/community/ContingencyDissimilarityMeasure.hpp>
 
 namespace NetworKit {
 
@@ -9,21 +9,20 @@ namespace NetworKit {
  * The adjusted rand dissimilarity measure as proposed by Huber and Arabie in "Comparing partitions"
  * (http://link.springer.com/article/10.1007/BF01908075)
  */
-class AdjustedRandMeasure final : public DissimilarityMeasure {
+class AdjustedRandMeasure final : public ContingencyDissimilarityMeasure {
 public:
+    using ContingencyDissimilarityMeasure::getDissimilarity;
+
     /**
-     * Get the adjust rand dissimilarity. Runs in O(n log(n)).
+     * Get the adjust rand dissimilarity. Runs in O(n log(n)) for two partitions of a graph.
      *
      * Note that the dissimilarity can be larger than 1 if the partitions are more different than
      * expected in the random model.
      *
-     * @param G    The graph on which the partitions shall be compared
-     * @param zeta The first partiton
-     * @param eta  The second partition
+     * @param table The contingency table of the two partitions.
      * @return The adjusted rand dissimilarity.
      */
-    double getDissimilarity(const Graph &G, const NetworKit::Partition &zeta,
-                            const NetworKit::Partition &eta) override;
+    double getDissimilarity(const ContingencyTable &table) override;
 };
 
 } // namespace NetworKit
@@ -0,0 +1,105 @@
+/*
+ * CommunityWeights.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_COMMUNITY_COMMUNITY_WEIGHTS_HPP_
+#define NETWORKIT_COMMUNITY_COMMUNITY_WEIGHTS_HPP_
+
+#include <utility>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Sums up edge weights per community (or label), e.g., the weights of the edges from a node to
+ * its neighbor communities. The weights are kept in an open-addressing hash table whose size
+ * depends on the number of communities added since the last clear() rather than on the total
+ * number of communities, so every thread can afford its own accumulator.
+ */
+class CommunityWeights final {
+public:
+    CommunityWeights() : keys(16, none), weights(16) {}
+
+    /**
+     * Removes all entries, in time linear in their number.
+     */
+    void clear() {
+        for (const index slot : used)
+            keys[slot] = none;
+        used.clear();
+    }
+
+    /**
+     * Adds @a weight to the weight of @a community.
+     */
+    void add(index community, double weight) {
+        index slot = find(community);
+        if (keys[slot] == none) {
+            if (2 * (used.size() + 1) > keys.size()) {
+                grow();
+                slot = find(community);
+            }
+            keys[slot] = community;
+            weights[slot] = 0;
+            used.push_back(slot);
+        }
+        weights[slot] += weight;
+    }
+
+    /**
+     * Returns the weight of @a community, 0 if it has not been added.
+     */
+    double operator[](index community) const {
+        const index slot = find(community);
+        return keys[slot] == none ? 0 : weights[slot];
+    }
+
+    /**
+     * Calls handle(community, weight) for all communities added since the last clear(), in
+     * the order in which they were added first.
+     */
+    template <typename F>
+    void forEntries(F handle) const {
+        for (const index slot : used)
+            handle(keys[slot], weights[slot]);
+    }
+
+    bool empty() const noexcept { return used.empty(); }
+
+private:
+    index find(index community) const {
+        const index mask = keys.size() - 1;
+        index slot = (community * 0x9E3779B97F4A7C15ULL >> 32) & mask;
+        while (keys[slot] != none && keys[slot] != community)
+            slot = (slot + 1) & mask;
+        return slot;
+    }
+
+    void grow() {
+        std::vector<index> oldKeys(2 * keys.size(), none);
+        std::vector<double> oldWeights(oldKeys.size());
+        std::vector<index> oldUsed;
+        std::swap(keys, oldKeys);
+        std::swap(weights, oldWeights);
+        std::swap(used, oldUsed);
+        for (const index oldSlot : oldUsed) {
+            const index slot = find(oldKeys[oldSlot]);
+            keys[slot] = oldKeys[oldSlot];
+            weights[slot] = oldWeights[oldSlot];
+            used.push_back(slot);
+        }
+    }
+
+    std::vector<index> keys;
+    std::vector<double> weights;
+    std::vector<index> used;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_COMMUNITY_WEIGHTS_HPP_
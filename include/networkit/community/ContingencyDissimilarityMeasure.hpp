@@ -0,0 +1,51 @@
+/*
+ * ContingencyDissimilarityMeasure.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_COMMUNITY_CONTINGENCY_DISSIMILARITY_MEASURE_HPP_
+#define NETWORKIT_COMMUNITY_CONTINGENCY_DISSIMILARITY_MEASURE_HPP_
+
+#include <vector>
+
+#include <networkit/community/ContingencyTable.hpp>
+#include <networkit/community/DissimilarityMeasure.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Base class for the dissimilarity measures of partitions that only depend on their
+ * ContingencyTable.
+ */
+class ContingencyDissimilarityMeasure : public DissimilarityMeasure {
+
+public:
+    using DissimilarityMeasure::getDissimilarity;
+
+    /**
+     * Builds the contingency table of @a first and @a second and computes the dissimilarity
+     * from it.
+     */
+    double getDissimilarity(const Graph &G, const Partition &first,
+                            const Partition &second) override;
+
+    /**
+     * @return The dissimilarity of the two partitions of @a table.
+     */
+    virtual double getDissimilarity(const ContingencyTable &table) = 0;
+
+    /**
+     * Compares @a reference with each of the @a candidates. The nodes are grouped by their
+     * cluster in @a reference only once, see ContingencyTable::forCandidates().
+     *
+     * @return The dissimilarities, in the order of @a candidates.
+     */
+    std::vector<double> getDissimilarities(const Graph &G, const Partition &reference,
+                                           const std::vector<Partition> &candidates);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_CONTINGENCY_DISSIMILARITY_MEASURE_HPP_
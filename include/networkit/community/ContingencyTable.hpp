@@ -0,0 +1,158 @@
+/*
+ * ContingencyTable.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_COMMUNITY_CONTINGENCY_TABLE_HPP_
+#define NETWORKIT_COMMUNITY_CONTINGENCY_TABLE_HPP_
+
+#include <functional>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Sparse contingency table of two partitions: the number of nodes in the intersection of each
+ * cluster of the first partition with each cluster of the second one, stored only for the
+ * non-empty intersections, and the cluster sizes. Only the nodes of the graph that are assigned
+ * to a cluster in both partitions are taken into account.
+ *
+ * The table is built in parallel: the nodes are bucketed by their cluster in the first
+ * partition, then the clusters of the second partition in each bucket are sorted and counted.
+ * The buckets only depend on the first partition, so comparing one reference partition with
+ * many candidates via forCandidates() buckets the nodes once.
+ */
+class ContingencyTable final {
+
+public:
+    /**
+     * Builds the contingency table of @a first and @a second.
+     *
+     * @param G The graph whose nodes are partitioned.
+     * @param first The first partition; its clusters are the rows of the table.
+     * @param second The second partition; its clusters are the columns of the table.
+     */
+    ContingencyTable(const Graph &G, const Partition &first, const Partition &second);
+
+    /**
+     * Builds the contingency tables of @a reference and each of the @a candidates, one after
+     * another, and calls handle(i, table) for the table of the i-th candidate. Only one table
+     * is kept in memory at a time.
+     *
+     * @param G The graph whose nodes are partitioned.
+     * @param reference The first partition of all tables.
+     * @param candidates The second partitions.
+     * @param handle Called with the index of the candidate and the table.
+     */
+    static void forCandidates(const Graph &G, const Partition &reference,
+                              const std::vector<Partition> &candidates,
+                              const std::function<void(index, const ContingencyTable &)> &handle);
+
+    /**
+     * @return The number of nodes that are assigned in both partitions.
+     */
+    count numberOfElements() const noexcept { return n; }
+
+    /**
+     * @return The number of non-empty intersections.
+     */
+    count numberOfEntries() const noexcept { return sizes.size(); }
+
+    /**
+     * @return The sizes of the clusters of the first partition, counting only the nodes that are
+     * assigned in both partitions.
+     */
+    const std::vector<count> &getFirstSizes() const noexcept { return firstSizes; }
+
+    /**
+     * @return The sizes of the clusters of the second partition, counting only the nodes that
+     * are assigned in both partitions.
+     */
+    const std::vector<count> &getSecondSizes() const noexcept { return secondSizes; }
+
+    /**
+     * Calls handle(C, D, size) for each pair of clusters C of the first and D of the second
+     * partition whose intersection is not empty, ordered by C and then by D.
+     */
+    template <typename L>
+    void forEntries(L handle) const;
+
+    /**
+     * Iterates in parallel over the non-empty intersections like forEntries() and sums up the
+     * values returned by handle(C, D, size).
+     */
+    template <typename L>
+    double parallelSumForEntries(L handle) const;
+
+    /**
+     * @return The number of node pairs that are in the same cluster of the first partition.
+     */
+    count pairsInFirst() const;
+
+    /**
+     * @return The number of node pairs that are in the same cluster of the second partition.
+     */
+    count pairsInSecond() const;
+
+    /**
+     * @return The number of node pairs that are in the same cluster of both partitions.
+     */
+    count pairsInBoth() const;
+
+    /**
+     * @return The mutual information of the two partitions, in bits.
+     */
+    double mutualInformation() const;
+
+    /**
+     * @return The entropy of the first partition, in bits.
+     */
+    double entropyOfFirst() const;
+
+    /**
+     * @return The entropy of the second partition, in bits.
+     */
+    double entropyOfSecond() const;
+
+private:
+    struct Buckets;
+
+    ContingencyTable(const Buckets &buckets, const Partition &second);
+
+    count n = 0;
+    std::vector<count> firstSizes;
+    std::vector<count> secondSizes;
+    // Row C consists of entries rowBegin[C] to rowBegin[C + 1] - 1.
+    std::vector<index> rowBegin;
+    std::vector<index> columns;
+    std::vector<count> sizes;
+};
+
+template <typename L>
+void ContingencyTable::forEntries(L handle) const {
+    for (index C = 0; C + 1 < rowBegin.size(); ++C)
+        for (index i = rowBegin[C]; i < rowBegin[C + 1]; ++i)
+            handle(C, columns[i], sizes[i]);
+}
+
+template <typename L>
+double ContingencyTable::parallelSumForEntries(L handle) const {
+    double sum = 0.0;
+    const count rows = rowBegin.empty() ? 0 : rowBegin.size() - 1;
+
+#pragma omp parallel for schedule(guided) reduction(+ : sum)
+    for (omp_index C = 0; C < static_cast<omp_index>(rows); ++C)
+        for (index i = rowBegin[C]; i < rowBegin[C + 1]; ++i)
+            sum += handle(static_cast<index>(C), columns[i], sizes[i]);
+
+    return sum;
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_CONTINGENCY_TABLE_HPP_
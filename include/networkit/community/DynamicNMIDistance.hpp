@@ -8,7 +8,7 @@
 #ifndef NETWORKIT_COMMUNITY_DYNAMIC_NMI_DISTANCE_HPP_
 #define NETWORKIT_COMMUNITY_DYNAMIC_NMI_DISTANCE_HPP_
 
-#include <networkit/community/DissimilarityMeasure.hpp>
+#include <networkit/community/ContingencyDissimilarityMeasure.hpp>
 #include <networkit/community/NMIDistance.hpp>
 
 namespace NetworKit {
@@ -17,18 +17,17 @@ using Matrix = std::vector<std::vector<count>>;
 
 /**
  * @ingroup community
+ * Computes NMI between two clusterings that belong to two different graphs:
+ * getDissimilarity(newGraph, oldClustering, newClustering), where newGraph has evolved from
+ * oldGraph, which is only given implicitly via oldClustering. NMI is only applied to nodes that
+ * belong to the intersection of oldGraph and newGraph. Nodes of oldGraph not existing in newGraph
+ * are marked by the entry none in newClustering.
  */
-class DynamicNMIDistance final : public DissimilarityMeasure {
+class DynamicNMIDistance final : public ContingencyDissimilarityMeasure {
 public:
-    /**
-     * Computes NMI between two clusterings that belong to two different graphs.
-     * @a newGraph has evolved from oldGraph, which is only given implicitly via
-     * @a oldClustering. NMI is only applied to nodes that belong to the intersection
-     * of oldGraph and @a newGraph. Nodes of oldGraph not existing in @newGraph are
-     * marked by the entry none in @a newClustering.
-     */
-    double getDissimilarity(const Graph &newGraph, const Partition &oldClustering,
-                            const Partition &newClustering) override;
+    using ContingencyDissimilarityMeasure::getDissimilarity;
+
+    double getDissimilarity(const ContingencyTable &table) override;
 
     void combineValues(double H_sum, double MI, double &NMI, double &NMID) const;
     void sanityCheck(double &NMI, double &NMID) const;
@@ -0,0 +1,52 @@
+/*
+ * GraphPartitioner.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_COMMUNITY_GRAPH_PARTITIONER_HPP_
+#define NETWORKIT_COMMUNITY_GRAPH_PARTITIONER_HPP_
+
+#include <networkit/community/CommunityDetectionAlgorithm.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Parallel multilevel graph partitioner: divides the nodes into k blocks of (almost) equal size
+ * such that few edges run between the blocks. Each block contains at most
+ * (1 + imbalance) * ceil(n / k) nodes.
+ *
+ * The graph is coarsened by size-constrained label propagation, and each clustering is contracted
+ * with ParallelPartitionCoarsening. The coarsest graph is partitioned by greedy graph growing
+ * (several attempts, the best one is kept). During uncoarsening, the partition is projected to
+ * the finer graphs and refined by size-constrained label propagation, which moves nodes in
+ * parallel to the adjacent block they are most strongly connected to. Blocks that exceed the
+ * size bound are rebalanced by moving the nodes with the smallest loss in cut weight.
+ *
+ * The algorithm is randomized, see Aux::Random.
+ */
+class GraphPartitioner final : public CommunityDetectionAlgorithm {
+
+public:
+    /**
+     * @param G An undirected graph. Edge weights are taken into account for the cut.
+     * @param k The number of blocks.
+     * @param imbalance The allowed imbalance: each block contains at most
+     * (1 + imbalance) * ceil(n / k) nodes.
+     */
+    GraphPartitioner(const Graph &G, count k, double imbalance = 0.03);
+
+    /**
+     * Computes the partition, it has exactly k subsets (some of which may be empty if k > n).
+     */
+    void run() override;
+
+private:
+    count k;
+    double imbalance;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_GRAPH_PARTITIONER_HPP_
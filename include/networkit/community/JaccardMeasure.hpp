@@ -8,17 +8,19 @@
 #ifndef NETWORKIT_COMMUNITY_JACCARD_MEASURE_HPP_
 #define NETWORKIT_COMMUNITY_JACCARD_MEASURE_HPP_
 
-#include <networkit/community/DissimilarityMeasure.hpp>
+#include <networkit/community/ContingencyDissimilarityMeasure.hpp>
 
 namespace NetworKit {
 
 /**
  * @ingroup community
  */
-class JaccardMeasure final : public DissimilarityMeasure {
+class JaccardMeasure final : public ContingencyDissimilarityMeasure {
 
 public:
-    double getDissimilarity(const Graph &G, const Partition &zeta, const Partition &eta) override;
+    using ContingencyDissimilarityMeasure::getDissimilarity;
+
+    double getDissimilarity(const ContingencyTable &table) override;
 };
 
 } /* namespace NetworKit */
@@ -8,7 +8,7 @@
 #ifndef NETWORKIT_COMMUNITY_NMI_DISTANCE_HPP_
 #define NETWORKIT_COMMUNITY_NMI_DISTANCE_HPP_
 
-#include <networkit/community/DissimilarityMeasure.hpp>
+#include <networkit/community/ContingencyDissimilarityMeasure.hpp>
 
 namespace NetworKit {
 
@@ -18,10 +18,12 @@ namespace NetworKit {
  * Normalized Mutual Information.
  *
  */
-class NMIDistance final : public DissimilarityMeasure {
+class NMIDistance final : public ContingencyDissimilarityMeasure {
 
 public:
-    double getDissimilarity(const Graph &G, const Partition &zeta, const Partition &eta) override;
+    using ContingencyDissimilarityMeasure::getDissimilarity;
+
+    double getDissimilarity(const ContingencyTable &table) override;
 };
 
 } /* namespace NetworKit */
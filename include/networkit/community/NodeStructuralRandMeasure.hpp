@@ -8,7 +8,7 @@
 #ifndef NETWORKIT_COMMUNITY_NODE_STRUCTURAL_RAND_MEASURE_HPP_
 #define NETWORKIT_COMMUNITY_NODE_STRUCTURAL_RAND_MEASURE_HPP_
 
-#include <networkit/community/DissimilarityMeasure.hpp>
+#include <networkit/community/ContingencyDissimilarityMeasure.hpp>
 
 namespace NetworKit {
 
@@ -17,10 +17,12 @@ namespace NetworKit {
  * The node-structural Rand measure assigns a similarity value in [0,1]
  * to two partitions of a graph, by considering all pairs of nodes.
  */
-class NodeStructuralRandMeasure final : public DissimilarityMeasure {
+class NodeStructuralRandMeasure final : public ContingencyDissimilarityMeasure {
 
 public:
-    double getDissimilarity(const Graph &G, const Partition &zeta, const Partition &eta) override;
+    using ContingencyDissimilarityMeasure::getDissimilarity;
+
+    double getDissimilarity(const ContingencyTable &table) override;
 };
 
 } /* namespace NetworKit */
@@ -22,12 +22,21 @@ namespace NetworKit {
  * that the maximum number of its neighbors have. The procedure is stopped when every vertex
  * has the label that at least half of its neighbors have.
  *
+ * Only active nodes are processed: initially all non-isolated nodes, later the neighbors of
+ * nodes whose label changed. They are kept in a compact frontier, deduplicated by an atomic
+ * bitmap, and each iteration processes the frontier in chunks of roughly equal total degree.
+ *
+ * By default, labels are updated in place as soon as they are computed, and ties are broken
+ * in favor of the smallest label, so the result depends on the thread scheduling. See
+ * setDeterministic() for reproducible results.
  */
 class PLP final : public CommunityDetectionAlgorithm {
 
 private:
     count updateThreshold = 0;
-    count maxIterations;
+    count maxIterations = none;
+    bool deterministic = false;
+    uint64_t seed = 0;
     count nIterations = 0;     //!< number of iterations in last run
     std::vector<count> timing; //!< running times for each iteration
 
@@ -64,6 +73,17 @@ public:
      */
     void setUpdateThreshold(count th);
 
+    /**
+     * Makes the result depend only on the graph and @a seed, but not on the number of threads
+     * or their scheduling. Each iteration is split into two halves, based on a seeded hash of the
+     * nodes and the iteration; the nodes of a half compute their new labels from the labels
+     * after the previous half. Ties are broken by a seeded hash of the labels.
+     *
+     * @param deterministic Whether the result is to be reproducible.
+     * @param seed The seed of the hashes.
+     */
+    void setDeterministic(bool deterministic, uint64_t seed = 0);
+
     /**
      * Get number of iterations in last run.
      *
@@ -1,28 +1,24 @@
 #ifndef NETWORKIT_COMMUNITY_PARALLEL_LEIDEN_HPP_
 #define NETWORKIT_COMMUNITY_PARALLEL_LEIDEN_HPP_
 
-#include <atomic>
-#include <condition_variable>
-#include <iomanip>
-#include <iostream>
-#include <mutex>
 #include <omp.h>
-#include <thread>
-#include <tlx/unused.hpp>
 #include <networkit/Globals.hpp>
-#include <networkit/auxiliary/Parallel.hpp>
-#include <networkit/auxiliary/Parallelism.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/auxiliary/Timer.hpp>
-#include <networkit/coarsening/ParallelPartitionCoarsening.hpp>
 #include <networkit/community/CommunityDetectionAlgorithm.hpp>
-#include <networkit/community/Modularity.hpp>
-#include <networkit/community/PLM.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/structures/Partition.hpp>
 
 namespace NetworKit {
 
+/**
+ * @ingroup community
+ * Parallel Leiden algorithm for modularity-based community detection. The local moving and the
+ * refinement phase do not use locks: community volumes are updated atomically, and the edge
+ * weights from a node to its neighbor communities are summed up in thread-local tables. The
+ * aggregated graphs are contracted in parallel into CSRGraph instances.
+ */
 class ParallelLeiden final : public CommunityDetectionAlgorithm {
 public:
     /**
@@ -35,9 +31,25 @@ public:
     explicit ParallelLeiden(const Graph &graph, int iterations = 3, bool randomize = true,
                             double gamma = 1);
 
-    void run() override;
+    /**
+     * Warm start: begins with @a baseClustering instead of singletons, e.g., with the result for
+     * a previous version of the graph. In the first local moving phase, only the nodes in
+     * @a activeNodes are active initially (their neighbors become active once they move), and
+     * only the communities that contain such nodes or change in this phase are refined; the
+     * other communities are aggregated as they are. Later phases and iterations consider all
+     * nodes. See DynLeiden.
+     *
+     * @param graph A networkit graph
+     * @param baseClustering Partition of the nodes of @a graph to start with
+     * @param activeNodes Nodes that are active in the first local moving phase
+     * @param iterations Number of Leiden Iterations to be run
+     * @param randomize Randomize node order?
+     * @param gamma Resolution parameter
+     */
+    ParallelLeiden(const Graph &graph, Partition baseClustering, std::vector<node> activeNodes,
+                   int iterations = 1, bool randomize = true, double gamma = 1);
 
-    int VECTOR_OVERSIZE = 10000;
+    void run() override;
 
 private:
     inline double modularityDelta(double cutD, double degreeV, double volD) const {
@@ -48,31 +60,46 @@ private:
         return cutC - gamma * (volC - degreeV) * degreeV * inverseGraphVolume;
     }
 
-    static inline void lockLowerFirst(index a, index b, std::vector<std::mutex> &locks) {
-        if (a < b) {
-            locks[a].lock();
-            locks[b].lock();
-        } else {
-            locks[b].lock();
-            locks[a].lock();
-        }
-    }
-
     void flattenPartition();
 
     void calculateVolumes(const Graph &graph);
 
-    void parallelMove(const Graph &graph);
+    /**
+     * Moves the nodes, starting with @a active. If @a trackTouched is set, communities that
+     * gain or lose nodes are marked in touchedCommunities.
+     */
+    template <class GraphType>
+    void parallelMove(const GraphType &graph, std::vector<node> active, bool trackTouched = false);
+
+    /**
+     * Refines the communities; if @a onlyTouched is set, the communities that are not marked in
+     * touchedCommunities are kept as a whole.
+     */
+    template <class GraphType>
+    Partition parallelRefine(const GraphType &graph, bool onlyTouched = false);
 
-    Partition parallelRefine(const Graph &graph);
+    /**
+     * Contracts every community of @a refined into a single node and moves result to the
+     * contracted graph. Afterwards, fineToCoarse maps the nodes of G to the new graph.
+     */
+    template <class GraphType>
+    CSRGraph coarsen(const GraphType &graph, const Partition &refined);
 
     double inverseGraphVolume; // 1/vol(V)
 
     std::vector<double> communityVolumes;
 
-    std::vector<std::vector<node>> mappings;
+    // Maps each node of G to its node in the current (coarsest) graph
+    std::vector<node> fineToCoarse;
+
+    // Warm start: nodes that are active at the beginning of the first local moving phase
+    std::vector<node> initialActive;
+
+    bool warmStart = false;
+
+    std::vector<uint8_t> touchedCommunities;
 
-    static constexpr int WORKING_SIZE = 1000;
+    static constexpr int WORKING_SIZE = 128;
 
     double gamma; // Resolution parameter
 
@@ -0,0 +1,99 @@
+/*
+ * PartitionEvaluator.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_COMMUNITY_PARTITION_EVALUATOR_HPP_
+#define NETWORKIT_COMMUNITY_PARTITION_EVALUATOR_HPP_
+
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Quality measures of a partition, as computed by PartitionEvaluator. The per-cluster vectors
+ * are indexed by cluster id, up to the upper bound of the partition; empty clusters have size
+ * and values 0.
+ */
+struct PartitionQuality {
+    //! Modularity, see Modularity.
+    double modularity = 0;
+    //! Fraction of the edge weight within clusters, see Coverage.
+    double coverage = 0;
+    //! Total weight of the edges between clusters, see EdgeCut.
+    double edgeCut = 0;
+    //! Maximum conductance of a cluster; for 2-partitions this is the same as Conductance.
+    double conductance = 0;
+    //! Global intra-cluster density, see IntrapartitionDensity::getGlobal().
+    double intrapartitionDensity = 0;
+    //! Unweighted average hub dominance of the clusters, see HubDominance.
+    double hubDominance = 0;
+    //! Unweighted average fragmentation of the clusters, see PartitionFragmentation.
+    double fragmentation = 0;
+    //! Number of non-empty clusters.
+    count numberOfClusters = 0;
+
+    std::vector<count> clusterSizes;
+    //! Weight of the edges within each cluster.
+    std::vector<edgeweight> intraClusterWeights;
+    //! Weight of the edges leaving each cluster.
+    std::vector<edgeweight> cutWeights;
+    //! Sum of the weighted degrees of the nodes of each cluster, self-loops count twice.
+    std::vector<edgeweight> volumes;
+    //! Per-cluster values, see IsolatedInterpartitionConductance.
+    std::vector<double> conductances;
+    //! Per-cluster values, see IntrapartitionDensity.
+    std::vector<double> intrapartitionDensities;
+    //! Per-cluster values, see PartitionHubDominance.
+    std::vector<double> hubDominances;
+    //! Per-cluster values, see PartitionFragmentation.
+    std::vector<double> fragmentations;
+};
+
+/**
+ * @ingroup community
+ * Computes the quality measures Modularity, Coverage, EdgeCut, Conductance,
+ * IntrapartitionDensity, HubDominance and PartitionFragmentation of a partition, globally and
+ * per cluster, in a single parallel sweep over the edges. If there are few clusters, each thread
+ * sums up the values of the clusters in its own accumulators. Otherwise, the values of the nodes
+ * are bucketed by ranges of clusters and each thread sums up one range, so the additional memory
+ * is in O(n + k) for k clusters. The connected components that PartitionFragmentation needs are
+ * found by a concurrent union-find during the same sweep.
+ *
+ * The results are the same as the ones of the individual measures, up to floating-point
+ * rounding.
+ */
+class PartitionEvaluator final : public Algorithm {
+
+public:
+    /**
+     * @param G An undirected graph with at least one edge.
+     * @param zeta The partition to evaluate.
+     */
+    PartitionEvaluator(const Graph &G, const Partition &zeta);
+
+    void run() override;
+
+    /**
+     * @return The quality measures of the partition.
+     */
+    const PartitionQuality &getResult() const {
+        assureFinished();
+        return result;
+    }
+
+private:
+    const Graph *G;
+    const Partition *zeta;
+    PartitionQuality result;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMMUNITY_PARTITION_EVALUATOR_HPP_
@@ -0,0 +1,49 @@
+/*
+ * AfforestConnectedComponents.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_COMPONENTS_AFFOREST_CONNECTED_COMPONENTS_HPP_
+#define NETWORKIT_COMPONENTS_AFFOREST_CONNECTED_COMPONENTS_HPP_
+
+#include <networkit/components/ComponentDecomposition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup components
+ * Determines the connected components of an undirected graph with the Afforest algorithm [1],
+ * a parallel union-find with lock-free linking. First, the first few neighbors of every node
+ * are linked, which already merges most of the nodes into a giant tree. The most frequent root
+ * is then estimated by sampling, and only the remaining edges of nodes outside of this tree are
+ * processed. In contrast to label propagation, the number of passes over the edges does not
+ * depend on the diameter of the graph.
+ *
+ * The components are numbered in increasing order of their smallest node, i.e., in the same
+ * way as by ConnectedComponents.
+ *
+ * [1] Michael Sutton, Tal Ben-Nun, Amnon Barak: Optimizing Parallel Graph Connectivity
+ * Computation via Subgraph Sampling. IPDPS 2018.
+ */
+class AfforestConnectedComponents final : public ComponentDecomposition {
+public:
+    /**
+     * @param[in] G An undirected graph.
+     * @param[in] neighborRounds Number of neighbors of each node that are linked before the
+     * largest tree is sampled.
+     */
+    AfforestConnectedComponents(const Graph &G, count neighborRounds = 2);
+
+    /**
+     * Computes the connected components of the input graph.
+     */
+    void run() override;
+
+private:
+    count neighborRounds;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMPONENTS_AFFOREST_CONNECTED_COMPONENTS_HPP_
@@ -65,6 +65,13 @@ public:
 protected:
     const Graph *G;
     Partition component;
+
+    /**
+     * Returns the subgraph of @a G induced by the largest component of @a components. Among
+     * components of the same size, the one that contains the smallest node id is chosen, so
+     * that the result does not depend on the numbering of the components.
+     */
+    static Graph extractLargestComponent(const Graph &G, Partition components, bool compactGraph);
 };
 
 } // namespace NetworKit
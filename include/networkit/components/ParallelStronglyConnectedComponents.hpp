@@ -0,0 +1,60 @@
+/*
+ * ParallelStronglyConnectedComponents.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_COMPONENTS_PARALLEL_STRONGLY_CONNECTED_COMPONENTS_HPP_
+#define NETWORKIT_COMPONENTS_PARALLEL_STRONGLY_CONNECTED_COMPONENTS_HPP_
+
+#include <networkit/components/ComponentDecomposition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup components
+ * Determines the strongly connected components of a directed graph in parallel, following the
+ * Multistep approach [1]:
+ *  - nodes without incoming or outgoing edges (within the remaining graph) are trimmed
+ *    repeatedly, each of them is a component on its own;
+ *  - a forward-backward search from a high-degree pivot finds the (usually giant) component
+ *    that contains the pivot;
+ *  - the remaining nodes are handled by rounds of coloring: the largest node id is propagated
+ *    along the edges, and a backward search from each node that keeps its own color, restricted
+ *    to this color, yields its component;
+ *  - once few nodes are left, they are finished with Tarjan's algorithm.
+ *
+ * The resulting partition is the same as the one of StronglyConnectedComponents, but the
+ * components are numbered in increasing order of their smallest node.
+ *
+ * [1] George M. Slota, Sivasankaran Rajamanickam, Kamesh Madduri: BFS and Coloring-Based
+ * Parallel Algorithms for Strongly Connected Components and Related Problems. IPDPS 2014.
+ */
+class ParallelStronglyConnectedComponents final : public ComponentDecomposition {
+
+public:
+    /**
+     * @param G Graph A directed graph.
+     */
+    ParallelStronglyConnectedComponents(const Graph &G);
+
+    /**
+     * Runs the algorithm.
+     */
+    void run() override;
+
+    /**
+     * Constructs a new graph that contains only the nodes inside the largest
+     * strongly connected component. The result is the same as the one of
+     * StronglyConnectedComponents::extractLargestStronglyConnectedComponent().
+     * @param G            The input graph.
+     * @param compactGraph If true, the node ids of the output graph will be compacted
+     * (i.e. re-numbered from 0 to n-1). If false, the node ids will not be changed.
+     */
+    static Graph extractLargestStronglyConnectedComponent(const Graph &G,
+                                                          bool compactGraph = false);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_COMPONENTS_PARALLEL_STRONGLY_CONNECTED_COMPONENTS_HPP_
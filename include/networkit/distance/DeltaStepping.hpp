@@ -0,0 +1,70 @@
+/*
+ * DeltaStepping.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_DELTA_STEPPING_HPP_
+#define NETWORKIT_DISTANCE_DELTA_STEPPING_HPP_
+
+#include <networkit/distance/SSSP.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Parallel delta-stepping single-source shortest path algorithm [1] for graphs with non-negative
+ * edge weights. Tentative distances are kept in buckets of width delta; all nodes of the
+ * current bucket are relaxed in parallel until the bucket stays empty, then the search moves on
+ * to the next non-empty bucket.
+ *
+ * The distances are the same as the ones computed by Dijkstra. If paths are stored, the
+ * predecessors and the number of shortest paths are computed after the distances are final, so
+ * the order of the predecessors of a node may differ from Dijkstra. If a target is given, the
+ * search stops as soon as the bucket of the target has been settled.
+ *
+ * [1] U. Meyer, P. Sanders: Delta-stepping: a parallelizable shortest path algorithm.
+ * Journal of Algorithms 49(1), 2003.
+ */
+class DeltaStepping final : public SSSP {
+
+public:
+    /**
+     * Constructs the DeltaStepping class for @a G and source node @a source.
+     *
+     * @param G The graph, edge weights must not be negative.
+     * @param source The source node.
+     * @param storePaths Paths are reconstructable and the number of paths is
+     * stored.
+     * @param storeNodesSortedByDistance Store a vector of nodes ordered in
+     * increasing distance from the source.
+     * @param target The target node.
+     * @param delta The bucket width. If it is zero (default), the width is chosen as
+     * the maximum edge weight divided by the average degree, but at least as the smallest
+     * positive edge weight.
+     */
+    DeltaStepping(const Graph &G, node source, bool storePaths = true,
+                  bool storeNodesSortedByDistance = false, node target = none,
+                  edgeweight delta = 0);
+
+    /**
+     * Performs the delta-stepping SSSP algorithm on the graph given in the constructor.
+     */
+    void run() override;
+
+    /**
+     * Returns the bucket width that has been used in the last run.
+     */
+    edgeweight getDelta() const {
+        assureFinished();
+        return usedDelta;
+    }
+
+private:
+    edgeweight delta;
+    edgeweight usedDelta = 0;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_DELTA_STEPPING_HPP_
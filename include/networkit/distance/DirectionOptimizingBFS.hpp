@@ -0,0 +1,66 @@
+/*
+ * DirectionOptimizingBFS.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_DIRECTION_OPTIMIZING_BFS_HPP_
+#define NETWORKIT_DISTANCE_DIRECTION_OPTIMIZING_BFS_HPP_
+
+#include <networkit/distance/SSSP.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Parallel level-synchronous breadth-first search that switches between top-down and bottom-up
+ * steps as described in [1]. A top-down step expands the nodes of the current frontier, while a
+ * bottom-up step lets every unvisited node look for a parent in the current frontier (stored as
+ * a bitmap). Bottom-up steps are chosen while the frontier is large, i.e., on the few middle
+ * levels of low-diameter graphs that contain most of the edges.
+ *
+ * The results (distances, number of shortest paths, predecessors, nodes sorted by distance) are
+ * the same as the ones of BFS. Within a level, the order of getNodesSortedByDistance() and of
+ * the predecessors of a node may differ. If a target is given, the search stops after the
+ * level of the target has been completed.
+ *
+ * [1] Scott Beamer, Krste Asanovic, David Patterson: Direction-Optimizing Breadth-First Search.
+ * SC 2012.
+ */
+class DirectionOptimizingBFS final : public SSSP {
+
+public:
+    /**
+     * Constructs the DirectionOptimizingBFS class for @a G and source node @a source.
+     *
+     * @param G The graph
+     * @param source The source node of the breadth-first search
+     * @param storePaths Paths are reconstructable and the number of paths is
+     * stored.
+     * @param storeNodesSortedByDistance Store a vector of nodes ordered in
+     * increasing distance from the source.
+     * @param target The target node.
+     */
+    DirectionOptimizingBFS(const Graph &G, node source, bool storePaths = true,
+                           bool storeNodesSortedByDistance = false, node target = none);
+
+    /**
+     * Breadth-first search from @a source.
+     */
+    void run() override;
+
+    /**
+     * Returns the number of levels that have been explored bottom-up in the last run.
+     */
+    count getNumberOfBottomUpSteps() const {
+        assureFinished();
+        return bottomUpSteps;
+    }
+
+private:
+    count bottomUpSteps = 0;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_DIRECTION_OPTIMIZING_BFS_HPP_
@@ -0,0 +1,270 @@
+/*
+ * MultiSourceBFS.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_MULTI_SOURCE_BFS_HPP_
+#define NETWORKIT_DISTANCE_MULTI_SOURCE_BFS_HPP_
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <omp.h>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Bit-parallel multi-source BFS (MS-BFS) as described in [1]. Up to @a Width independent
+ * breadth-first searches are run at once: every node stores one bit per search for the
+ * searches that have seen it, and for the ones that have it in their current frontier. Since
+ * the searches share their edge traversals, running them together is much cheaper than
+ * running one BFS per source. On levels with large frontiers, the next frontier is pulled from
+ * the (incoming) neighbors and the scan of a node stops as soon as all searches have seen it.
+ *
+ * The engine is sequential and needs 3 * Width bits per node; all-sources workloads should
+ * use one instance per thread, see forNodeBatches().
+ *
+ * [1] Manuel Then, Moritz Kaufmann, Fernando Chirigati, Tuan-Anh Hoang-Vu, Kien Pham, Alfons
+ * Kemper, Thomas Neumann, Huy T. Vo: The More the Merrier: Efficient Multi-Source Graph
+ * Traversal. VLDB 2014.
+ *
+ * @tparam Width Maximum number of concurrent searches, must be a multiple of 64.
+ */
+template <count Width = 64>
+class MultiSourceBFS final {
+    static_assert(Width > 0 && Width % 64 == 0, "Width must be a positive multiple of 64");
+
+    static constexpr count words = Width / 64;
+
+public:
+    static constexpr count width = Width;
+
+    /**
+     * One bit per search; bit i belongs to the i-th source passed to run().
+     */
+    using Bitset = std::array<uint64_t, words>;
+
+    /**
+     * @param G The graph; edge weights are ignored.
+     */
+    explicit MultiSourceBFS(const Graph &G)
+        : G(&G), seen(G.upperNodeIdBound()), frontier(G.upperNodeIdBound()),
+          next(G.upperNodeIdBound()) {}
+
+    /**
+     * Runs one BFS from each node in [first, last). For every level d and every node v that is
+     * reached for the first time by at least one of the searches, calls handle(v, reached, d)
+     * where bit i of @a reached is set iff the i-th source has v at distance d. The sources
+     * themselves are reported with distance 0. Within a level, the order of the nodes is
+     * unspecified.
+     *
+     * @param first, last Range of at most Width source nodes.
+     * @param handle Takes (node, const Bitset &, count).
+     */
+    template <class InputIt, typename L>
+    void run(InputIt first, InputIt last, L handle);
+
+    /**
+     * Calls f(i) for every set bit i of @a bits, in increasing order.
+     */
+    template <typename F>
+    static void forBits(const Bitset &bits, F f) {
+        for (index w = 0; w < words; ++w) {
+            for (uint64_t word = bits[w]; word; word &= word - 1)
+                f(w * 64 + static_cast<index>(__builtin_ctzll(word)));
+        }
+    }
+
+    /**
+     * Returns the number of set bits of @a bits.
+     */
+    static count popcount(const Bitset &bits) {
+        count result = 0;
+        for (const uint64_t word : bits)
+            result += static_cast<count>(__builtin_popcountll(word));
+        return result;
+    }
+
+    /**
+     * Splits the nodes of @a G into batches of at most Width nodes (in increasing order) and
+     * calls handle(bfs, sources) for each batch, where @a bfs is an instance owned by the
+     * calling thread. The batches are processed in parallel.
+     *
+     * @param G The graph.
+     * @param handle Takes (MultiSourceBFS &, const std::vector<node> &).
+     */
+    template <typename L>
+    static void forNodeBatches(const Graph &G, L handle);
+
+private:
+    const Graph *G;
+    std::vector<Bitset> seen, frontier, next;
+    std::vector<node> frontierNodes, nextNodes, touched;
+
+    // Direction switching threshold, see DirectionOptimizingBFS.
+    static constexpr count alpha = 15;
+
+    static bool isEmpty(const Bitset &bits) {
+        uint64_t any = 0;
+        for (const uint64_t word : bits)
+            any |= word;
+        return any == 0;
+    }
+
+    static void orInto(Bitset &target, const Bitset &bits) {
+        for (index w = 0; w < words; ++w)
+            target[w] |= bits[w];
+    }
+
+    static bool andNotInto(Bitset &target, const Bitset &mask) {
+        uint64_t any = 0;
+        for (index w = 0; w < words; ++w) {
+            target[w] &= ~mask[w];
+            any |= target[w];
+        }
+        return any != 0;
+    }
+
+    static bool covers(const Bitset &bits, const Bitset &all) {
+        uint64_t missing = 0;
+        for (index w = 0; w < words; ++w)
+            missing |= all[w] & ~bits[w];
+        return missing == 0;
+    }
+
+    void topDownStep();
+    void bottomUpStep(const Bitset &all);
+};
+
+template <count Width>
+template <class InputIt, typename L>
+void MultiSourceBFS<Width>::run(InputIt first, InputIt last, L handle) {
+    const Bitset empty{};
+    std::fill(seen.begin(), seen.end(), empty);
+
+    Bitset all{};
+    frontierNodes.clear();
+    count numSources = 0;
+    for (; first != last; ++first, ++numSources) {
+        if (numSources == Width)
+            throw std::runtime_error("Error: too many sources for MultiSourceBFS");
+        const node s = *first;
+        const uint64_t bit = uint64_t{1} << (numSources % 64);
+        all[numSources / 64] |= bit;
+        if (isEmpty(frontier[s]))
+            frontierNodes.push_back(s);
+        frontier[s][numSources / 64] |= bit;
+        seen[s][numSources / 64] |= bit;
+    }
+
+    for (const node s : frontierNodes)
+        handle(s, frontier[s], count{0});
+
+    const count arcs = G->numberOfEdges() * (G->isDirected() ? 1 : 2);
+    for (count dist = 1; !frontierNodes.empty(); ++dist) {
+        count frontierEdges = 0;
+        for (const node u : frontierNodes)
+            frontierEdges += G->degreeOut(u);
+
+        if (frontierEdges * alpha > arcs)
+            bottomUpStep(all);
+        else
+            topDownStep();
+
+        for (const node v : nextNodes)
+            handle(v, next[v], dist);
+
+        // The old frontier becomes the (empty) next frontier.
+        for (const node u : frontierNodes)
+            frontier[u] = empty;
+        std::swap(frontier, next);
+        std::swap(frontierNodes, nextNodes);
+    }
+}
+
+template <count Width>
+void MultiSourceBFS<Width>::topDownStep() {
+    touched.clear();
+    for (const node u : frontierNodes) {
+        const Bitset &bits = frontier[u];
+        G->forNeighborsOf(u, [&](node v) {
+            if (isEmpty(next[v]))
+                touched.push_back(v);
+            orInto(next[v], bits);
+        });
+    }
+
+    nextNodes.clear();
+    for (const node v : touched) {
+        if (andNotInto(next[v], seen[v])) {
+            orInto(seen[v], next[v]);
+            nextNodes.push_back(v);
+        }
+    }
+}
+
+template <count Width>
+void MultiSourceBFS<Width>::bottomUpStep(const Bitset &all) {
+    nextNodes.clear();
+    const bool directed = G->isDirected();
+    G->forNodes([&](node v) {
+        Bitset &seenV = seen[v];
+        if (covers(seenV, all))
+            return;
+
+        Bitset acc = seenV;
+        auto pull = [&](node u) {
+            orInto(acc, frontier[u]);
+            return covers(acc, all);
+        };
+        if (directed) {
+            for (const node u : G->inNeighborRange(v))
+                if (pull(u))
+                    break;
+        } else {
+            for (const node u : G->neighborRange(v))
+                if (pull(u))
+                    break;
+        }
+
+        if (andNotInto(acc, seenV)) {
+            next[v] = acc;
+            orInto(seenV, acc);
+            nextNodes.push_back(v);
+        }
+    });
+}
+
+template <count Width>
+template <typename L>
+void MultiSourceBFS<Width>::forNodeBatches(const Graph &G, L handle) {
+    std::vector<node> nodes;
+    nodes.reserve(G.numberOfNodes());
+    G.forNodes([&](node u) { nodes.push_back(u); });
+    const count numBatches = (nodes.size() + Width - 1) / Width;
+
+#pragma omp parallel if (numBatches > 1)
+    {
+        MultiSourceBFS bfs(G);
+        std::vector<node> sources;
+#pragma omp for schedule(dynamic)
+        for (omp_index b = 0; b < static_cast<omp_index>(numBatches); ++b) {
+            const auto begin = nodes.begin() + static_cast<std::ptrdiff_t>(b * Width);
+            const auto end = nodes.begin()
+                             + static_cast<std::ptrdiff_t>(std::min<count>(nodes.size(),
+                                                                           (b + 1) * Width));
+            sources.assign(begin, end);
+            handle(bfs, sources);
+        }
+    }
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_MULTI_SOURCE_BFS_HPP_
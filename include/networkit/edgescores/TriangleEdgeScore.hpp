@@ -13,12 +13,8 @@
 namespace NetworKit {
 
 /**
- * A parallel triangle counting implementation based on ideas in [0].
- *
- * This implementation avoids less work but needs therefore also less checks and
- * is (apart from a fast initialization) parallel without any locks. In experiments
- * this implementation seems to be fast both in non-parallel as well as in parallel
- * settings. With only one thread its performance is similar to the sequential
+ * Counts the triangles of each edge in parallel, based on ideas in [0]; see TriangleCounting.
+ * With only one thread its performance is similar to the sequential
  * ChibaNishizekiTriangleEdgeScore in NetworKit.
  *
  * [0] Triangle Listing Algorithms: Back from the Diversion
@@ -0,0 +1,62 @@
+/*
+ * TrussDecomposition.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_EDGESCORES_TRUSS_DECOMPOSITION_HPP_
+#define NETWORKIT_EDGESCORES_TRUSS_DECOMPOSITION_HPP_
+
+#include <networkit/edgescores/EdgeScore.hpp>
+
+namespace NetworKit {
+
+/**
+ * Computes the trussness of each edge: the k-truss of a graph is its largest subgraph in which
+ * every edge is contained in at least k - 2 triangles, and the trussness of an edge is the
+ * largest k such that the edge belongs to the k-truss. Every edge has trussness at least 2;
+ * self-loops have trussness 0.
+ *
+ * The triangles of each edge are counted with TriangleCounting. Then the edges are peeled in
+ * parallel in increasing order of their triangle counts (supports): all edges with the current
+ * minimum support are removed at once and the supports of the other edges in their triangles
+ * are decreased atomically, see
+ *
+ * Humayun Kabir and Kamesh Madduri: Parallel k-truss decomposition on multicore systems.
+ * HPEC 2017.
+ *
+ * The triangles of a removed edge are found by intersecting the sorted neighborhoods of its
+ * endpoints. The scores are indexed by edge id, so the edges need to be indexed.
+ */
+class TrussDecomposition final : public EdgeScore<count> {
+
+public:
+    /**
+     * @param G An undirected graph with indexed edges.
+     */
+    TrussDecomposition(const Graph &G);
+
+    void run() override;
+
+    /**
+     * Returns the maximum trussness of any edge, 0 if the graph has no edges.
+     */
+    count maxTrussness() const {
+        assureFinished();
+        return maxTruss;
+    }
+
+    /**
+     * Returns the subgraph of all edges with maximum trussness, i.e., the k-truss for the
+     * largest k for which it is not empty. Node ids are kept, nodes that are not incident to any
+     * of these edges are not part of the subgraph.
+     */
+    Graph maxTrussSubgraph() const;
+
+private:
+    count maxTruss = 0;
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_EDGESCORES_TRUSS_DECOMPOSITION_HPP_
@@ -0,0 +1,134 @@
+/*
+ * ParallelPushRelabel.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_FLOW_PARALLEL_PUSH_RELABEL_HPP_
+#define NETWORKIT_FLOW_PARALLEL_PUSH_RELABEL_HPP_
+
+#include <atomic>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup flow
+ * Parallel maximum flow algorithm based on the synchronous push-relabel algorithm by Baumstark,
+ * Blelloch and Shun (ESA 2015). The residual network is stored as a compressed sparse row
+ * structure in which each arc knows its reverse arc, so pushes do not need any edge lookups.
+ *
+ * In each round, all active nodes are discharged in parallel against the labels of the previous
+ * round; conflicting pushes between two active neighbors are resolved by a fixed rule, and the
+ * new labels and excesses are applied at the end of the round. The labels are recomputed
+ * periodically by a parallel breadth-first search from the sink (global relabeling), and nodes
+ * above an empty label (gap) are given up on until the next global relabeling.
+ *
+ * The first phase computes a maximum preflow, the second phase returns the remaining excess to
+ * the source, so the result is a valid flow.
+ */
+class ParallelPushRelabel final : public Algorithm {
+
+public:
+    /**
+     * Constructs an instance of the algorithm for the given graph, source and sink.
+     *
+     * @param graph The graph, its edges need to be indexed. Edge weights are used as capacities.
+     * @param source The source node.
+     * @param sink The sink node.
+     */
+    ParallelPushRelabel(const Graph &graph, node source, node sink);
+
+    /**
+     * Computes the maximum flow.
+     */
+    void run() override;
+
+    /**
+     * Returns the value of the maximum flow from source to sink.
+     *
+     * @return The maximum flow value
+     */
+    edgeweight getMaxFlow() const;
+
+    /**
+     * Returns the set of the nodes on the source side of the flow/minimum cut.
+     *
+     * @return The set of nodes that form the (smallest) source side of the flow/minimum cut.
+     */
+    std::vector<node> getSourceSet() const;
+
+    /**
+     * Get the flow value between two nodes @a u and @a v, see getFlowVector().
+     * @warning The running time of this function is linear in the degree of u.
+     *
+     * @param u The first node
+     * @param v The second node
+     * @return The flow between node u and v.
+     */
+    edgeweight getFlow(node u, node v) const;
+
+    /**
+     * Get the flow value of an edge, see getFlowVector().
+     *
+     * @param eid The id of the edge
+     * @return The flow on the edge identified by eid
+     */
+    edgeweight getFlow(edgeid eid) const {
+        assureFinished();
+        return flow[eid];
+    }
+
+    /**
+     * Returns the flow values of all edges, indexed by edge id. On undirected graphs, the
+     * convention of EdmondsKarp is used: a positive value is a flow from the endpoint with the
+     * larger id to the one with the smaller id, a negative value a flow in the other direction.
+     * On directed graphs, the value is the flow along the edge, between 0 and its weight; unlike
+     * EdmondsKarp, reverse edges are not required.
+     *
+     * @return The flow values of all edges
+     */
+    const std::vector<edgeweight> &getFlowVector() const;
+
+private:
+    void buildResidualNetwork();
+    void runPhase(node target, node excluded);
+    void discharge(node v, node target, std::vector<node> &discovered, count &work);
+    void globalRelabel(node target, node excluded);
+    void collectActiveNodes(node target, node excluded);
+
+    // Level-synchronous parallel breadth-first search from root. neighbors(u, visit) has to call
+    // visit(v) for all nodes v that are reachable from u in one step. Returns the visited nodes
+    // ordered by distance; the nodes at distance i are levelBegin[i] to levelBegin[i + 1] - 1.
+    template <typename N>
+    std::vector<node> parallelBFS(node root, std::vector<std::atomic<bool>> &visited,
+                                  N neighbors, std::vector<index> &levelBegin) const;
+
+    const Graph *graph;
+    node source, sink;
+
+    // Residual network: the arcs of u are offsets[u] to offsets[u + 1] - 1.
+    std::vector<index> offsets;
+    std::vector<node> heads;
+    std::vector<index> reverseArcs;
+    std::vector<edgeweight> residual;
+    // For each edge, its arc in the list of its tail (directed) or larger endpoint (undirected).
+    std::vector<index> edgeArcs;
+
+    // State of the push-relabel phases, released after run().
+    std::vector<index> labels, newLabels, labelCount;
+    std::vector<edgeweight> excess, addedExcess;
+    std::vector<std::atomic<bool>> isDiscovered;
+    std::vector<node> activeNodes;
+    index gap = 0;
+
+    std::vector<edgeweight> flow;
+    edgeweight flowValue = 0;
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_FLOW_PARALLEL_PUSH_RELABEL_HPP_
@@ -31,13 +31,13 @@ auto callBFSHandle(F &f, node u, count) -> decltype(f(u)) {
 /**
  * Iterate over nodes in breadth-first search order starting from the nodes within the given range.
  *
- * @param G The input graph.
+ * @param G The input graph (a Graph or a CSRGraph).
  * @param first The first element of the range.
  * @param last The end of the range.
  * @param handle Takes a node as input parameter.
  */
-template <class InputIt, typename L>
-void BFSfrom(const Graph &G, InputIt first, InputIt last, L handle) {
+template <class InputIt, typename L, class GraphType>
+void BFSfrom(const GraphType &G, InputIt first, InputIt last, L handle) {
     std::vector<bool> marked(G.upperNodeIdBound());
     std::queue<node> q, qNext;
     count dist = 0;
@@ -67,12 +67,12 @@ void BFSfrom(const Graph &G, InputIt first, InputIt last, L handle) {
 /**
  * Iterate over nodes in breadth-first search order starting from the given source node.
  *
- * @param G The input graph.
+ * @param G The input graph (a Graph or a CSRGraph).
  * @param source The source node.
  * @param handle Takes a node as input parameter.
  */
-template <typename L>
-void BFSfrom(const Graph &G, node source, L handle) {
+template <typename L, class GraphType>
+void BFSfrom(const GraphType &G, node source, L handle) {
     std::array<node, 1> startNodes{{source}};
     BFSfrom(G, startNodes.begin(), startNodes.end(), handle);
 }
@@ -80,12 +80,12 @@ void BFSfrom(const Graph &G, node source, L handle) {
 /**
  * Iterate over edges in breadth-first search order starting from the given source node.
  *
- * @param G The input graph.
+ * @param G The input graph (a Graph or a CSRGraph).
  * @param source The source node.
  * @param handle Takes a node as input parameter.
  */
-template <typename L>
-void BFSEdgesFrom(const Graph &G, node source, L handle) {
+template <typename L, class GraphType>
+void BFSEdgesFrom(const GraphType &G, node source, L handle) {
     std::vector<bool> marked(G.upperNodeIdBound());
     std::queue<node> q;
     q.push(source); // enqueue root
@@ -0,0 +1,632 @@
+/*
+ * CSRGraph.hpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKIT_GRAPH_CSR_GRAPH_HPP_
+#define NETWORKIT_GRAPH_CSR_GRAPH_HPP_
+
+#include <cassert>
+#include <memory>
+#include <omp.h>
+#include <type_traits>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * An immutable snapshot of a Graph in compressed sparse row (CSR) format. The adjacency of all
+ * nodes is stored in a single contiguous array (plus contiguous weight and edge id arrays, if
+ * present) and indexed by an offset array of size upperNodeIdBound() + 1. Neighbor scans thus
+ * access memory sequentially, and the per-node overhead is a single offset.
+ *
+ * CSRGraph offers the same iteration API as Graph (forNodes, parallelForNodes, forEdges,
+ * parallelForEdges, forNeighborsOf, forEdgesOf, forInNeighborsOf, forInEdgesOf, ...) with the
+ * same lambda signatures, so that templated code (e.g., the traversals in Traversal::) can be
+ * instantiated with either of them. Node ids, edge ids and the order of the neighbors are the
+ * same as in the graph the snapshot was created from.
+ *
+ * Copies share the (immutable) arrays. The arrays may also refer to a memory-mapped file, see
+ * NetworkitBinaryFixedWidthReader::map.
+ */
+class CSRGraph final {
+
+    friend class GraphBuilder;
+    friend class NetworkitBinaryFixedWidthReader;
+
+    /**
+     * Read-only array that either owns its elements (when built from a vector) or refers to
+     * memory kept alive by a shared owner, e.g., a memory-mapped file. Copies share the
+     * elements, which is safe since a CSRGraph is immutable.
+     */
+    template <typename T>
+    class Array {
+    public:
+        Array() = default;
+
+        Array(std::vector<T> &&elements) {
+            auto owned = std::make_shared<const std::vector<T>>(std::move(elements));
+            ptr = owned->data();
+            len = owned->size();
+            owner = std::move(owned);
+        }
+
+        Array(const T *ptr, size_t len, std::shared_ptr<const void> owner)
+            : owner(std::move(owner)), ptr(ptr), len(len) {}
+
+        const T &operator[](size_t i) const {
+            assert(i < len);
+            return ptr[i];
+        }
+
+        const T *data() const noexcept { return ptr; }
+        const T *begin() const noexcept { return ptr; }
+        const T *end() const noexcept { return ptr + len; }
+        size_t size() const noexcept { return len; }
+        bool empty() const noexcept { return !len; }
+        const T &back() const { return (*this)[len - 1]; }
+
+    private:
+        std::shared_ptr<const void> owner;
+        const T *ptr = nullptr;
+        size_t len = 0;
+    };
+
+    count n;
+    count m;
+    count storedNumberOfSelfLoops;
+    node z;
+    edgeid omega;
+
+    bool weighted;
+    bool directed;
+    bool edgesIndexed;
+
+    //!< non-zero iff the node exists
+    Array<uint8_t> exists;
+
+    //!< neighbors of u are outEdges[outBegin[u]], ..., outEdges[outBegin[u + 1] - 1]
+    Array<index> outBegin;
+    Array<node> outEdges;
+    //!< same schema as outEdges, empty if the graph is unweighted
+    Array<edgeweight> outEdgeWeights;
+    //!< same schema as outEdges, empty if the graph has no edge ids
+    Array<edgeid> outEdgeIds;
+
+    //!< only used for directed graphs, same schema as outBegin/outEdges
+    Array<index> inBegin;
+    Array<node> inEdges;
+    Array<edgeweight> inEdgeWeights;
+    Array<edgeid> inEdgeIds;
+
+    //! Creates a graph without arrays; they are to be set by the caller.
+    CSRGraph(count n, bool weighted, bool directed, bool edgesIndexed);
+
+    template <bool hasWeights>
+    edgeweight getOutEdgeWeight(index i) const {
+        return hasWeights ? outEdgeWeights[i] : defaultEdgeWeight;
+    }
+
+    template <bool hasWeights>
+    edgeweight getInEdgeWeight(index i) const {
+        return hasWeights ? inEdgeWeights[i] : defaultEdgeWeight;
+    }
+
+    template <bool graphHasEdgeIds>
+    edgeid getOutEdgeId(index i) const {
+        return graphHasEdgeIds ? outEdgeIds[i] : none;
+    }
+
+    template <bool graphHasEdgeIds>
+    edgeid getInEdgeId(index i) const {
+        return graphHasEdgeIds ? inEdgeIds[i] : none;
+    }
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    void forOutEdgesOfImpl(node u, L &handle) const {
+        for (index i = outBegin[u]; i < outBegin[u + 1]; ++i) {
+            const node v = outEdges[i];
+            // undirected: each edge {u, v} is only reported once, from its larger endpoint
+            if (graphIsDirected || u >= v) {
+                edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(i),
+                              getOutEdgeId<graphHasEdgeIds>(i));
+            }
+        }
+    }
+
+    template <bool hasWeights, bool graphHasEdgeIds, typename L>
+    void forInEdgesOfImpl(node u, L &handle) const {
+        for (index i = inBegin[u]; i < inBegin[u + 1]; ++i) {
+            edgeLambda<L>(handle, u, inEdges[i], getInEdgeWeight<hasWeights>(i),
+                          getInEdgeId<graphHasEdgeIds>(i));
+        }
+    }
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    void forEdgeImpl(L &handle) const {
+        for (node u = 0; u < z; ++u) {
+            forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+        }
+    }
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    void parallelForEdgesImpl(L &handle) const {
+#pragma omp parallel for schedule(guided) if (z > 10000)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+        }
+    }
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    double parallelSumForEdgesImpl(L &handle) const {
+        double sum = 0.0;
+#pragma omp parallel for reduction(+ : sum) if (z > 10000)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            for (index i = outBegin[u]; i < outBegin[u + 1]; ++i) {
+                const node v = outEdges[i];
+                if (graphIsDirected || static_cast<node>(u) >= v) {
+                    sum += edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(i),
+                                         getOutEdgeId<graphHasEdgeIds>(i));
+                }
+            }
+        }
+        return sum;
+    }
+
+    /*
+     * The following overloads select the lambda signature in exactly the same way as the
+     * corresponding private members of Graph do; see Graph.hpp for details.
+     */
+
+    template <class F, void * = (void *)0>
+    static typename Aux::FunctionTraits<F>::result_type edgeLambda(F &, ...) {
+        static_assert(!std::is_same<F, F>::value,
+                      "Your lambda does not support the required parameters or the "
+                      "parameters have the wrong type.");
+        return std::declval<typename Aux::FunctionTraits<F>::result_type>();
+    }
+
+    template <class F,
+              typename std::enable_if<
+                  (Aux::FunctionTraits<F>::arity >= 3)
+                  && std::is_same<edgeweight,
+                                  typename Aux::FunctionTraits<F>::template arg<2>::type>::value
+                  && std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<3>::type>::
+                      value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id)
+        -> decltype(f(u, v, ew, id)) {
+        return f(u, v, ew, id);
+    }
+
+    template <
+        class F,
+        typename std::enable_if<
+            (Aux::FunctionTraits<F>::arity >= 2)
+            && std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<2>::type>::value
+            && std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::
+                value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node u, node v, edgeweight, edgeid id) -> decltype(f(u, v, id)) {
+        return f(u, v, id);
+    }
+
+    template <class F,
+              typename std::enable_if<
+                  (Aux::FunctionTraits<F>::arity >= 2)
+                  && std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<
+                                                  2>::type>::value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid /*id*/)
+        -> decltype(f(u, v, ew)) {
+        return f(u, v, ew);
+    }
+
+    template <class F, typename std::enable_if<
+                           (Aux::FunctionTraits<F>::arity >= 1)
+                           && std::is_same<node, typename Aux::FunctionTraits<F>::template arg<
+                                                     1>::type>::value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node u, node v, edgeweight /*ew*/, edgeid /*id*/)
+        -> decltype(f(u, v)) {
+        return f(u, v);
+    }
+
+    template <class F,
+              typename std::enable_if<
+                  (Aux::FunctionTraits<F>::arity >= 1)
+                  && std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<
+                                                  1>::type>::value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node, node v, edgeweight ew, edgeid /*id*/)
+        -> decltype(f(v, ew)) {
+        return f(v, ew);
+    }
+
+    template <class F, void * = (void *)0>
+    static auto edgeLambda(F &f, node, node v, edgeweight, edgeid) -> decltype(f(v)) {
+        return f(v);
+    }
+
+public:
+    /**
+     * Creates a CSR snapshot of @a G. The snapshot is independent of @a G, i.e., later
+     * modifications of @a G are not reflected.
+     *
+     * @param G The input graph.
+     * @param parallel If true, the adjacency arrays are filled in parallel.
+     */
+    explicit CSRGraph(const Graph &G, bool parallel = true);
+
+    /**
+     * Creates an undirected weighted graph with the nodes 0, ..., offsets.size() - 2 from
+     * adjacency arrays that were assembled elsewhere, e.g., by a graph contraction. The
+     * neighbors of u are neighbors[offsets[u]], ..., neighbors[offsets[u + 1] - 1], with the
+     * corresponding entries of @a weights. An edge {u, v} with u != v must be stored in the
+     * lists of both endpoints, a self-loop only once.
+     *
+     * @param offsets Offsets of the adjacency lists, offsets.front() must be 0.
+     * @param neighbors Concatenated adjacency lists.
+     * @param weights Edge weights, same schema as @a neighbors.
+     */
+    CSRGraph(std::vector<index> offsets, std::vector<node> neighbors,
+             std::vector<edgeweight> weights);
+
+    CSRGraph(const CSRGraph &other) = default;
+    CSRGraph(CSRGraph &&other) noexcept = default;
+    CSRGraph &operator=(const CSRGraph &other) = default;
+    CSRGraph &operator=(CSRGraph &&other) noexcept = default;
+
+    /**
+     * Converts the snapshot back into a (mutable) Graph with the same node ids, edge ids,
+     * weights and neighbor order.
+     */
+    Graph toGraph() const;
+
+    count numberOfNodes() const noexcept { return n; }
+    count numberOfEdges() const noexcept { return m; }
+    count numberOfSelfLoops() const noexcept { return storedNumberOfSelfLoops; }
+    index upperNodeIdBound() const noexcept { return z; }
+    index upperEdgeIdBound() const noexcept { return omega; }
+
+    bool isWeighted() const noexcept { return weighted; }
+    bool isDirected() const noexcept { return directed; }
+    bool hasEdgeIds() const noexcept { return edgesIndexed; }
+    bool isEmpty() const noexcept { return !n; }
+
+    bool hasNode(node v) const noexcept { return v < z && exists[v]; }
+
+    /**
+     * Returns the number of (outgoing) neighbors of @a v.
+     */
+    count degree(node v) const { return outBegin[v + 1] - outBegin[v]; }
+
+    /**
+     * Returns the number of incoming neighbors of @a v (for undirected graphs, same as degree).
+     */
+    count degreeIn(node v) const {
+        return directed ? inBegin[v + 1] - inBegin[v] : degree(v);
+    }
+
+    count degreeOut(node v) const { return degree(v); }
+
+    bool isIsolated(node v) const { return degree(v) == 0 && degreeIn(v) == 0; }
+
+    /**
+     * Returns the weighted (out-)degree of @a u.
+     *
+     * @param u Node.
+     * @param countSelfLoopsTwice If set to true, self-loops will be counted twice.
+     */
+    edgeweight weightedDegree(node u, bool countSelfLoopsTwice = false) const;
+
+    /**
+     * Returns the weighted in-degree of @a u.
+     *
+     * @param u Node.
+     * @param countSelfLoopsTwice If set to true, self-loops will be counted twice.
+     */
+    edgeweight weightedDegreeIn(node u, bool countSelfLoopsTwice = false) const;
+
+    /**
+     * Returns true if the edge (u, v) exists. Runs in O(deg(u)).
+     */
+    bool hasEdge(node u, node v) const noexcept;
+
+    /**
+     * Returns the weight of the edge (u, v), or nullWeight if it does not exist.
+     */
+    edgeweight weight(node u, node v) const;
+
+    /**
+     * Returns the sum of all edge weights.
+     */
+    edgeweight totalEdgeWeight() const noexcept;
+
+    node getIthNeighbor(node u, index i) const {
+        return i < degree(u) ? outEdges[outBegin[u] + i] : none;
+    }
+
+    node getIthInNeighbor(node u, index i) const {
+        if (!directed)
+            return getIthNeighbor(u, i);
+        return i < degreeIn(u) ? inEdges[inBegin[u] + i] : none;
+    }
+
+    edgeweight getIthNeighborWeight(node u, index i) const {
+        if (i >= degree(u))
+            return nullWeight;
+        return weighted ? outEdgeWeights[outBegin[u] + i] : defaultEdgeWeight;
+    }
+
+    /**
+     * Pointers to the first and past-the-end (outgoing) neighbor of @a u. The neighbors are
+     * contiguous in memory.
+     */
+    const node *neighborsBegin(node u) const { return outEdges.data() + outBegin[u]; }
+    const node *neighborsEnd(node u) const { return outEdges.data() + outBegin[u + 1]; }
+
+    /**
+     * Pointers to the first and past-the-end incoming neighbor of @a u.
+     */
+    const node *inNeighborsBegin(node u) const {
+        return directed ? inEdges.data() + inBegin[u] : neighborsBegin(u);
+    }
+    const node *inNeighborsEnd(node u) const {
+        return directed ? inEdges.data() + inBegin[u + 1] : neighborsEnd(u);
+    }
+
+    /* NODE ITERATORS */
+
+    /**
+     * Iterate over all nodes of the graph and call @a handle (lambda closure).
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void forNodes(L handle) const {
+        for (node v = 0; v < z; ++v) {
+            if (exists[v])
+                handle(v);
+        }
+    }
+
+    /**
+     * Iterate in parallel over all nodes of the graph and call @a handle (lambda closure).
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void parallelForNodes(L handle) const {
+#pragma omp parallel for if (z > 10000)
+        for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+            if (exists[v])
+                handle(v);
+        }
+    }
+
+    /**
+     * Iterate over all nodes of the graph and call @a handle (lambda closure) as long as
+     * @a condition remains true.
+     *
+     * @param condition Returning <code>false</code> breaks the loop.
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename C, typename L>
+    void forNodesWhile(C condition, L handle) const {
+        for (node v = 0; v < z; ++v) {
+            if (exists[v]) {
+                if (!condition())
+                    break;
+                handle(v);
+            }
+        }
+    }
+
+    /**
+     * Iterate in parallel over all nodes of the graph using schedule(guided) to remedy
+     * load-imbalances due to e.g. unequal degree distribution.
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void balancedParallelForNodes(L handle) const {
+#pragma omp parallel for schedule(guided) if (z > 10000)
+        for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+            if (exists[v])
+                handle(v);
+        }
+    }
+
+    /* EDGE ITERATORS */
+
+    /**
+     * Iterate over all edges of the graph and call @a handle (lambda closure).
+     *
+     * @param handle Takes parameters <code>(node, node)</code>, <code>(node, node,
+     * edgweight)</code>, <code>(node, node, edgeid)</code> or <code>(node, node, edgeweight,
+     * edgeid)</code>.
+     */
+    template <typename L>
+    void forEdges(L handle) const {
+        switch (weighted + 2 * directed + 4 * edgesIndexed) {
+        case 0:
+            forEdgeImpl<false, false, false, L>(handle);
+            break;
+        case 1:
+            forEdgeImpl<false, true, false, L>(handle);
+            break;
+        case 2:
+            forEdgeImpl<true, false, false, L>(handle);
+            break;
+        case 3:
+            forEdgeImpl<true, true, false, L>(handle);
+            break;
+        case 4:
+            forEdgeImpl<false, false, true, L>(handle);
+            break;
+        case 5:
+            forEdgeImpl<false, true, true, L>(handle);
+            break;
+        case 6:
+            forEdgeImpl<true, false, true, L>(handle);
+            break;
+        case 7:
+            forEdgeImpl<true, true, true, L>(handle);
+            break;
+        }
+    }
+
+    /**
+     * Iterate in parallel over all edges of the graph and call @a handle (lambda closure).
+     *
+     * @param handle Takes the same parameters as in forEdges.
+     */
+    template <typename L>
+    void parallelForEdges(L handle) const {
+        switch (weighted + 2 * directed + 4 * edgesIndexed) {
+        case 0:
+            parallelForEdgesImpl<false, false, false, L>(handle);
+            break;
+        case 1:
+            parallelForEdgesImpl<false, true, false, L>(handle);
+            break;
+        case 2:
+            parallelForEdgesImpl<true, false, false, L>(handle);
+            break;
+        case 3:
+            parallelForEdgesImpl<true, true, false, L>(handle);
+            break;
+        case 4:
+            parallelForEdgesImpl<false, false, true, L>(handle);
+            break;
+        case 5:
+            parallelForEdgesImpl<false, true, true, L>(handle);
+            break;
+        case 6:
+            parallelForEdgesImpl<true, false, true, L>(handle);
+            break;
+        case 7:
+            parallelForEdgesImpl<true, true, true, L>(handle);
+            break;
+        }
+    }
+
+    /* NEIGHBORHOOD ITERATORS */
+
+    /**
+     * Iterate over all (outgoing) neighbors of a node and call @a handle (lamdba closure).
+     *
+     * @param u Node.
+     * @param handle Takes parameter <code>(node)</code> or <code>(node, edgeweight)</code>
+     * which is a neighbor of @a u.
+     */
+    template <typename L>
+    void forNeighborsOf(node u, L handle) const {
+        forEdgesOf(u, handle);
+    }
+
+    /**
+     * Iterate over all (outgoing) edges of a node and call @a handle (lamdba closure).
+     *
+     * @param u Node.
+     * @param handle Takes the same parameters as in forEdges, the first node is @a u.
+     */
+    template <typename L>
+    void forEdgesOf(node u, L handle) const {
+        switch (weighted + 2 * edgesIndexed) {
+        case 0:
+            forOutEdgesOfImpl<true, false, false, L>(u, handle);
+            break;
+        case 1:
+            forOutEdgesOfImpl<true, true, false, L>(u, handle);
+            break;
+        case 2:
+            forOutEdgesOfImpl<true, false, true, L>(u, handle);
+            break;
+        case 3:
+            forOutEdgesOfImpl<true, true, true, L>(u, handle);
+            break;
+        }
+    }
+
+    /**
+     * Iterate over all incoming neighbors of a node and call @a handle (lamdba closure). For
+     * undirected graphs, this is the same as forNeighborsOf.
+     */
+    template <typename L>
+    void forInNeighborsOf(node u, L handle) const {
+        forInEdgesOf(u, handle);
+    }
+
+    /**
+     * Iterate over all incoming edges of a node and call @a handle (lamdba closure). For
+     * undirected graphs, this is the same as forEdgesOf.
+     */
+    template <typename L>
+    void forInEdgesOf(node u, L handle) const {
+        if (!directed) {
+            forEdgesOf(u, handle);
+            return;
+        }
+        switch (weighted + 2 * edgesIndexed) {
+        case 0:
+            forInEdgesOfImpl<false, false, L>(u, handle);
+            break;
+        case 1:
+            forInEdgesOfImpl<true, false, L>(u, handle);
+            break;
+        case 2:
+            forInEdgesOfImpl<false, true, L>(u, handle);
+            break;
+        case 3:
+            forInEdgesOfImpl<true, true, L>(u, handle);
+            break;
+        }
+    }
+
+    /* REDUCTION ITERATORS */
+
+    /**
+     * Iterate in parallel over all nodes and sum (reduce +) the values returned by the handler.
+     */
+    template <typename L>
+    double parallelSumForNodes(L handle) const {
+        double sum = 0.0;
+#pragma omp parallel for reduction(+ : sum) if (z > 10000)
+        for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+            if (exists[v])
+                sum += handle(v);
+        }
+        return sum;
+    }
+
+    /**
+     * Iterate in parallel over all edges and sum (reduce +) the values returned by the handler.
+     */
+    template <typename L>
+    double parallelSumForEdges(L handle) const {
+        switch (weighted + 2 * directed + 4 * edgesIndexed) {
+        case 0:
+            return parallelSumForEdgesImpl<false, false, false, L>(handle);
+        case 1:
+            return parallelSumForEdgesImpl<false, true, false, L>(handle);
+        case 2:
+            return parallelSumForEdgesImpl<true, false, false, L>(handle);
+        case 3:
+            return parallelSumForEdgesImpl<true, true, false, L>(handle);
+        case 4:
+            return parallelSumForEdgesImpl<false, false, true, L>(handle);
+        case 5:
+            return parallelSumForEdgesImpl<false, true, true, L>(handle);
+        case 6:
+            return parallelSumForEdgesImpl<true, false, true, L>(handle);
+        default:
+            return parallelSumForEdgesImpl<true, true, true, L>(handle);
+        }
+    }
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_CSR_GRAPH_HPP_
@@ -13,6 +13,7 @@
 #include <tlx/define/deprecated.hpp>
 
 #include <networkit/Globals.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
@@ -174,6 +175,14 @@ public:
      */
     Graph completeGraph(bool parallel);
 
+    /**
+     * Generates an immutable CSRGraph instance directly from the half edges, without creating
+     * an intermediate Graph. The adjacency arrays are filled in parallel; for each node, the
+     * neighbors are in the same order as in the graph returned by completeGraph(false). The
+     * graph builder will be reseted at the end.
+     */
+    CSRGraph completeCSRGraph();
+
     /**
      * Iterate over all nodes of the graph and call @a handle (lambda closure).
      *
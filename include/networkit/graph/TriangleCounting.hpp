@@ -0,0 +1,80 @@
+/*
+ * TriangleCounting.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_GRAPH_TRIANGLE_COUNTING_HPP_
+#define NETWORKIT_GRAPH_TRIANGLE_COUNTING_HPP_
+
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * Parallel triangle counting engine for undirected graphs, shared by the triangle-based
+ * measures (local and global clustering coefficients, triangle edge scores).
+ *
+ * Every edge is oriented from the endpoint of lower degree to the one of higher degree (ties
+ * broken by id), so every node has O(sqrt(m)) out-neighbors. Each triangle {u, v, w} is found
+ * exactly once, from its lowest node u and middle node v, by intersecting the sorted
+ * out-neighborhoods of u and v (see Aux::forSortedIntersection()). This takes O(m^1.5) time
+ * in total. The number of triangles of each node and of each edge are computed in the same
+ * pass. Self-loops are ignored.
+ *
+ * See also: Mark Ortmann and Ulrik Brandes: Triangle Listing Algorithms: Back from the
+ * Diversion. ALENEX 2014.
+ */
+class TriangleCounting final : public Algorithm {
+
+public:
+    /**
+     * @param G An undirected graph.
+     * @param nodeCounts Compute the number of triangles of each node.
+     * @param edgeCounts Compute the number of triangles of each edge; requires edge ids.
+     */
+    TriangleCounting(const Graph &G, bool nodeCounts = true, bool edgeCounts = false);
+
+    void run() override;
+
+    /**
+     * Returns the number of triangles that contain each node, indexed by node id.
+     */
+    const std::vector<count> &nodeTriangles() const {
+        assureFinished();
+        if (!nodeCounts)
+            throw std::runtime_error("Error: node counts have not been computed");
+        return nodeData;
+    }
+
+    /**
+     * Returns the number of triangles that contain each edge, indexed by edge id.
+     */
+    const std::vector<count> &edgeTriangles() const {
+        assureFinished();
+        if (!edgeCounts)
+            throw std::runtime_error("Error: edge counts have not been computed");
+        return edgeData;
+    }
+
+    /**
+     * Returns the total number of triangles in the graph.
+     */
+    count numberOfTriangles() const {
+        assureFinished();
+        return total;
+    }
+
+private:
+    const Graph *G;
+    bool nodeCounts, edgeCounts;
+    std::vector<count> nodeData, edgeData;
+    count total = 0;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_TRIANGLE_COUNTING_HPP_
@@ -32,9 +32,11 @@ public:
      * @param[in]  commentPrefix  prefix of comment lines
      * @param[in]  continuous  boolean to specify if node ids are continuous
      * @param[in]  directed  read graph as directed
+     * @param[in]  parallel  parse the file in parallel chunks and assemble the graph with
+     * multiple threads; the result is identical to the one of the sequential reader
      */
     EdgeListReader(char separator, node firstNode, const std::string &commentPrefix = "#",
-                   bool continuous = true, bool directed = false);
+                   bool continuous = true, bool directed = false, bool parallel = false);
 
     /**
      * Given the path of an input file, read the graph contained.
@@ -55,6 +57,9 @@ private:
     bool continuous;
     std::map<std::string, node> mapNodeIds;
     bool directed;
+    bool parallel;
+
+    Graph readParallel(const std::string &path);
 };
 
 } /* namespace NetworKit */
@@ -22,6 +22,12 @@ class METISGraphReader final : public GraphReader {
 public:
     METISGraphReader() = default;
 
+    /**
+     * @param[in]  parallel  locate the adjacency lines in parallel and parse them concurrently;
+     * the resulting graph is identical to the one of the sequential reader
+     */
+    explicit METISGraphReader(bool parallel) : parallel(parallel) {}
+
     /**
      * Takes a file path as parameter and returns a graph file.
      *
@@ -30,6 +36,11 @@ public:
      * @param[out]  the graph read from file
      */
     Graph read(const std::string &path) override;
+
+private:
+    bool parallel = false;
+
+    Graph readParallel(const std::string &path);
 };
 
 } /* namespace NetworKit */
@@ -0,0 +1,53 @@
+/*
+ * NetworkitBinaryFixedWidthReader.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_IO_NETWORKIT_BINARY_FIXED_WIDTH_READER_HPP_
+#define NETWORKIT_IO_NETWORKIT_BINARY_FIXED_WIDTH_READER_HPP_
+
+#include <string>
+
+#include <networkit/graph/CSRGraph.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/io/GraphReader.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ *
+ * Reads graphs written by NetworkitBinaryFixedWidthWriter.
+ */
+class NetworkitBinaryFixedWidthReader final : public GraphReader {
+
+public:
+    NetworkitBinaryFixedWidthReader() = default;
+
+    /**
+     * Maps the file into memory and returns a read-only CSRGraph whose arrays refer directly to
+     * the mapping. This takes constant time; the data is loaded lazily by the operating system
+     * when it is accessed, and the page cache is shared among all processes mapping the same
+     * file. The mapping is released with the last copy of the returned graph.
+     *
+     * Only the header and the bounds of the arrays are checked by default, so the contents of
+     * the file are trusted: corrupt offsets or ids lead to undefined behavior when the graph is
+     * used. With @a validate, the offsets are checked to be non-decreasing and all node and edge
+     * ids to be in range; this reads the offsets and ids once (in parallel).
+     *
+     * @param path Path of the file.
+     * @param validate Whether to validate the offsets and ids.
+     * @throws std::runtime_error if the file is truncated or corrupt.
+     */
+    CSRGraph map(const std::string &path, bool validate = false);
+
+    /**
+     * Reads the graph into a (mutable) Graph. The file is validated as by map(path, true).
+     */
+    Graph read(const std::string &path) override;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_IO_NETWORKIT_BINARY_FIXED_WIDTH_READER_HPP_
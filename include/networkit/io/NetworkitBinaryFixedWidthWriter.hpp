@@ -0,0 +1,33 @@
+/*
+ * NetworkitBinaryFixedWidthWriter.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_IO_NETWORKIT_BINARY_FIXED_WIDTH_WRITER_HPP_
+#define NETWORKIT_IO_NETWORKIT_BINARY_FIXED_WIDTH_WRITER_HPP_
+
+#include <networkit/graph/Graph.hpp>
+#include <networkit/io/GraphWriter.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ *
+ * Writes a graph in the uncompressed fixed-width variant of the Networkit binary format
+ * documented in cpp/io/NetworkitBinaryGraph.md. The files are larger than the ones of
+ * NetworkitBinaryWriter, but can be used without decoding, see
+ * NetworkitBinaryFixedWidthReader::map.
+ */
+class NetworkitBinaryFixedWidthWriter final : public GraphWriter {
+
+public:
+    NetworkitBinaryFixedWidthWriter() = default;
+
+    void write(const Graph &G, const std::string &path) override;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_IO_NETWORKIT_BINARY_FIXED_WIDTH_WRITER_HPP_
@@ -32,6 +32,33 @@ struct Header {
     uint64_t offsetAdjIdTranspose;
 };
 
+/**
+ * Header of the uncompressed fixed-width variant of the format (magic 'nkbgfw1'). All arrays
+ * are stored in native (little endian) byte order at 8-byte aligned absolute file offsets, so
+ * that they can be used in place after mapping the file into memory. An offset of zero marks
+ * an array that is not present.
+ */
+struct FixedWidthHeader {
+    char magic[8];
+    uint64_t features;
+    uint64_t nodes; // upper node id bound
+    uint64_t numberOfNodes;
+    uint64_t numberOfEdges;
+    uint64_t numberOfSelfLoops;
+    uint64_t upperEdgeIdBound;
+    uint64_t offsetNodeFlags;
+    uint64_t offsetAdjBegin;
+    uint64_t offsetAdjLists;
+    uint64_t offsetWeightLists;
+    uint64_t offsetAdjIdLists;
+    uint64_t offsetTransposeBegin;
+    uint64_t offsetAdjTranspose;
+    uint64_t offsetWeightTranspose;
+    uint64_t offsetAdjIdTranspose;
+};
+
+static constexpr char FIXED_WIDTH_MAGIC[8] = "nkbgfw1";
+
 enum class WeightFormat : int { NONE = 0, VARINT = 1, SIGNED_VARINT = 2, DOUBLE = 3, FLOAT = 4 };
 
 using WEIGHT_FORMAT = WeightFormat; // enum alias for backwards compatibility
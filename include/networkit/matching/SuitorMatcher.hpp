@@ -9,6 +9,7 @@
 #ifndef NETWORKIT_MATCHING_SUITOR_MATCHER_HPP_
 #define NETWORKIT_MATCHING_SUITOR_MATCHER_HPP_
 
+#include <atomic>
 #include <vector>
 
 #include <networkit/graph/Graph.hpp>
@@ -27,6 +28,14 @@ class SuitorMatcher final : public Matcher {
     void findSuitor(node current);
     void findSortSuitor(node current);
 
+    // Returns whether an edge {u, v} of the given weight is preferred by v over the edge to its
+    // current suitor, which is stored in currentSuitor.
+    bool beatsSuitor(node u, edgeweight weight, node v, node &currentSuitor) const;
+
+    // Makes current the suitor of partner if the suitor of partner is still displaced and returns
+    // true; otherwise stores the current suitor of partner in displaced and returns false.
+    bool propose(node current, node partner, edgeweight weight, node &displaced);
+
 public:
     /**
      * Computes a 1/2-approximation of the maximum (weighted) matching of an undirected graph using
@@ -36,6 +45,11 @@ public:
      * (works on generic graphs). If using SortSuitor, use GrapTools::sortEdgesByWeight(G, true) to
      * sort the adjacency lists by non-increasing edge weight.
      *
+     * The nodes propose in parallel: the suitor of a node is updated with a single compare-and-swap,
+     * and the weight of the proposal is stored at the proposing node, so no locks are needed. The
+     * resulting matching does not depend on the order of the proposals and is the same as the one
+     * of the sequential algorithm.
+     *
      * @param G An undirected graph.
      * @param sortSuitor If true uses the SortSuitor version, otherwise it uses Suitor.
      * @param checkSortedEdges If true and sortSuitor is true it checks whether the adjacency lists
@@ -53,8 +67,11 @@ public:
 
 private:
     bool sortSuitor;
-    std::vector<node> suitor;
-    std::vector<edgeweight> ws;
+    std::vector<std::atomic<node>> suitor;
+    // Weight of the last proposal of each node. Only the thread that handles a node writes it, and
+    // no thread handles a node while it is the suitor of another one, so for a suitor this is the
+    // weight of its edge.
+    std::vector<std::atomic<edgeweight>> proposedWeight;
     std::vector<index> neighborIterators;
 };
 } // namespace NetworKit
@@ -12,7 +12,7 @@
 #include <vector>
 
 #include <networkit/algebraic/MatrixTools.hpp>
-#include <networkit/components/ParallelConnectedComponents.hpp>
+#include <networkit/components/AfforestConnectedComponents.hpp>
 #include <networkit/numerics/GaussSeidelRelaxation.hpp>
 #include <networkit/numerics/LAMG/MultiLevelSetup.hpp>
 #include <networkit/numerics/LAMG/SolverLamg.hpp>
@@ -175,7 +175,7 @@ template <class Matrix>
 void Lamg<Matrix>::setup(const Matrix &laplacianMatrix) {
     this->laplacianMatrix = laplacianMatrix;
     Graph G = MatrixTools::matrixToGraph(laplacianMatrix);
-    ParallelConnectedComponents con(G, false);
+    AfforestConnectedComponents con(G);
     con.run();
     numComponents = con.numberOfComponents();
     if (numComponents == 1) {
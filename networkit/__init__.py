@@ -126,7 +126,7 @@ def overview(G):
 		return nIsolated
 
 	def getClusteringCoefficient(G):
-		lcc = centrality.LocalClusteringCoefficient(G, True).run().scores()
+		lcc = centrality.LocalClusteringCoefficient(G).run().scores()
 		return sum(lcc) / n
 
 	def getComponentPartition(G):
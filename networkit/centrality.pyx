@@ -128,16 +128,17 @@ cdef class Centrality(Algorithm):
 cdef extern from "<networkit/centrality/Betweenness.hpp>":
 
 	cdef cppclass _Betweenness "NetworKit::Betweenness" (_Centrality):
-		_Betweenness(_Graph, bool_t, bool_t) except +
+		_Betweenness(_Graph, bool_t, bool_t, count) except +
 		vector[double] edgeScores() except +
 
 cdef class Betweenness(Centrality):
 	"""
-	Betweenness(G, normalized=False, computeEdgeCentrality=False)
+	Betweenness(G, normalized=False, computeEdgeCentrality=False, memoryBudget=0)
 
 	Constructs the Betweenness class for the given Graph `G`. If the betweenness scores should be normalized,
 	then set `normalized` to True. The run() method takes O(nm) time, where n is the number
- 	of nodes and m is the number of edges of the graph.
+ 	of nodes and m is the number of edges of the graph. The sources are processed in batches, whose
+	size is derived from `memoryBudget`.
 
  	Parameters
  	----------
@@ -147,11 +148,15 @@ cdef class Betweenness(Centrality):
  		Set this parameter to True if scores should be normalized in the interval [0,1]. Default: False
 	computeEdgeCentrality: bool, optional
 		Set this to true if edge betweenness scores should be computed as well. Default: False
+	memoryBudget : int, optional
+		Upper bound in bytes on the memory used by the threads, which determines the number of
+		sources per batch; at least one source per thread is processed in each batch. 0 means that
+		the buffers of each thread may take up to 64 MiB. Default: 0
 	"""
 
-	def __cinit__(self, Graph G, normalized=False, computeEdgeCentrality=False):
+	def __cinit__(self, Graph G, normalized=False, computeEdgeCentrality=False, memoryBudget=0):
 		self._G = G
-		self._this = new _Betweenness(G._this, normalized, computeEdgeCentrality)
+		self._this = new _Betweenness(G._this, normalized, computeEdgeCentrality, memoryBudget)
 
 
 	def edgeScores(self):
@@ -2171,7 +2176,7 @@ cdef class DynKatzCentrality(Centrality):
 cdef extern from "<networkit/centrality/LocalClusteringCoefficient.hpp>":
 
 	cdef cppclass _LocalClusteringCoefficient "NetworKit::LocalClusteringCoefficient" (_Centrality):
-		_LocalClusteringCoefficient(_Graph, bool_t) except +
+		_LocalClusteringCoefficient(_Graph) except +
 
 cdef class LocalClusteringCoefficient(Centrality):
 	"""
@@ -2180,24 +2185,24 @@ cdef class LocalClusteringCoefficient(Centrality):
 	Constructs the LocalClusteringCoefficient class for the given Graph `G`. If the local clustering coefficient values should be normalized,
 	then set `normalized` to True. The graph may not contain self-loops.
 
-	There are two algorithms available. The trivial (parallel) algorithm needs only a small amount of additional memory.
-	The turbo mode adds a (sequential, but fast) pre-processing step using ideas from Triangle Listing Algorithms: Back 
-	from the Diversion (Mark Ortmann and Ulrik Brandes). This reduces the running time significantly for most graphs. 
-	However, the turbo mode needs O(m) additional memory. In practice this should be a bit less than half of the memory 
-	that is needed for the graph itself. The turbo mode is particularly effective for graphs with nodes of very high degree 
-	and a very skewed degree distribution.
+	The edges are oriented by degree using ideas from Triangle Listing Algorithms: Back from the Diversion (Mark Ortmann
+	and Ulrik Brandes). This needs O(m) additional memory. In practice this should be a bit less than half of the memory
+	that is needed for the graph itself.
 
  	Parameters
  	----------
  	G : networkit.Graph
  		The input graph.
 	turbo : bool, optional
-		If the turbo mode shall be activated. Default: False
+		Deprecated and ignored, the former turbo mode is always used. Default: False
 	"""
 
 	def __cinit__(self, Graph G, bool_t turbo = False):
+		if turbo:
+			from warnings import warn
+			warn("LocalClusteringCoefficient: turbo is deprecated and ignored")
 		self._G = G
-		self._this = new _LocalClusteringCoefficient(G._this, turbo)
+		self._this = new _LocalClusteringCoefficient(G._this)
 
 cdef extern from "<networkit/centrality/LocalSquareClusteringCoefficient.hpp>":
 
@@ -2427,6 +2432,75 @@ cdef class CoreDecomposition(Centrality):
 		"""
 		return (<_CoreDecomposition*>(self._this)).getNodeOrder()
 
+cdef extern from "<networkit/centrality/DynCoreDecomposition.hpp>":
+
+	cdef cppclass _DynCoreDecomposition "NetworKit::DynCoreDecomposition" (_Centrality):
+		_DynCoreDecomposition(_Graph) except +
+		void update(_GraphEvent) except +
+		void updateBatch(vector[_GraphEvent]) except +
+		index maxCoreNumber() except +
+
+cdef class DynCoreDecomposition(Centrality):
+	"""
+	DynCoreDecomposition(G)
+
+	Maintains the core numbers of an undirected graph without self-loops under
+	edge insertions and removals. Removals are handled by iterating h-indices
+	starting from the old core numbers, insertions by a traversal of the nodes
+	whose core number can increase.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The graph.
+	"""
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _DynCoreDecomposition(G._this)
+
+	def update(self, ev):
+		"""
+		update(ev)
+
+		Updates the core numbers after an event that has been applied to the graph.
+
+		Parameters
+		----------
+		ev : networkit.dynamics.GraphEvent
+			The event.
+		"""
+		(<_DynCoreDecomposition*>(self._this)).update(_GraphEvent(ev.type, ev.u, ev.v, ev.w))
+
+	def updateBatch(self, batch):
+		"""
+		updateBatch(batch)
+
+		Updates the core numbers after a batch of events that has been applied to the graph.
+
+		Parameters
+		----------
+		batch : list(networkit.dynamics.GraphEvent)
+			The events.
+		"""
+		cdef vector[_GraphEvent] _batch
+		for ev in batch:
+			_batch.push_back(_GraphEvent(ev.type, ev.u, ev.v, ev.w))
+		(<_DynCoreDecomposition*>(self._this)).updateBatch(_batch)
+
+	def maxCoreNumber(self):
+		"""
+		maxCoreNumber()
+
+		Get maximum core number.
+
+		Returns
+		-------
+		int
+			The maximum core number.
+		"""
+		return (<_DynCoreDecomposition*>(self._this)).maxCoreNumber()
+
 cdef extern from "<networkit/centrality/EigenvectorCentrality.hpp>":
 
 	cdef cppclass _EigenvectorCentrality "NetworKit::EigenvectorCentrality" (_Centrality):
@@ -2463,6 +2537,10 @@ cdef extern from "<networkit/centrality/PageRank.hpp>" namespace "NetworKit::Pag
 		NO_SINK_HANDLING,
 		DISTRIBUTE_SINKS,
 
+	cdef enum _UpdateScheme "NetworKit::PageRank::UpdateScheme":
+		SYNCHRONOUS,
+		GAUSS_SEIDEL
+
 class Norm(object):
 	L1_NORM = _Norm.L1_NORM
 	L2_NORM = _Norm.L2_NORM
@@ -2475,6 +2553,10 @@ class SinkHandling(object):
 	NoSinkHandling = NO_SINK_HANDLING # this + following added for backwards compatibility
 	DistributeSinks = DISTRIBUTE_SINKS
 
+class UpdateScheme(object):
+	SYNCHRONOUS = _UpdateScheme.SYNCHRONOUS
+	GAUSS_SEIDEL = _UpdateScheme.GAUSS_SEIDEL
+
 cdef extern from "<networkit/centrality/PageRank.hpp>":
 
 	cdef cppclass _PageRank "NetworKit::PageRank" (_Centrality):
@@ -2482,6 +2564,8 @@ cdef extern from "<networkit/centrality/PageRank.hpp>":
 		count numberOfIterations() except +
 		_Norm norm
 		count maxIterations
+		_UpdateScheme updateScheme
+		bool_t singlePrecision
 
 cdef class PageRank(Centrality):
 	""" 
@@ -2567,6 +2651,237 @@ cdef class PageRank(Centrality):
 				raise Exception("Max iterations cannot be a negative number.")
 			(<_PageRank*>(self._this)).maxIterations = maxIterations
 
+	property updateScheme:
+		"""
+		Property :code:`updateScheme` can be one of the following:
+
+		- networkit.centrality.UpdateScheme.SYNCHRONOUS
+		- networkit.centrality.UpdateScheme.GAUSS_SEIDEL
+
+		With GAUSS_SEIDEL, each thread immediately uses the new ranks within its
+		block of nodes, which usually needs fewer iterations.
+		Default: networkit.centrality.UpdateScheme.SYNCHRONOUS
+		"""
+		def __get__(self):
+			""" Get the update scheme of the iteration. """
+			return (<_PageRank*>(self._this)).updateScheme
+		def __set__(self, _UpdateScheme updateScheme):
+			""" Set the update scheme of the iteration. """
+			(<_PageRank*>(self._this)).updateScheme = updateScheme
+
+	property singlePrecision:
+		"""
+		Property :code:`singlePrecision` stores the ranks in single precision during
+		the iteration, the tolerance is then raised to the rounding error of float
+		if necessary. Default: False
+		"""
+		def __get__(self):
+			""" Get whether the ranks are stored in single precision. """
+			return (<_PageRank*>(self._this)).singlePrecision
+		def __set__(self, bool_t singlePrecision):
+			""" Set whether the ranks are stored in single precision. """
+			(<_PageRank*>(self._this)).singlePrecision = singlePrecision
+
+cdef extern from "<networkit/centrality/PersonalizedPageRank.hpp>":
+
+	cdef cppclass _PersonalizedPageRank "NetworKit::PersonalizedPageRank" (_Algorithm):
+		_PersonalizedPageRank(_Graph, vector[vector[node]] seedSets, double damp, double tol) except +
+		vector[double] scores(index i) except +
+		double score(node u, index i) except +
+		count numberOfIterations() except +
+		_Norm norm
+		count maxIterations
+
+cdef class PersonalizedPageRank(Algorithm):
+	"""
+	PersonalizedPageRank(G, seedSets, damp=0.85, tol=1e-8)
+
+	Computes personalized PageRank for a batch of seed sets at once. For each seed set,
+	the random surfer teleports to a uniformly chosen seed; the rank of sinks is also
+	returned to the seeds. All seed sets are updated in a single sweep over the edges
+	per iteration.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		Graph to be processed.
+	seedSets : list(list(int))
+		The seed sets, each one must be non-empty.
+	damp : float, optional
+		Damping factor of the PageRank algorithm. Default: 0.85
+	tol : float, optional
+		Error tolerance for the PageRank iteration, it must be reached by all seed sets. Default: 1e-8
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G, seedSets, double damp=0.85, double tol=1e-8):
+		self._G = G
+		self._this = new _PersonalizedPageRank(G._this, seedSets, damp, tol)
+
+	def scores(self, index i):
+		"""
+		scores(i)
+
+		Returns the personalized PageRank scores of all nodes for the i-th seed set.
+
+		Parameters
+		----------
+		i : int
+			Index of the seed set.
+
+		Returns
+		-------
+		list(float)
+			The scores of all nodes.
+		"""
+		return (<_PersonalizedPageRank*>(self._this)).scores(i)
+
+	def score(self, node u, index i):
+		"""
+		score(u, i)
+
+		Returns the personalized PageRank score of node u for the i-th seed set.
+
+		Parameters
+		----------
+		u : int
+			The node.
+		i : int
+			Index of the seed set.
+
+		Returns
+		-------
+		float
+			The score of u.
+		"""
+		return (<_PersonalizedPageRank*>(self._this)).score(u, i)
+
+	def numberOfIterations(self):
+		"""
+		numberOfIterations()
+
+		Returns the number of iterations performed by the algorithm.
+
+		Returns
+		-------
+		int
+			Number of iterations performed by the algorithm.
+		"""
+		return (<_PersonalizedPageRank*>(self._this)).numberOfIterations()
+
+	property norm:
+		"""
+		Property :code:`norm` sets the norm used as stopping criterion, see PageRank.
+		Default: networkit.centrality.Norm.L2_NORM
+		"""
+		def __get__(self):
+			""" Get the norm used as stopping criterion. """
+			return (<_PersonalizedPageRank*>(self._this)).norm
+		def __set__(self, _Norm norm):
+			""" Set the norm used as stopping criterion. """
+			(<_PersonalizedPageRank*>(self._this)).norm = norm
+
+	property maxIterations:
+		"""
+		Property :code:`maxIterations` sets a stopping criteria based on number
+		of runs. Default: unlimited
+		"""
+		def __get__(self):
+			""" Get the maximum number of iterations. """
+			return (<_PersonalizedPageRank*>(self._this)).maxIterations
+		def __set__(self, maxIterations):
+			""" Set the maximum number of iterations. """
+			if maxIterations < 0:
+				raise Exception("Max iterations cannot be a negative number.")
+			(<_PersonalizedPageRank*>(self._this)).maxIterations = maxIterations
+
+
+cdef extern from "<networkit/centrality/DynPageRank.hpp>":
+
+	cdef cppclass _DynPageRank "NetworKit::DynPageRank" (_Centrality):
+		_DynPageRank(_Graph G, double damp, double tol) except +
+		void update(_GraphEvent) except +
+		void updateBatch(vector[_GraphEvent]) except +
+		count numberOfPushes() except +
+		_Norm norm
+
+cdef class DynPageRank(Centrality):
+	"""
+	DynPageRank(G, damp=0.85, tol=1e-8)
+
+	Maintains PageRank (without sink handling) under edge insertions, removals
+	and weight changes. After an update, the residuals of the affected nodes are
+	pushed along the out-edges (Gauss-Southwell), starting from the previous
+	scores, until the residual is within the tolerance again; this is the same
+	stopping criterion as the one of PageRank.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The input graph.
+	damp : float, optional
+		Damping factor of the PageRank algorithm. Default: 0.85
+	tol : float, optional
+		Error tolerance, i.e., bound on the norm of the residual. Default: 1e-8
+	"""
+
+	def __cinit__(self, Graph G, double damp=0.85, double tol=1e-8):
+		self._G = G
+		self._this = new _DynPageRank(G._this, damp, tol)
+
+	def update(self, ev):
+		"""
+		update(ev)
+
+		Updates the scores after an edge event that has been applied to the graph.
+
+		Parameters
+		----------
+		ev : networkit.dynamics.GraphEvent
+			The edge event.
+		"""
+		(<_DynPageRank*>(self._this)).update(_GraphEvent(ev.type, ev.u, ev.v, ev.w))
+
+	def updateBatch(self, batch):
+		"""
+		updateBatch(batch)
+
+		Updates the scores after a batch of edge events that has been applied to the graph.
+
+		Parameters
+		----------
+		batch : list(networkit.dynamics.GraphEvent)
+			The edge events.
+		"""
+		cdef vector[_GraphEvent] _batch
+		for ev in batch:
+			_batch.push_back(_GraphEvent(ev.type, ev.u, ev.v, ev.w))
+		(<_DynPageRank*>(self._this)).updateBatch(_batch)
+
+	def numberOfPushes(self):
+		"""
+		numberOfPushes()
+
+		Returns the number of pushes performed by the last update.
+
+		Returns
+		-------
+		int
+			The number of pushes.
+		"""
+		return (<_DynPageRank*>(self._this)).numberOfPushes()
+
+	property norm:
+		"""
+		Property :code:`norm` sets the norm used as stopping criterion, see PageRank.
+		Default: networkit.centrality.Norm.L2_NORM
+		"""
+		def __get__(self):
+			""" Get the norm used as stopping criterion. """
+			return (<_DynPageRank*>(self._this)).norm
+		def __set__(self, _Norm norm):
+			""" Set the norm used as stopping criterion. """
+			(<_DynPageRank*>(self._this)).norm = norm
 
 cdef extern from "<networkit/centrality/SpanningEdgeCentrality.hpp>":
 
@@ -57,6 +57,7 @@ cdef class MaximalCliques(Algorithm):
 	The running time in practive depends on the structure of the graph. In
 	particular for complex networks it is usually quite fast, even graphs with
 	millions of edges can usually be processed in less than a minute.
+	The subproblems of the nodes are solved in parallel.
 
 	Parameters
 	----------
@@ -69,7 +70,7 @@ cdef class MaximalCliques(Algorithm):
 	callback : callable, optional
 		If a callable Python object is given, it will be called once for each
 		maximal clique. Then no cliques will be stored. The callback must accept
-		one parameter which is a list of nodes. Default: None
+		one parameter which is a list of nodes. It is never called concurrently. Default: None
 	"""
 	cdef NodeVectorCallbackWrapper* _callback
 	cdef Graph _G
@@ -5,6 +5,7 @@ from libcpp cimport bool as bool_t
 from libcpp.vector cimport vector
 from libcpp.utility cimport pair
 from libcpp.map cimport map
+from libc.stdint cimport uint64_t
 
 import os
 import math
@@ -21,6 +22,7 @@ import tempfile
 import subprocess
 
 from .base cimport _Algorithm, Algorithm
+from .dynamics cimport _GraphEvent, GraphEvent
 from .graph cimport _Graph, Graph
 from .structures cimport _Partition, Partition, _Cover, Cover, count, index, node, edgeweight
 from .graphio import PartitionReader, PartitionWriter, EdgeListPartitionReader, BinaryPartitionReader, BinaryPartitionWriter, BinaryEdgeListPartitionReader, BinaryEdgeListPartitionWriter
@@ -726,6 +728,100 @@ cdef class ParallelLeiden(CommunityDetector):
 		self._G = G
 		self._this = new _ParallelLeiden(G._this,iterations,randomize,gamma)
 
+cdef extern from "<networkit/community/GraphPartitioner.hpp>":
+
+	cdef cppclass _GraphPartitioner "NetworKit::GraphPartitioner"(_CommunityDetectionAlgorithm):
+		_GraphPartitioner(_Graph _G, count k, double imbalance) except +
+
+cdef class GraphPartitioner(CommunityDetector):
+	"""
+	GraphPartitioner(G, k, imbalance=0.03)
+
+	Parallel multilevel graph partitioner. Divides the nodes into k blocks such that
+	few edges run between the blocks; each block contains at most (1 + imbalance) * ceil(n / k) nodes.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		An undirected graph.
+	k : int
+		The number of blocks.
+	imbalance : float, optional
+		The allowed imbalance of the block sizes. Default: 0.03
+	"""
+
+	def __cinit__(self, Graph G not None, count k, double imbalance = 0.03):
+		self._G = G
+		self._this = new _GraphPartitioner(G._this, k, imbalance)
+
+cdef extern from "<networkit/community/DynLeiden.hpp>":
+
+	cdef cppclass _DynLeiden "NetworKit::DynLeiden"(_CommunityDetectionAlgorithm):
+		_DynLeiden(_Graph _G, int iterations, bool_t randomize, double gamma) except +
+		_DynLeiden(_Graph _G, _Partition previous, bool_t randomize, double gamma) except +
+		void update(_GraphEvent) except +
+		void updateBatch(vector[_GraphEvent]) except +
+
+cdef class DynLeiden(CommunityDetector):
+	"""
+	DynLeiden(G, previous=None, iterations=3, randomize=True, gamma=1)
+
+	Maintains a community structure of a changing graph with the Leiden algorithm. An update
+	starts from the previous partition; only the endpoints of the changed edges and the other
+	nodes of their communities are active in the first local moving phase, and only the
+	communities that contain active nodes or change are refined.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		An undirected graph.
+	previous : networkit.Partition, optional
+		A partition of G to start with. If given, run() does not need to be called before the
+		first update. Default: None
+	iterations : int, optional
+		Number of Leiden iterations of run(). Default: 3
+	randomize : bool, optional
+		Whether to randomize the node order or not. Default: True
+	gamma : float, optional
+		Multi-resolution modularity parameter. Default: 1.0
+	"""
+
+	def __cinit__(self, Graph G not None, Partition previous = None, int iterations = 3, bool_t randomize = True, double gamma = 1):
+		self._G = G
+		if previous is None:
+			self._this = new _DynLeiden(G._this, iterations, randomize, gamma)
+		else:
+			self._this = new _DynLeiden(G._this, previous._this, randomize, gamma)
+
+	def update(self, ev):
+		"""
+		update(ev)
+
+		Updates the partition after an event that has been applied to the graph.
+
+		Parameters
+		----------
+		ev : networkit.dynamics.GraphEvent
+			The event.
+		"""
+		(<_DynLeiden*>(self._this)).update(_GraphEvent(ev.type, ev.u, ev.v, ev.w))
+
+	def updateBatch(self, batch):
+		"""
+		updateBatch(batch)
+
+		Updates the partition after a batch of events that has been applied to the graph.
+
+		Parameters
+		----------
+		batch : list(networkit.dynamics.GraphEvent)
+			The events.
+		"""
+		cdef vector[_GraphEvent] _batch
+		for ev in batch:
+			_batch.push_back(_GraphEvent(ev.type, ev.u, ev.v, ev.w))
+		(<_DynLeiden*>(self._this)).updateBatch(_batch)
+
 cdef extern from "<networkit/community/LouvainMapEquation.hpp>":
 	cdef cppclass _LouvainMapEquation "NetworKit::LouvainMapEquation"(_CommunityDetectionAlgorithm):
 		_LouvainMapEquation(_Graph, bool, count, string ) except +
@@ -759,6 +855,7 @@ cdef extern from "<networkit/community/PLP.hpp>":
 		_PLP(_Graph _G, _Partition baseClustering, count updateThreshold) except +
 		count numberOfIterations() except +
 		vector[count] &getTiming() except +
+		void setDeterministic(bool_t deterministic, uint64_t seed) except +
 
 
 cdef class PLP(CommunityDetector):
@@ -830,6 +927,22 @@ cdef class PLP(CommunityDetector):
 		"""
 		return (<_PLP*>(self._this)).getTiming()
 
+	def setDeterministic(self, deterministic, seed=0):
+		"""
+		setDeterministic(deterministic, seed=0)
+
+		Makes the result depend only on the graph and the seed, but not on the number of
+		threads or their scheduling.
+
+		Parameters
+		----------
+		deterministic : bool
+			Whether the result is to be reproducible.
+		seed : int, optional
+			The seed of the hashes used to order the updates and break ties. Default: 0
+		"""
+		(<_PLP*>(self._this)).setDeterministic(deterministic, seed)
+
 cdef extern from "<networkit/community/LFM.hpp>":
 
 	cdef cppclass _LFM "NetworKit::LFM"(_OverlappingCommunityDetectionAlgorithm):
@@ -966,11 +1079,19 @@ cdef class DissimilarityMeasure:
 	# TODO: use conventional class design of parametrized constructor, run-method and getters
 	pass
 
+cdef vector[_Partition] _toPartitionVector(partitions) except *:
+	cdef vector[_Partition] result
+	cdef Partition partition
+	for partition in partitions:
+		result.push_back(partition._this)
+	return result
+
 cdef extern from "<networkit/community/NodeStructuralRandMeasure.hpp>":
 
 	cdef cppclass _NodeStructuralRandMeasure "NetworKit::NodeStructuralRandMeasure":
 		_NodeStructuralRandMeasure() except +
 		double getDissimilarity(_Graph G, _Partition first, _Partition second) nogil except +
+		vector[double] getDissimilarities(_Graph G, _Partition reference, vector[_Partition] candidates) nogil except +
 
 cdef class NodeStructuralRandMeasure(DissimilarityMeasure):
 	""" 
@@ -1006,6 +1127,33 @@ cdef class NodeStructuralRandMeasure(DissimilarityMeasure):
 			ret = self._this.getDissimilarity(G._this, first._this, second._this)
 		return ret
 
+	def getDissimilarities(self, Graph G not None, Partition reference not None, candidates):
+		"""
+		getDissimilarities(G, reference, candidates)
+
+		Returns the dissimilarities between a reference partition and each of the candidates.
+		The nodes are grouped by their cluster in the reference partition only once.
+
+		Parameters
+		----------
+		G : networkit.Graph
+			The input graph.
+		reference : networkit.Partition
+			The reference partition.
+		candidates : list(networkit.Partition)
+			The partitions to compare with the reference.
+
+		Returns
+		-------
+		list(float)
+			Dissimilarity between the reference and each candidate.
+		"""
+		cdef vector[_Partition] _candidates = _toPartitionVector(candidates)
+		cdef vector[double] ret
+		with nogil:
+			ret = self._this.getDissimilarities(G._this, reference._this, _candidates)
+		return ret
+
 
 cdef extern from "<networkit/community/GraphStructuralRandMeasure.hpp>":
 
@@ -1053,6 +1201,7 @@ cdef extern from "<networkit/community/JaccardMeasure.hpp>":
 	cdef cppclass _JaccardMeasure "NetworKit::JaccardMeasure":
 		_JaccardMeasure() except +
 		double getDissimilarity(_Graph G, _Partition first, _Partition second) nogil except +
+		vector[double] getDissimilarities(_Graph G, _Partition reference, vector[_Partition] candidates) nogil except +
 
 cdef class JaccardMeasure(DissimilarityMeasure):
 	""" 
@@ -1085,11 +1234,39 @@ cdef class JaccardMeasure(DissimilarityMeasure):
 			ret = self._this.getDissimilarity(G._this, first._this, second._this)
 		return ret
 
+	def getDissimilarities(self, Graph G not None, Partition reference not None, candidates):
+		"""
+		getDissimilarities(G, reference, candidates)
+
+		Returns the dissimilarities between a reference partition and each of the candidates.
+		The nodes are grouped by their cluster in the reference partition only once.
+
+		Parameters
+		----------
+		G : networkit.Graph
+			The input graph.
+		reference : networkit.Partition
+			The reference partition.
+		candidates : list(networkit.Partition)
+			The partitions to compare with the reference.
+
+		Returns
+		-------
+		list(float)
+			Dissimilarity between the reference and each candidate.
+		"""
+		cdef vector[_Partition] _candidates = _toPartitionVector(candidates)
+		cdef vector[double] ret
+		with nogil:
+			ret = self._this.getDissimilarities(G._this, reference._this, _candidates)
+		return ret
+
 cdef extern from "<networkit/community/NMIDistance.hpp>":
 
 	cdef cppclass _NMIDistance "NetworKit::NMIDistance":
 		_NMIDistance() except +
 		double getDissimilarity(_Graph G, _Partition first, _Partition second) nogil except +
+		vector[double] getDissimilarities(_Graph G, _Partition reference, vector[_Partition] candidates) nogil except +
 
 cdef class NMIDistance(DissimilarityMeasure):
 	""" 
@@ -1125,10 +1302,38 @@ cdef class NMIDistance(DissimilarityMeasure):
 			ret = self._this.getDissimilarity(G._this, first._this, second._this)
 		return ret
 
+	def getDissimilarities(self, Graph G not None, Partition reference not None, candidates):
+		"""
+		getDissimilarities(G, reference, candidates)
+
+		Returns the dissimilarities between a reference partition and each of the candidates.
+		The nodes are grouped by their cluster in the reference partition only once.
+
+		Parameters
+		----------
+		G : networkit.Graph
+			The input graph.
+		reference : networkit.Partition
+			The reference partition.
+		candidates : list(networkit.Partition)
+			The partitions to compare with the reference.
+
+		Returns
+		-------
+		list(float)
+			Dissimilarity between the reference and each candidate.
+		"""
+		cdef vector[_Partition] _candidates = _toPartitionVector(candidates)
+		cdef vector[double] ret
+		with nogil:
+			ret = self._this.getDissimilarities(G._this, reference._this, _candidates)
+		return ret
+
 cdef extern from "<networkit/community/AdjustedRandMeasure.hpp>":
 
 	cdef cppclass _AdjustedRandMeasure "NetworKit::AdjustedRandMeasure":
 		double getDissimilarity(_Graph G, _Partition first, _Partition second) nogil except +
+		vector[double] getDissimilarities(_Graph G, _Partition reference, vector[_Partition] candidates) nogil except +
 
 cdef class AdjustedRandMeasure(DissimilarityMeasure):
 	"""
@@ -1163,6 +1368,33 @@ cdef class AdjustedRandMeasure(DissimilarityMeasure):
 			ret = self._this.getDissimilarity(G._this, first._this, second._this)
 		return ret
 
+	def getDissimilarities(self, Graph G not None, Partition reference not None, candidates):
+		"""
+		getDissimilarities(G, reference, candidates)
+
+		Returns the dissimilarities between a reference partition and each of the candidates.
+		The nodes are grouped by their cluster in the reference partition only once.
+
+		Parameters
+		----------
+		G : networkit.Graph
+			The input graph.
+		reference : networkit.Partition
+			The reference partition.
+		candidates : list(networkit.Partition)
+			The partitions to compare with the reference.
+
+		Returns
+		-------
+		list(float)
+			Dissimilarity between the reference and each candidate.
+		"""
+		cdef vector[_Partition] _candidates = _toPartitionVector(candidates)
+		cdef vector[double] ret
+		with nogil:
+			ret = self._this.getDissimilarities(G._this, reference._this, _candidates)
+		return ret
+
 cdef extern from "<networkit/community/LocalCommunityEvaluation.hpp>":
 
 	cdef cppclass _LocalCommunityEvaluation "NetworKit::LocalCommunityEvaluation"(_Algorithm):
@@ -1541,6 +1773,71 @@ cdef class PartitionFragmentation(LocalPartitionEvaluation):
 	def __cinit__(self):
 		self._this = new _PartitionFragmentation(self._G._this, self._P._this)
 
+cdef extern from "<networkit/community/PartitionEvaluator.hpp>":
+
+	cdef struct _PartitionQuality "NetworKit::PartitionQuality":
+		double modularity
+		double coverage
+		double edgeCut
+		double conductance
+		double intrapartitionDensity
+		double hubDominance
+		double fragmentation
+		count numberOfClusters
+		vector[count] clusterSizes
+		vector[edgeweight] intraClusterWeights
+		vector[edgeweight] cutWeights
+		vector[edgeweight] volumes
+		vector[double] conductances
+		vector[double] intrapartitionDensities
+		vector[double] hubDominances
+		vector[double] fragmentations
+
+	cdef cppclass _PartitionEvaluator "NetworKit::PartitionEvaluator"(_Algorithm):
+		_PartitionEvaluator(_Graph G, _Partition P) except +
+		_PartitionQuality getResult() except +
+
+cdef class PartitionEvaluator(Algorithm):
+	"""
+	PartitionEvaluator(G, P)
+
+	Computes Modularity, Coverage, EdgeCut, conductance, IntrapartitionDensity, HubDominance and
+	PartitionFragmentation of a partition, globally and per cluster, in a single parallel sweep
+	over the edges.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		An undirected graph with at least one edge.
+	P : networkit.Partition
+		The partition that shall be evaluated.
+	"""
+	cdef Graph _G
+	cdef Partition _P
+
+	def __cinit__(self, Graph G not None, Partition P not None):
+		self._G = G
+		self._P = P
+		self._this = new _PartitionEvaluator(G._this, P._this)
+
+	def getResult(self):
+		"""
+		getResult()
+
+		Get the quality measures of the partition. Global values are stored under the names
+		modularity, coverage, edgeCut, conductance (maximum of the clusters),
+		intrapartitionDensity, hubDominance and fragmentation (averages of the clusters), and
+		numberOfClusters. The per-cluster lists are clusterSizes, intraClusterWeights,
+		cutWeights, volumes, conductances, intrapartitionDensities, hubDominances and
+		fragmentations.
+
+		Returns
+		-------
+		dict
+			The quality measures.
+		"""
+		return (<_PartitionEvaluator*>(self._this)).getResult()
+
 cdef extern from "<networkit/community/StablePartitionNodes.hpp>":
 
 	cdef cppclass _StablePartitionNodes "NetworKit::StablePartitionNodes"(_LocalPartitionEvaluation):
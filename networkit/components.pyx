@@ -175,6 +175,31 @@ cdef class ParallelConnectedComponents(ComponentDecomposition):
 	def __cinit__(self,  Graph G, coarsening=True	):
 		self._this = new _ParallelConnectedComponents(G._this, coarsening)
 
+cdef extern from "<networkit/components/AfforestConnectedComponents.hpp>":
+
+	cdef cppclass _AfforestConnectedComponents "NetworKit::AfforestConnectedComponents"(_ComponentDecomposition):
+		_AfforestConnectedComponents(_Graph G, count neighborRounds) except +
+
+cdef class AfforestConnectedComponents(ComponentDecomposition):
+	"""
+	AfforestConnectedComponents(G, neighborRounds=2)
+
+	Determines the connected components of an undirected graph in parallel with
+	the Afforest algorithm (union-find with subgraph sampling). The components
+	are numbered in the same way as by ConnectedComponents.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The input graph.
+	neighborRounds : int, optional
+		Number of neighbors of each node that are linked before the largest
+		intermediate component is sampled. Default: 2
+	"""
+
+	def __cinit__(self, Graph G, count neighborRounds = 2):
+		self._this = new _AfforestConnectedComponents(G._this, neighborRounds)
+
 cdef extern from "<networkit/components/StronglyConnectedComponents.hpp>":
 
 	cdef cppclass _StronglyConnectedComponents "NetworKit::StronglyConnectedComponents"(_ComponentDecomposition):
@@ -195,6 +220,29 @@ cdef class StronglyConnectedComponents(ComponentDecomposition):
 	def __cinit__(self, Graph G):
 		self._this = new _StronglyConnectedComponents(G._this)
 
+cdef extern from "<networkit/components/ParallelStronglyConnectedComponents.hpp>":
+
+	cdef cppclass _ParallelStronglyConnectedComponents "NetworKit::ParallelStronglyConnectedComponents"(_ComponentDecomposition):
+		_ParallelStronglyConnectedComponents(_Graph G) except +
+
+cdef class ParallelStronglyConnectedComponents(ComponentDecomposition):
+	"""
+	ParallelStronglyConnectedComponents(G)
+
+	Computes the strongly connected components of a directed graph in parallel
+	(trimming, forward-backward search and coloring). The partition is the same
+	as the one of StronglyConnectedComponents, the components are numbered by
+	their smallest node.
+
+	Parameters:
+	-----------
+	G : networkit.Graph
+		The input graph.
+	"""
+
+	def __cinit__(self, Graph G):
+		self._this = new _ParallelStronglyConnectedComponents(G._this)
+
 cdef extern from "<networkit/components/WeaklyConnectedComponents.hpp>":
 
 	cdef cppclass _WeaklyConnectedComponents "NetworKit::WeaklyConnectedComponents"(_ComponentDecomposition):
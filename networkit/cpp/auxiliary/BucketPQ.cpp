@@ -9,9 +9,6 @@
 
 namespace Aux {
 
-Bucket BucketPQ::dummyBucket = {};
-const Bucket::iterator BucketPQ::invalidPtr = BucketPQ::dummyBucket.end();
-
 BucketPQ::BucketPQ(const std::vector<int64_t> &keys, int64_t minAdmissibleKey,
                    int64_t maxAdmissibleKey)
     : minAdmissibleKey(minAdmissibleKey), maxAdmissibleKey(maxAdmissibleKey) {
@@ -37,9 +34,10 @@ void BucketPQ::construct(uint64_t capacity) {
     }
 
     // init
-    buckets.resize(maxAdmissibleKey - minAdmissibleKey + 1);
-    nodePtr.resize(capacity);
-    myBucket.resize(capacity);
+    bucketHead.assign(maxAdmissibleKey - minAdmissibleKey + 1, nil);
+    nextInBucket.assign(capacity, nil);
+    prevInBucket.assign(capacity, nil);
+    myBucket.assign(capacity, none);
     currentMinKey = std::numeric_limits<int64_t>::max();
     currentMaxKey = std::numeric_limits<int64_t>::min();
     numElems = 0;
@@ -49,11 +47,17 @@ void BucketPQ::construct(uint64_t capacity) {
 
 void BucketPQ::insert(int64_t key, index value) {
     assert(minAdmissibleKey <= key && key <= maxAdmissibleKey);
-    assert(value < nodePtr.size());
-
-    buckets[key + offset].push_front(value);
-    nodePtr[value] = OptionalIterator{true, buckets[key + offset].begin()};
-    myBucket[value] = key + offset;
+    assert(value < myBucket.size());
+
+    // prepend value to its bucket
+    const index bucket = key + offset;
+    const index head = bucketHead[bucket];
+    prevInBucket[value] = nil;
+    nextInBucket[value] = head;
+    if (head != nil)
+        prevInBucket[head] = value;
+    bucketHead[bucket] = value;
+    myBucket[value] = bucket;
     ++numElems;
 
     // bookkeeping
@@ -66,17 +70,21 @@ void BucketPQ::insert(int64_t key, index value) {
 }
 
 bool BucketPQ::contains(const index &value) const {
-    return value < nodePtr.size() && nodePtr[value].valid;
+    return value < myBucket.size() && myBucket[value] != static_cast<index>(none);
 }
 
 void BucketPQ::remove(const index &value) {
-    assert(value < nodePtr.size());
-
-    if (myBucket[value] != none) {
-        // remove from appropriate bucket
-        index key = myBucket[value];
-        buckets[key].erase(nodePtr[value].iter);
-        nodePtr[value].reset();
+    assert(value < myBucket.size());
+
+    if (myBucket[value] != static_cast<index>(none)) {
+        // unlink from appropriate bucket
+        const index prev = prevInBucket[value], next = nextInBucket[value];
+        if (prev != nil)
+            nextInBucket[prev] = next;
+        else
+            bucketHead[myBucket[value]] = next;
+        if (next != nil)
+            prevInBucket[next] = prev;
         myBucket[value] = none;
         --numElems;
 
@@ -86,12 +94,12 @@ void BucketPQ::remove(const index &value) {
             currentMaxKey = std::numeric_limits<int64_t>::min();
         } else {
             // adjust max pointer if necessary
-            while (buckets[currentMaxKey + offset].empty() && currentMaxKey > currentMinKey) {
+            while (bucketHead[currentMaxKey + offset] == nil && currentMaxKey > currentMinKey) {
                 --currentMaxKey;
             }
 
             // adjust min pointer if necessary
-            while (buckets[currentMinKey + offset].empty() && currentMinKey < currentMaxKey) {
+            while (bucketHead[currentMinKey + offset] == nil && currentMinKey < currentMaxKey) {
                 ++currentMinKey;
             }
         }
@@ -102,7 +110,7 @@ std::pair<int64_t, index> BucketPQ::extractMin() {
     if (empty())
         return {none, none};
 
-    index result = buckets[currentMinKey + offset].front();
+    index result = bucketHead[currentMinKey + offset];
 
     // store currentMinKey because remove(result) will change it
     int64_t oldMinKey = currentMinKey;
@@ -114,7 +122,7 @@ std::pair<int64_t, index> BucketPQ::getMin() {
     if (empty())
         return {none, none};
     else
-        return {currentMinKey, buckets[currentMinKey + offset].front()};
+        return {currentMinKey, bucketHead[currentMinKey + offset]};
 }
 
 void BucketPQ::changeKey(int64_t newKey, index value) {
@@ -0,0 +1,119 @@
+/*
+ * AuxBucketPQBenchmark.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include <networkit/auxiliary/BucketPQ.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/auxiliary/Timer.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+
+namespace NetworKit {
+
+class AuxBucketPQBenchmark : public testing::Test {};
+
+namespace {
+
+// Reference bucket queue with one std::list per bucket, i.e., the layout BucketPQ used to have.
+class ListBucketPQ {
+public:
+    ListBucketPQ(count capacity, int64_t maxKey)
+        : buckets(maxKey + 1), position(capacity), key(capacity, Aux::none) {}
+
+    void insert(int64_t k, index value) {
+        buckets[k].push_front(value);
+        position[value] = buckets[k].begin();
+        key[value] = k;
+        ++size;
+        minKey = std::min(minKey, k);
+    }
+
+    void remove(index value) {
+        buckets[key[value]].erase(position[value]);
+        key[value] = Aux::none;
+        --size;
+    }
+
+    std::pair<int64_t, index> extractMin() {
+        while (buckets[minKey].empty())
+            ++minKey;
+        const index value = buckets[minKey].front();
+        const int64_t k = minKey;
+        remove(value);
+        return {k, value};
+    }
+
+    void changeKey(int64_t newKey, index value) {
+        remove(value);
+        insert(newKey, value);
+    }
+
+    bool empty() const { return size == 0; }
+
+    int64_t getKey(index value) const { return key[value]; }
+
+private:
+    std::vector<std::list<index>> buckets;
+    std::vector<std::list<index>::iterator> position;
+    std::vector<int64_t> key;
+    count size = 0;
+    int64_t minKey = 0;
+};
+
+// Peels the graph by minimum degree, as in a core decomposition; returns a checksum.
+template <class PQ>
+count peel(const Graph &G, PQ &pq) {
+    G.forNodes([&](node u) { pq.insert(static_cast<int64_t>(G.degree(u)), u); });
+
+    std::vector<bool> removed(G.upperNodeIdBound());
+    count checksum = 0;
+    while (!pq.empty()) {
+        const auto [key, u] = pq.extractMin();
+        removed[u] = true;
+        checksum += static_cast<count>(key);
+        G.forNeighborsOf(u, [&](node v) {
+            if (!removed[v] && pq.getKey(v) > 0)
+                pq.changeKey(pq.getKey(v) - 1, v);
+        });
+    }
+    return checksum;
+}
+
+template <class PQ, typename F>
+double measure(const Graph &G, F makePQ, count &checksum) {
+    constexpr int iterations = 5;
+    Aux::Timer timer;
+    timer.start();
+    for (int i = 0; i < iterations; ++i) {
+        PQ pq = makePQ();
+        checksum = peel(G, pq);
+    }
+    timer.stop();
+    return static_cast<double>(timer.elapsedMilliseconds()) / iterations;
+}
+
+} // namespace
+
+TEST_F(AuxBucketPQBenchmark, benchmarkPeeling) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(200000, 20. / 200000).generate();
+    const auto maxKey = static_cast<int64_t>(G.numberOfNodes());
+
+    count arrayChecksum = 0, listChecksum = 0;
+    const double arrayTime = measure<Aux::BucketPQ>(
+        G, [&] { return Aux::BucketPQ(G.upperNodeIdBound(), 0, maxKey); }, arrayChecksum);
+    const double listTime = measure<ListBucketPQ>(
+        G, [&] { return ListBucketPQ(G.upperNodeIdBound(), maxKey); }, listChecksum);
+
+    EXPECT_EQ(arrayChecksum, listChecksum);
+    std::cout << "BucketPQ: " << arrayTime << "ms, std::list buckets: " << listTime << "ms\n";
+}
+
+} // namespace NetworKit
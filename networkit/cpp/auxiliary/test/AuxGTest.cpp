@@ -16,6 +16,7 @@
 #include <chrono>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <set>
@@ -302,6 +303,32 @@ TEST_F(AuxGTest, testBucketPQUpdateRemove) {
     EXPECT_TRUE(prioQ.empty());
 }
 
+TEST_F(AuxGTest, testBucketPQNegativeKeys) {
+    Aux::BucketPQ prioQ(5, -10, 10);
+
+    // changeKey inserts values that are not present
+    prioQ.changeKey(3, 0);
+    prioQ.insert(-10, 1);
+    prioQ.insert(10, 2);
+    prioQ.insert(-10, 3);
+    EXPECT_EQ(prioQ.size(), 4u);
+    EXPECT_FALSE(prioQ.contains(4));
+    prioQ.remove(4); // no-op
+
+    // most recently inserted value of a bucket comes first
+    EXPECT_EQ(prioQ.getMin(), std::make_pair(int64_t{-10}, index{3}));
+    prioQ.remove(3);
+    EXPECT_EQ(prioQ.getMin(), std::make_pair(int64_t{-10}, index{1}));
+    prioQ.changeKey(5, 1);
+    EXPECT_EQ(prioQ.getKey(1), 5);
+
+    EXPECT_EQ(prioQ.extractMin(), std::make_pair(int64_t{3}, index{0}));
+    EXPECT_EQ(prioQ.extractMin(), std::make_pair(int64_t{5}, index{1}));
+    EXPECT_EQ(prioQ.extractMin(), std::make_pair(int64_t{10}, index{2}));
+    EXPECT_TRUE(prioQ.empty());
+    EXPECT_EQ(prioQ.extractMin().first, Aux::none);
+}
+
 TEST_F(AuxGTest, testLogging) {
     std::string cl = Aux::Log::getLogLevel();
     Aux::Log::setLogLevel("ERROR");
@@ -411,6 +438,42 @@ TEST_F(AuxGTest, testSetIntersector) {
     EXPECT_EQ(expectedResult, intersection);
 }
 
+TEST_F(AuxGTest, testSortedIntersection) {
+    Aux::Random::setSeed(42, false);
+    // Similar sizes (merge) and very different sizes (galloping)
+    for (const auto &[na, nb] : {std::pair<uint64_t, uint64_t>{3, 5}, {200, 300}, {5, 1000}}) {
+        std::vector<uint64_t> A, B;
+        for (uint64_t i = 0; i < na; ++i)
+            A.push_back(Aux::Random::integer(2 * nb));
+        for (uint64_t i = 0; i < nb; ++i)
+            B.push_back(Aux::Random::integer(2 * nb));
+        for (auto *V : {&A, &B}) {
+            std::sort(V->begin(), V->end());
+            V->erase(std::unique(V->begin(), V->end()), V->end());
+        }
+
+        std::vector<uint64_t> expected;
+        std::set_intersection(A.begin(), A.end(), B.begin(), B.end(),
+                              std::back_inserter(expected));
+
+        for (const bool swapped : {false, true}) {
+            const auto &first = swapped ? B : A;
+            const auto &second = swapped ? A : B;
+            std::vector<uint64_t> result;
+            Aux::forSortedIntersection(first.data(), first.size(), second.data(), second.size(),
+                                       [&](size_t i, size_t j) {
+                                           EXPECT_EQ(first[i], second[j]);
+                                           result.push_back(first[i]);
+                                       });
+            std::sort(result.begin(), result.end());
+            EXPECT_EQ(result, expected);
+            EXPECT_EQ(Aux::sortedIntersectionSize(first.data(), first.size(), second.data(),
+                                                  second.size()),
+                      expected.size());
+        }
+    }
+}
+
 TEST_F(AuxGTest, testEnforce) {
     EXPECT_THROW(Aux::enforce(false), std::runtime_error);
     EXPECT_NO_THROW(Aux::enforce(true));
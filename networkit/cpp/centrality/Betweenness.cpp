@@ -5,82 +5,260 @@
  *      Author: cls, ebergamini
  */
 
-#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
 #include <omp.h>
 
-#include <networkit/auxiliary/Log.hpp>
+#include <tlx/container/d_ary_addressable_int_heap.hpp>
+
 #include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/auxiliary/VectorComparator.hpp>
 #include <networkit/centrality/Betweenness.hpp>
-#include <networkit/distance/BFS.hpp>
-#include <networkit/distance/Dijkstra.hpp>
 
 namespace NetworKit {
 
-Betweenness::Betweenness(const Graph &G, bool normalized, bool computeEdgeCentrality)
-    : Centrality(G, normalized, computeEdgeCentrality) {}
+namespace {
+
+// Buffer size per thread for the contributions of a batch of sources if there is no budget
+constexpr count defaultBufferBytes = count{1} << 26;
+
+// Contributions to the node or edge scores; bucket i holds the contributions to the i-th range
+// of ids, which are merged into the scores by thread i.
+using Contributions = std::vector<std::vector<std::pair<index, double>>>;
+
+// Per-thread state of Brandes' algorithm. Only the positions are indexed by node id; distances,
+// path counts and dependencies are stored compactly for the visited nodes, which are numbered in
+// order of discovery. All state is reset after each source.
+class BrandesWorker {
+public:
+    BrandesWorker(const Graph &G, count buckets)
+        : G(&G), buckets(buckets), position(G.upperNodeIdBound(), none),
+          heap(Aux::LessInVector<double>{distance}) {}
+
+    // Bytes needed per worker if all nodes are visited
+    static count memoryPerWorker(const Graph &G) {
+        const count perNode = sizeof(index) + sizeof(node) + 3 * sizeof(double) + sizeof(index)
+                              + (G.isWeighted() ? 2 * sizeof(index) : 0);
+        return G.upperNodeIdBound() * perNode;
+    }
+
+    // Appends the dependencies of the nodes (and edges, if edgeScores is not null) on s to the
+    // contributions.
+    void addDependencies(node s, Contributions &nodeScores, Contributions *edgeScores);
+
+private:
+    const Graph *G;
+    const count buckets;
+    // Position of each visited node, none for the other nodes
+    std::vector<index> position;
+    // The visited nodes by position
+    std::vector<node> visited;
+    std::vector<double> distance, sigma, dependency;
+    // Positions in order of non-decreasing distance
+    std::vector<index> order;
+    tlx::d_ary_addressable_int_heap<index, 2, Aux::LessInVector<double>> heap;
+
+    index visit(node v, double dist) {
+        const index pos = visited.size();
+        position[v] = pos;
+        visited.push_back(v);
+        distance.push_back(dist);
+        sigma.push_back(0.);
+        dependency.push_back(0.);
+        return pos;
+    }
+
+    index bucketOf(index id, count bound) const { return id * buckets / bound; }
+
+    void bfs();
+    void dijkstra();
+    void logPathCounts();
+};
+
+void BrandesWorker::bfs() {
+    for (index pu = 0; pu < visited.size(); ++pu) {
+        const double newDist = distance[pu] + 1.;
+        G->forNeighborsOf(visited[pu], [&](const node v) {
+            index pv = position[v];
+            if (pv == none)
+                pv = visit(v, newDist);
+            if (distance[pv] == newDist)
+                sigma[pv] += sigma[pu];
+        });
+    }
+    order.resize(visited.size());
+    std::iota(order.begin(), order.end(), 0);
+}
+
+void BrandesWorker::dijkstra() {
+    order.clear();
+    heap.push(0);
+    while (!heap.empty()) {
+        const index pu = heap.extract_top();
+        order.push_back(pu);
+        G->forNeighborsOf(visited[pu], [&](const node v, const edgeweight w) {
+            const double newDist = distance[pu] + w;
+            index pv = position[v];
+            if (pv == none) {
+                pv = visit(v, newDist);
+                sigma[pv] = sigma[pu];
+                heap.push(pv);
+            } else if (distance[pv] > newDist) {
+                distance[pv] = newDist;
+                sigma[pv] = sigma[pu];
+                heap.update(pv);
+            } else if (distance[pv] == newDist) {
+                sigma[pv] += sigma[pu];
+            }
+        });
+    }
+}
+
+// Recomputes the path counts as natural logarithms, for sources from which the number of
+// shortest paths exceeds the range of double.
+void BrandesWorker::logPathCounts() {
+    sigma[order.front()] = 0.;
+    for (index i = 1; i < order.size(); ++i) {
+        const index pt = order[i];
+        const double dt = distance[pt];
+        double maxLog = -std::numeric_limits<double>::infinity();
+        G->forInNeighborsOf(visited[pt], [&](const node p, const edgeweight w) {
+            const index pp = position[p];
+            if (pp != none && distance[pp] + w == dt)
+                maxLog = std::max(maxLog, sigma[pp]);
+        });
+        double sum = 0.;
+        G->forInNeighborsOf(visited[pt], [&](const node p, const edgeweight w) {
+            const index pp = position[p];
+            if (pp != none && distance[pp] + w == dt)
+                sum += std::exp(sigma[pp] - maxLog);
+        });
+        sigma[pt] = maxLog + std::log(sum);
+    }
+}
+
+void BrandesWorker::addDependencies(node s, Contributions &nodeScores,
+                                    Contributions *edgeScores) {
+    visit(s, 0.);
+    sigma[0] = 1.;
+    if (G->isWeighted())
+        dijkstra();
+    else
+        bfs();
+
+    const bool logSpace =
+        std::any_of(sigma.begin(), sigma.end(), [](double x) { return std::isinf(x); });
+    if (logSpace)
+        logPathCounts();
+
+    // Accumulate the dependencies in order of decreasing distance; the predecessors p of t are
+    // the in-neighbors with distance(p) + w(p, t) == distance(t).
+    const count z = G->upperNodeIdBound();
+    const count omega = G->upperEdgeIdBound();
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        const index pt = *it;
+        const node t = visited[pt];
+        const double dt = distance[pt];
+        G->forInEdgesOf(t, [&](node, const node p, const edgeweight w, const edgeid eid) {
+            const index pp = position[p];
+            if (pp == none || distance[pp] + w != dt)
+                return;
+            const double ratio =
+                logSpace ? std::exp(sigma[pp] - sigma[pt]) : sigma[pp] / sigma[pt];
+            const double c = ratio * (1 + dependency[pt]);
+            dependency[pp] += c;
+            if (edgeScores)
+                (*edgeScores)[bucketOf(eid, omega)].emplace_back(eid, c);
+        });
+        if (t != s)
+            nodeScores[bucketOf(t, z)].emplace_back(t, dependency[pt]);
+    }
+
+    for (const node u : visited)
+        position[u] = none;
+    visited.clear();
+    distance.clear();
+    sigma.clear();
+    dependency.clear();
+}
+
+} // namespace
+
+Betweenness::Betweenness(const Graph &G, bool normalized, bool computeEdgeCentrality,
+                         count memoryBudget)
+    : Centrality(G, normalized, computeEdgeCentrality), memoryBudget(memoryBudget) {}
+
+count Betweenness::sourcesPerBatch() const {
+    const auto threads = static_cast<count>(omp_get_max_threads());
+    // Upper bound on the size of the contributions of one source
+    const count perSource =
+        (G.numberOfNodes() + (computeEdgeCentrality ? G.numberOfEdges() : 0))
+        * sizeof(std::pair<index, double>);
+
+    count bufferBytes = threads * defaultBufferBytes;
+    if (memoryBudget) {
+        const count workers = threads * BrandesWorker::memoryPerWorker(G);
+        bufferBytes = memoryBudget > workers ? memoryBudget - workers : 0;
+    }
+
+    const count batch = std::max(threads, bufferBytes / std::max<count>(perSource, 1));
+    return std::min(batch, std::max<count>(G.upperNodeIdBound(), 1));
+}
 
 void Betweenness::run() {
     Aux::SignalHandler handler;
     const count z = G.upperNodeIdBound();
-    scoreData.clear();
-    scoreData.resize(z);
-    if (computeEdgeCentrality) {
-        count z2 = G.upperEdgeIdBound();
-        edgeScoreData.clear();
-        edgeScoreData.resize(z2);
-    }
+    const count batchSize = sourcesPerBatch();
+    scoreData.assign(z, 0.0);
+    edgeScoreData.assign(computeEdgeCentrality ? G.upperEdgeIdBound() : 0, 0.0);
+
+    // nodeContributions[i][j]: contributions of thread i that thread j merges into the scores
+    std::vector<Contributions> nodeContributions, edgeContributions;
 
-    std::vector<std::vector<double>> dependencies(omp_get_max_threads(), std::vector<double>(z));
-    std::vector<std::unique_ptr<SSSP>> sssps;
-    sssps.resize(omp_get_max_threads());
 #pragma omp parallel
     {
-        omp_index i = omp_get_thread_num();
-        if (G.isWeighted())
-            sssps[i] = std::unique_ptr<SSSP>(new Dijkstra(G, 0, true, true));
-        else
-            sssps[i] = std::unique_ptr<SSSP>(new BFS(G, 0, true, true));
-    }
+        const auto numThreads = static_cast<count>(omp_get_num_threads());
+        const auto tid = static_cast<index>(omp_get_thread_num());
+#pragma omp single
+        {
+            nodeContributions.assign(numThreads, Contributions(numThreads));
+            if (computeEdgeCentrality)
+                edgeContributions.assign(numThreads, Contributions(numThreads));
+        }
+
+        BrandesWorker worker(G, numThreads);
+        auto *edges = computeEdgeCentrality ? &edgeContributions[tid] : nullptr;
 
-    auto computeDependencies = [&](node s) -> void {
-        std::vector<double> &dependency = dependencies[omp_get_thread_num()];
-        std::fill(dependency.begin(), dependency.end(), 0);
-
-        // run SSSP algorithm and keep track of everything
-        auto &sssp = *sssps[omp_get_thread_num()];
-        sssp.setSource(s);
-        if (!handler.isRunning())
-            return;
-        sssp.run();
-        if (!handler.isRunning())
-            return;
-        // compute dependencies for nodes in order of decreasing distance from s
-        std::vector<node> stack = sssp.getNodesSortedByDistance();
-        while (!stack.empty()) {
-            node t = stack.back();
-            stack.pop_back();
-            for (node p : sssp.getPredecessors(t)) {
-                // workaround for integer overflow in large graphs
-                bigfloat tmp = sssp.numberOfPaths(p) / sssp.numberOfPaths(t);
-                double weight;
-                tmp.ToDouble(weight);
-                double c = weight * (1 + dependency[t]);
-                dependency[p] += c;
-
-                if (computeEdgeCentrality) {
-                    const edgeid edgeId = G.edgeId(p, t);
-#pragma omp atomic
-                    edgeScoreData[edgeId] += c;
-                }
+        for (node begin = 0; begin < z; begin += batchSize) {
+            const node end = std::min(z, begin + batchSize);
+#pragma omp for schedule(dynamic)
+            for (omp_index s = static_cast<omp_index>(begin); s < static_cast<omp_index>(end);
+                 ++s) {
+                if (G.hasNode(s) && handler.isRunning())
+                    worker.addDependencies(s, nodeContributions[tid], edges);
             }
 
-            if (t != s)
-#pragma omp atomic
-                scoreData[t] += dependency[t];
+            // Each thread merges the contributions to its range of ids, so no atomics are needed.
+            for (const auto &contributions : nodeContributions) {
+                for (const auto &[u, c] : contributions[tid])
+                    scoreData[u] += c;
+            }
+            for (const auto &contributions : edgeContributions) {
+                for (const auto &[eid, c] : contributions[tid])
+                    edgeScoreData[eid] += c;
+            }
+#pragma omp barrier
+
+            for (auto &bucket : nodeContributions[tid])
+                bucket.clear();
+            if (edges) {
+                for (auto &bucket : *edges)
+                    bucket.clear();
+            }
         }
-    };
-    handler.assureRunning();
-    G.balancedParallelForNodes(computeDependencies);
+    }
     handler.assureRunning();
 
     if (normalized) {
@@ -6,12 +6,13 @@
  *              Eugenio Angriman <angrimae@hu-berlin.de>
  */
 
+#include <array>
 #include <omp.h>
-#include <queue>
 
 #include <networkit/centrality/Closeness.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
 #include <networkit/components/StronglyConnectedComponents.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 
 namespace NetworKit {
 
@@ -51,12 +52,12 @@ void Closeness::run() {
 
     scoreData.clear();
     scoreData.resize(n);
-    visited.clear();
-    visited.resize(omp_get_max_threads(), std::vector<uint8_t>(n));
-    ts.clear();
-    ts.resize(omp_get_max_threads(), 0);
 
     if (G.isWeighted()) {
+        visited.clear();
+        visited.resize(omp_get_max_threads(), std::vector<uint8_t>(n));
+        ts.clear();
+        ts.resize(omp_get_max_threads(), 0);
         dDist.resize(omp_get_max_threads(), std::vector<double>(n));
         heaps.reserve(omp_get_max_threads());
         for (int i = 0; i < omp_get_max_threads(); ++i) {
@@ -65,7 +66,6 @@ void Closeness::run() {
         }
         dijkstra();
     } else {
-        uDist.resize(omp_get_max_threads(), std::vector<count>(n));
         bfs();
     }
 
@@ -73,41 +73,21 @@ void Closeness::run() {
 }
 
 void Closeness::bfs() {
-#pragma omp parallel for schedule(dynamic)
-    for (omp_index u = 0; u < static_cast<omp_index>(G.upperNodeIdBound()); ++u) {
-        uint8_t &ts_ = ts[omp_get_thread_num()];
-        auto &dist_ = uDist[omp_get_thread_num()];
-        auto &visited_ = visited[omp_get_thread_num()];
-
-        if (ts_++ == 255 && variant != ClosenessVariant::STANDARD) {
-            ts_ = 1;
-            std::fill(visited_.begin(), visited_.end(), 0);
-        }
-
-        std::queue<node> q;
-        q.push(u);
-        dist_[u] = 0;
-        visited_[u] = ts_;
-        double sum = 0.;
-        count reached = 1;
-
-        do {
-            node x = q.front();
-            q.pop();
-            G.forNeighborsOf(x, [&](node y) {
-                if (visited_[y] != ts_) {
-                    visited_[y] = ts_;
-                    dist_[y] = dist_[x] + 1;
-                    sum += dist_[y];
-                    ++reached;
-                    q.push(y);
-                }
-            });
-
-        } while (!q.empty());
-
-        updateScoreData(u, reached, sum);
-    }
+    using MSBFS = MultiSourceBFS<>;
+    MSBFS::forNodeBatches(G, [&](MSBFS &msbfs, const std::vector<node> &sources) {
+        std::array<double, MSBFS::width> sum{};
+        std::array<count, MSBFS::width> reached{};
+        msbfs.run(sources.begin(), sources.end(),
+                  [&](node, const MSBFS::Bitset &bits, count dist) {
+                      MSBFS::forBits(bits, [&](index i) {
+                          sum[i] += static_cast<double>(dist);
+                          ++reached[i];
+                      });
+                  });
+
+        for (index i = 0; i < sources.size(); ++i)
+            updateScoreData(sources[i], reached[i], sum[i]);
+    });
 }
 
 void Closeness::dijkstra() {
@@ -6,8 +6,9 @@
  *  Inplace change on Jun 26, 2015 by Henning Meyerhenke
  */
 
+#include <algorithm>
+#include <atomic>
 #include <omp.h>
-#include <set>
 
 #include <networkit/centrality/CoreDecomposition.hpp>
 #include <networkit/centrality/DegreeCentrality.hpp>
@@ -23,15 +24,14 @@ CoreDecomposition::CoreDecomposition(const Graph &G, bool normalized,
                                  "self-loops. Call Graph.removeSelfLoops() first.");
     if (storeNodeOrder)
         this->enforceBucketQueueAlgorithm = true;
-    canRunInParallel =
-        (!enforceBucketQueueAlgorithm && (G.numberOfNodes() == G.upperNodeIdBound()));
+    canRunInParallel = !this->enforceBucketQueueAlgorithm;
 }
 
 void CoreDecomposition::run() {
     if (G.isDirected() || enforceBucketQueueAlgorithm) {
         runWithBucketQueues();
     } else {
-        runWithParK();
+        runWithParallelBuckets();
     }
 
     if (normalized) {
@@ -43,137 +43,92 @@ void CoreDecomposition::run() {
     }
 }
 
-void CoreDecomposition::runWithParK() {
-    count z = G.upperNodeIdBound();
-    scoreData.resize(z); // TODO: move to base class
-
-    count nUnprocessed = G.numberOfNodes();
-    std::vector<node> curr; // currently processed nodes
-    std::vector<node> next; // nodes to be processed next
-    std::vector<char> active(z, 0);
-    index level = 0; // current level
-    count size = 0;  // number of nodes currently processed
-
-    // fill in degrees
-    std::vector<count> degrees(z);
-    G.parallelForNodes([&](node u) {
-        degrees[u] = G.degree(u);
-        active[u] = 1;
+void CoreDecomposition::runWithParallelBuckets() {
+    const count z = G.upperNodeIdBound();
+    scoreData.assign(z, 0);
+
+    // Remaining degree of each node; it never drops below the current level, so the nodes of
+    // the current and earlier levels are never modified again.
+    std::vector<std::atomic<count>> degrees(z);
+    count maxDegree = 0;
+    G.forNodes([&](node u) {
+        degrees[u].store(G.degree(u), std::memory_order_relaxed);
+        maxDegree = std::max(maxDegree, G.degree(u));
     });
 
-    // main loop
-    while (nUnprocessed > 0) {
-        // find nodes with degree == current level
-        if (!canRunInParallel || z <= 256) {
-            scan(level, degrees, curr);
-        } else {
-            scanParallel(level, degrees, curr, active);
+    // Bucket d holds the nodes that had remaining degree d at some point; entries are not
+    // removed when the degree of a node decreases, instead they are skipped later.
+    std::vector<std::vector<node>> buckets(maxDegree + 1);
+    G.forNodes([&](node u) { buckets[G.degree(u)].push_back(u); });
+
+    std::vector<std::atomic<uint8_t>> touched(z);
+    std::vector<std::vector<node>> localNext(omp_get_max_threads()),
+        localTouched(omp_get_max_threads());
+    std::vector<node> curr, next;
+
+    auto gather = [](std::vector<std::vector<node>> &local, std::vector<node> &out) {
+        out.clear();
+        for (auto &nodes : local) {
+            out.insert(out.end(), nodes.begin(), nodes.end());
+            nodes.clear();
         }
-
-        // process such nodes in curr
-        size = curr.size();
-        while (size > 0) {
-            nUnprocessed -= size;
-#ifndef NETWORKIT_OMP2
-            if (!canRunInParallel || size <= 256) {
-                processSublevel(level, degrees, curr, next);
-            } else {
-                processSublevelParallel(level, degrees, curr, next, active);
+    };
+
+    for (index level = 0; level <= maxDegree; ++level) {
+        if (buckets[level].empty())
+            continue;
+        curr = std::move(buckets[level]);
+        bool firstRound = true;
+
+        // Peel the nodes with remaining degree level; the neighbors whose degree drops to level
+        // are peeled in the next sub-round.
+        while (!curr.empty()) {
+#pragma omp parallel if (canRunInParallel && curr.size() > 256)
+            {
+                const auto tid = omp_get_thread_num();
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(curr.size()); ++i) {
+                    const node u = curr[i];
+                    if (firstRound && degrees[u].load(std::memory_order_relaxed) != level)
+                        continue; // outdated bucket entry
+                    scoreData[u] = static_cast<double>(level);
+                    G.forNeighborsOf(u, [&](node v) {
+                        count deg = degrees[v].load(std::memory_order_relaxed);
+                        while (deg > level
+                               && !degrees[v].compare_exchange_weak(deg, deg - 1,
+                                                                    std::memory_order_relaxed)) {
+                        }
+                        if (deg <= level)
+                            return;
+                        if (deg - 1 == level)
+                            localNext[tid].push_back(v);
+                        else if (!touched[v].exchange(1, std::memory_order_relaxed))
+                            localTouched[tid].push_back(v);
+                    });
+                }
             }
-#else
-            processSublevel(level, degrees, curr, next);
-#endif
+            gather(localNext, next);
             std::swap(curr, next);
-            size = curr.size();
-            next.clear();
+            firstRound = false;
         }
-        ++level;
-    }
-
-    maxCore = level - 1;
-    hasRun = true;
-}
 
-void CoreDecomposition::scan(index level, const std::vector<count> &degrees,
-                             std::vector<node> &curr) {
-    G.forNodes([&](node u) {
-        if (degrees[u] == level) {
-            curr.push_back(u);
+        // Move the neighbors whose degree decreased, but not to level, to their new bucket.
+        gather(localTouched, next);
+        for (const node v : next) {
+            touched[v].store(0, std::memory_order_relaxed);
+            const count deg = degrees[v].load(std::memory_order_relaxed);
+            if (deg > level)
+                buckets[deg].push_back(v);
         }
-    });
-}
-
-void CoreDecomposition::scanParallel(index level, const std::vector<count> &degrees,
-                                     std::vector<node> &curr, std::vector<char> &active) {
-    const count z = G.upperNodeIdBound();
-    std::vector<std::vector<node>> next(omp_get_max_threads());
-    curr.clear();
-
-#pragma omp parallel for schedule(guided)
-    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
-        if (active[u] && degrees[u] == level) {
-            auto tid = omp_get_thread_num();
-            next[tid].push_back(u);
-        }
-    }
-    for (auto &n : next) {
-        curr.insert(curr.end(), n.begin(), n.end());
     }
-}
 
-void CoreDecomposition::processSublevel(index level, std::vector<count> &degrees,
-                                        const std::vector<node> &curr, std::vector<node> &next) {
-    // check for each neighbor of vertices in curr if their updated degree reaches level;
-    // if so, process them next
-    for (auto u : curr) {
-        scoreData[u] = level;
-        G.forNeighborsOf(u, [&](node v) {
-            if (degrees[v] > level) {
-                degrees[v]--;
-                if (degrees[v] == level) {
-                    next.push_back(v);
-                }
-            }
-        });
-    }
-}
-
-#ifndef NETWORKIT_OMP2
-void CoreDecomposition::processSublevelParallel(index level, std::vector<count> &degrees,
-                                                const std::vector<node> &curr,
-                                                std::vector<node> &next,
-                                                std::vector<char> &active) {
-    // check for each neighbor of vertices in curr if their updated degree reaches level;
-    // if so, process them next
-
-    const count size = curr.size();
-    std::vector<std::vector<node>> localNext(omp_get_max_threads());
-
-#pragma omp parallel for schedule(guided)
-    for (omp_index i = 0; i < static_cast<omp_index>(size); ++i) {
-        node u = curr[i];
-        active[u] = 0;
-        scoreData[u] = level;
-        G.forNeighborsOf(u, [&](node v) {
-            if (degrees[v] > level) {
-                index tmp;
-
-#pragma omp atomic capture
-                tmp = --degrees[v];
-
-                // ensure that neighbor is inserted exactly once if necessary
-                if (tmp == level) { // error in external publication on ParK fixed here
-                    auto tid = omp_get_thread_num();
-                    localNext[tid].push_back(v);
-                }
-            }
-        });
-    }
-    for (auto &n : localNext) {
-        next.insert(next.end(), n.begin(), n.end());
-    }
+    // The last non-empty bucket may only contain outdated entries.
+    maxCore = 0;
+#pragma omp parallel for reduction(max : maxCore)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        maxCore = std::max(maxCore, static_cast<index>(scoreData[u]));
+    hasRun = true;
 }
-#endif // NETWORKIT_OMP2
 
 void CoreDecomposition::runWithBucketQueues() {
     /* Main data structure: buckets of nodes indexed by their remaining degree. */
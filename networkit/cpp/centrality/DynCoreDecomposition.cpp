@@ -0,0 +1,199 @@
+/*
+ * DynCoreDecomposition.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+
+#include <networkit/centrality/CoreDecomposition.hpp>
+#include <networkit/centrality/DynCoreDecomposition.hpp>
+
+namespace NetworKit {
+
+DynCoreDecomposition::DynCoreDecomposition(const Graph &G) : Centrality(G) {
+    if (G.isDirected())
+        throw std::runtime_error("DynCoreDecomposition only supports undirected graphs.");
+    if (G.numberOfSelfLoops())
+        throw std::runtime_error("Core Decomposition implementation does not support graphs with "
+                                 "self-loops. Call Graph.removeSelfLoops() first.");
+}
+
+void DynCoreDecomposition::run() {
+    CoreDecomposition coreDec(G);
+    coreDec.run();
+    scoreData = coreDec.scores();
+
+    const count z = G.upperNodeIdBound();
+    core.assign(z, 0);
+    G.parallelForNodes([&](node u) { core[u] = static_cast<count>(scoreData[u]); });
+    state.assign(z, State::UNSEEN);
+    support.assign(z, 0);
+    inQueue.assign(z, 0);
+    hasRun = true;
+}
+
+void DynCoreDecomposition::updateBatch(const std::vector<GraphEvent> &batch) {
+    assureFinished();
+
+    const count z = G.upperNodeIdBound();
+    if (z > core.size()) {
+        core.resize(z, 0);
+        scoreData.resize(z, 0.0);
+        state.resize(z, State::UNSEEN);
+        support.resize(z, 0);
+        inQueue.resize(z, 0);
+    }
+
+    // The removals are handled first, without the inserted edges.
+    std::vector<node> queue;
+    std::vector<std::pair<node, node>> insertions;
+    auto enqueue = [&](node u) {
+        if (G.hasNode(u) && !inQueue[u]) {
+            inQueue[u] = 1;
+            queue.push_back(u);
+        }
+    };
+    for (const auto &e : batch) {
+        switch (e.type) {
+        case GraphEvent::EDGE_ADDITION:
+            if (e.u == e.v)
+                throw std::runtime_error("DynCoreDecomposition does not support self-loops.");
+            if (G.hasEdge(e.u, e.v) && pending.insert(edgeKey(e.u, e.v)).second)
+                insertions.emplace_back(e.u, e.v);
+            break;
+        case GraphEvent::EDGE_REMOVAL:
+            enqueue(e.u);
+            enqueue(e.v);
+            break;
+        case GraphEvent::NODE_ADDITION:
+        case GraphEvent::NODE_REMOVAL:
+        case GraphEvent::NODE_RESTORATION:
+            core[e.u] = 0;
+            scoreData[e.u] = 0.0;
+            break;
+        case GraphEvent::EDGE_WEIGHT_UPDATE:
+        case GraphEvent::EDGE_WEIGHT_INCREMENT:
+            break;
+        default:
+            throw std::runtime_error("Event type not allowed.");
+        }
+    }
+
+    decreaseCores(queue);
+    for (const auto &[u, v] : insertions) {
+        pending.erase(edgeKey(u, v));
+        insertEdge(u, v);
+    }
+}
+
+void DynCoreDecomposition::decreaseCores(std::vector<node> &queue) {
+    while (!queue.empty()) {
+        const node u = queue.back();
+        queue.pop_back();
+        inQueue[u] = 0;
+
+        // Largest h <= core(u) such that u has at least h neighbors with core number >= h
+        const count k = core[u];
+        if (k == 0)
+            continue;
+        histogram.assign(k + 1, 0);
+        forProcessedNeighborsOf(u, [&](node v) { ++histogram[std::min(core[v], k)]; });
+        count h = k, atLeast = histogram[k];
+        while (atLeast < h) {
+            --h;
+            atLeast += histogram[h];
+        }
+        if (h == k)
+            continue;
+
+        core[u] = h;
+        scoreData[u] = static_cast<double>(h);
+        // Only neighbors with h < core(v) <= k counted u towards their core number.
+        forProcessedNeighborsOf(u, [&](node v) {
+            if (core[v] > h && core[v] <= k && !inQueue[v]) {
+                inQueue[v] = 1;
+                queue.push_back(v);
+            }
+        });
+    }
+}
+
+void DynCoreDecomposition::insertEdge(node u, node v) {
+    const count k = std::min(core[u], core[v]);
+
+    // Collect the candidates: nodes with core number k reachable from the new edge that have
+    // more than k neighbors with core number >= k.
+    auto visit = [&](node w) {
+        seen.push_back(w);
+        count atLeastK = 0;
+        forProcessedNeighborsOf(w, [&](node x) { atLeastK += core[x] >= k; });
+        if (atLeastK > k) {
+            state[w] = State::CANDIDATE;
+            stack.push_back(w);
+        } else {
+            state[w] = State::REJECTED;
+        }
+    };
+    for (const node r : {u, v})
+        if (core[r] == k && state[r] == State::UNSEEN)
+            visit(r);
+    std::vector<node> candidates;
+    while (!stack.empty()) {
+        const node w = stack.back();
+        stack.pop_back();
+        candidates.push_back(w);
+        forProcessedNeighborsOf(w, [&](node x) {
+            if (core[x] == k && state[x] == State::UNSEEN)
+                visit(x);
+        });
+    }
+
+    // Evict candidates with at most k neighbors that have a larger core number or are
+    // candidates themselves.
+    for (const node w : candidates) {
+        count s = 0;
+        forProcessedNeighborsOf(
+            w, [&](node x) { s += core[x] > k || state[x] == State::CANDIDATE; });
+        support[w] = s;
+    }
+    for (const node w : candidates) {
+        if (support[w] <= k) {
+            state[w] = State::EVICTED;
+            stack.push_back(w);
+        }
+    }
+    while (!stack.empty()) {
+        const node w = stack.back();
+        stack.pop_back();
+        forProcessedNeighborsOf(w, [&](node x) {
+            if (state[x] == State::CANDIDATE && --support[x] == k) {
+                state[x] = State::EVICTED;
+                stack.push_back(x);
+            }
+        });
+    }
+
+    for (const node w : candidates) {
+        if (state[w] == State::CANDIDATE) {
+            core[w] = k + 1;
+            scoreData[w] = static_cast<double>(k + 1);
+        }
+    }
+    for (const node w : seen)
+        state[w] = State::UNSEEN;
+    seen.clear();
+}
+
+index DynCoreDecomposition::maxCoreNumber() const {
+    assureFinished();
+    index maxCore = 0;
+    G.forNodes([&](node u) { maxCore = std::max(maxCore, core[u]); });
+    return maxCore;
+}
+
+double DynCoreDecomposition::maximum() {
+    return static_cast<double>(G.numberOfNodes() - 1);
+}
+
+} // namespace NetworKit
@@ -0,0 +1,205 @@
+/*
+ * DynPageRank.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/centrality/DynPageRank.hpp>
+
+namespace NetworKit {
+
+DynPageRank::DynPageRank(const Graph &G, double damp, double tol)
+    : Centrality(G), damp(damp), tol(tol) {
+    if (damp <= 0 || damp >= 1)
+        throw std::runtime_error("Error, the damping factor must be in (0, 1)");
+}
+
+double DynPageRank::exactResidual(node u) const {
+    double sum = 0.0;
+    G.forInEdgesOf(u, [&](node, const node v, const edgeweight w) {
+        sum += estimate[v] * invDeg[v] * w;
+    });
+    return (1.0 - damp) / static_cast<double>(n) - estimate[u] + damp * sum;
+}
+
+void DynPageRank::setResidual(node u, double value) {
+    if (!isChanged[u]) {
+        isChanged[u] = true;
+        changed.push_back(u);
+        changedOldSum += summand(residual[u]);
+        changedSum += summand(value);
+    } else {
+        changedSum += summand(value) - summand(residual[u]);
+    }
+    residual[u] = value;
+    if (std::abs(value) >= threshold && !inQueue[u]) {
+        inQueue[u] = true;
+        queue.push(u);
+    }
+}
+
+void DynPageRank::run() {
+    Aux::SignalHandler handler;
+    const count z = G.upperNodeIdBound();
+    n = G.numberOfNodes();
+
+    invDeg.assign(z, 0.0);
+    G.parallelForNodes([&](const node u) {
+        const auto deg = G.weightedDegree(u);
+        if (deg != 0)
+            invDeg[u] = 1.0 / deg;
+    });
+
+    // Power iterations, x + r is the next iterate.
+    estimate.assign(z, 0.0);
+    residual.assign(z, 0.0);
+    G.parallelForNodes([&](const node u) { estimate[u] = 1.0 / static_cast<double>(n); });
+    const double budget = summand(tol);
+    while (true) {
+        handler.assureRunning();
+        G.balancedParallelForNodes([&](const node u) { residual[u] = exactResidual(u); });
+        residualSum = G.parallelSumForNodes([&](const node u) { return summand(residual[u]); });
+        if (residualSum <= budget)
+            break;
+        G.parallelForNodes([&](const node u) { estimate[u] += residual[u]; });
+    }
+    estimateSum = G.parallelSumForNodes([&](const node u) { return estimate[u]; });
+
+    isChanged.assign(z, false);
+    inQueue.assign(z, false);
+    pushes = 0;
+
+    scoreData.resize(z);
+    updateScores();
+    hasRun = true;
+}
+
+void DynPageRank::updateBatch(const std::vector<GraphEvent> &batch) {
+    assureFinished();
+    if (G.numberOfNodes() != n || G.upperNodeIdBound() != estimate.size())
+        throw std::runtime_error("Error, DynPageRank does not support changes of the node set");
+
+    // Nodes whose out-edges changed, and the heads of removed edges, which are no longer
+    // reachable from them.
+    std::vector<node> sources, affected;
+    std::vector<bool> marked(G.upperNodeIdBound(), false);
+    auto mark = [&](std::vector<node> &nodes, node u) {
+        if (!marked[u]) {
+            marked[u] = true;
+            nodes.push_back(u);
+        }
+    };
+    for (const auto &e : batch) {
+        if (e.type != GraphEvent::EDGE_ADDITION && e.type != GraphEvent::EDGE_REMOVAL
+            && e.type != GraphEvent::EDGE_WEIGHT_UPDATE
+            && e.type != GraphEvent::EDGE_WEIGHT_INCREMENT)
+            throw std::runtime_error("Event type not allowed. Edge events only.");
+        mark(sources, e.u);
+        if (!G.isDirected())
+            mark(sources, e.v);
+    }
+    affected = sources;
+    for (const auto &e : batch)
+        if (e.type == GraphEvent::EDGE_REMOVAL)
+            mark(affected, e.v);
+
+    for (const node s : sources) {
+        const auto deg = G.weightedDegree(s);
+        invDeg[s] = deg != 0 ? 1.0 / deg : 0.0;
+        G.forNeighborsOf(s, [&](const node v) { mark(affected, v); });
+    }
+
+    // The residuals of all other nodes are unchanged.
+    threshold = std::numeric_limits<double>::infinity();
+    changedSum = changedOldSum = 0.0;
+    for (const node u : affected)
+        setResidual(u, exactResidual(u));
+
+    // The sum over the changed nodes is maintained incrementally, but it is recomputed before
+    // deciding to stop, since the budget may be far below the rounding error of the updates.
+    const double budget = summand(tol);
+    auto withinBudget = [&]() -> bool {
+        changedSum = 0.0;
+        for (const node u : changed)
+            changedSum += summand(residual[u]);
+        return residualSum - changedOldSum + changedSum <= budget;
+    };
+
+    // Approximate Gauss-Southwell: push the residuals that are at least the threshold, and
+    // halve the threshold whenever there are none left. Only residuals that changed during this
+    // update are pushed; the others were within the budget before.
+    pushes = 0;
+    bool checked = false;
+    while (true) {
+        if (!checked && residualSum - changedOldSum + changedSum <= budget) {
+            if (withinBudget())
+                break;
+            checked = true;
+        }
+
+        if (queue.empty()) {
+            if (withinBudget())
+                break;
+            double maxResidual = 0.0;
+            for (const node u : changed)
+                maxResidual = std::max(maxResidual, std::abs(residual[u]));
+            if (maxResidual == 0.0)
+                break;
+            threshold = maxResidual / 2;
+            for (const node u : changed) {
+                if (std::abs(residual[u]) >= threshold && !inQueue[u]) {
+                    inQueue[u] = true;
+                    queue.push(u);
+                }
+            }
+            checked = false;
+        }
+
+        const node u = queue.front();
+        queue.pop();
+        inQueue[u] = false;
+        const double r = residual[u];
+        if (std::abs(r) < threshold)
+            continue;
+
+        // Each push decreases the L1 norm of the residual by at least (1 - damp) |r|.
+        setResidual(u, 0.0);
+        estimate[u] += r;
+        estimateSum += r;
+        ++pushes;
+
+        const double share = damp * r * invDeg[u];
+        G.forNeighborsOf(u, [&](node, const node v, const edgeweight w) {
+            setResidual(v, residual[v] + share * w);
+        });
+    }
+    residualSum += changedSum - changedOldSum;
+
+    for (; !queue.empty(); queue.pop())
+        inQueue[queue.front()] = false;
+    for (const node u : changed)
+        isChanged[u] = false;
+    changed.clear();
+
+    updateScores();
+}
+
+void DynPageRank::updateScores() {
+    // PageRank rescales the scores of directed graphs, which leak the rank of their sinks.
+    const double factor = G.isDirected() ? 1.0 / estimateSum : 1.0;
+    G.parallelForNodes([&](const node u) { scoreData[u] = estimate[u] * factor; });
+}
+
+double DynPageRank::maximum() {
+    assureFinished();
+    double max = 0.0;
+    G.forNodes([&](const node u) { max = std::max(max, scoreData[u]); });
+    return max;
+}
+
+} // namespace NetworKit
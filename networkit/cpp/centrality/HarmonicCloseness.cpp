@@ -5,12 +5,11 @@
  * 		 Author: Eugenio Angriman
  */
 
-#include <memory>
+#include <array>
 
 #include <networkit/centrality/HarmonicCloseness.hpp>
-#include <networkit/distance/BFS.hpp>
 #include <networkit/distance/Dijkstra.hpp>
-#include <networkit/distance/SSSP.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 
 namespace NetworKit {
 
@@ -20,27 +19,36 @@ void HarmonicCloseness::run() {
     scoreData.assign(G.upperNodeIdBound(), 0.);
     edgeweight infDist = std::numeric_limits<edgeweight>::max();
 
-    G.parallelForNodes([&](node v) {
-        std::unique_ptr<SSSP> sssp;
-        if (G.isWeighted()) {
-            sssp = std::make_unique<Dijkstra>(G, v, true, true);
-        } else {
-            sssp = std::make_unique<BFS>(G, v, true, true);
-        }
+    if (G.isWeighted()) {
+        G.parallelForNodes([&](node v) {
+            Dijkstra sssp(G, v, true, true);
+            sssp.run();
 
-        sssp->run();
-
-        std::vector<edgeweight> distances = sssp->getDistances();
-
-        double sum = 0;
-        for (auto dist : distances) {
-            if (dist != infDist && dist != 0) {
-                sum += 1 / dist;
+            double sum = 0;
+            for (auto dist : sssp.getDistances()) {
+                if (dist != infDist && dist != 0) {
+                    sum += 1 / dist;
+                }
             }
-        }
 
-        scoreData[v] = sum;
-    });
+            scoreData[v] = sum;
+        });
+    } else {
+        using MSBFS = MultiSourceBFS<>;
+        MSBFS::forNodeBatches(G, [&](MSBFS &msbfs, const std::vector<node> &sources) {
+            std::array<double, MSBFS::width> sum{};
+            msbfs.run(sources.begin(), sources.end(),
+                      [&](node, const MSBFS::Bitset &bits, count dist) {
+                          if (dist == 0)
+                              return;
+                          MSBFS::forBits(bits, [&](index i) { sum[i] += 1. / dist; });
+                      });
+
+            for (index i = 0; i < sources.size(); ++i)
+                scoreData[sources[i]] = sum[i];
+        });
+    }
+
     if (normalized) {
         G.forNodes([&](node w) { scoreData[w] /= static_cast<double>(G.numberOfNodes() - 1); });
     }
@@ -6,6 +6,12 @@
  *               Fabian Brandt-Tumescheit <brandtfa@hu-berlin.de>
  */
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include <omp.h>
+
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
@@ -19,6 +25,14 @@ PageRank::PageRank(const Graph &G, double damp, double tol, bool normalized,
       distributeSinks(distributeSinks) {}
 
 void PageRank::run() {
+    if (singlePrecision)
+        runWithPrecision<float>();
+    else
+        runWithPrecision<double>();
+}
+
+template <typename T>
+void PageRank::runWithPrecision() {
     Aux::SignalHandler handler;
     const auto n = G.numberOfNodes();
     const auto z = G.upperNodeIdBound();
@@ -26,13 +40,24 @@ void PageRank::run() {
     const auto teleportProb = (1.0 - damp) / static_cast<double>(n);
     const double factor = damp / static_cast<double>(n);
     scoreData.resize(z, 1.0 / static_cast<double>(n));
-    std::vector<double> pr = scoreData;
 
-    std::vector<double> deg(z, 0.0);
-    G.parallelForNodes([&](const node u) { deg[u] = static_cast<double>(G.weightedDegree(u)); });
+    // Ranks of the current and of the next iteration, and the contribution rank(v) / deg(v) that
+    // each node passes along each of its (unit weight) out-edges.
+    std::vector<T> rank(scoreData.begin(), scoreData.end()), nextRank(z);
+    std::vector<T> contrib(z, 0), nextContrib;
+    std::vector<double> invDeg(z, 0.0);
+    G.parallelForNodes([&](const node u) {
+        const auto deg = G.weightedDegree(u);
+        if (deg != 0) {
+            invDeg[u] = 1.0 / deg;
+            contrib[u] = static_cast<T>(rank[u] * invDeg[u]);
+        }
+    });
 
+    const bool handleSinks =
+        G.isDirected() && ((distributeSinks == SinkHandling::DISTRIBUTE_SINKS) || normalized);
     std::vector<node> sinks;
-    if (G.isDirected() && ((distributeSinks == SinkHandling::DISTRIBUTE_SINKS) || normalized)) {
+    if (handleSinks) {
         G.forNodes([&](const node u) {
             if (G.degree(u) == 0) {
                 sinks.push_back(u);
@@ -41,60 +66,123 @@ void PageRank::run() {
     }
     count nSinks = sinks.size();
 
-    iterations = 0;
-
-    auto sumL1Norm = [&](const node u) { return std::abs(scoreData[u] - pr[u]); };
-
-    auto sumL2Norm = [&](const node u) {
-        const auto d = scoreData[u] - pr[u];
-        return d * d;
-    };
-
-    auto converged([&]() {
-        if (iterations >= maxIterations) {
-            return true;
-        }
-
-        if (norm == Norm::L2_NORM) {
-            return std::sqrt(G.parallelSumForNodes(sumL2Norm)) <= tol;
+    // Block Gauss-Seidel: one block of consecutive node ids per thread, balanced by the number
+    // of incoming edges.
+    std::vector<node> blockBegin;
+    if (updateScheme == UpdateScheme::GAUSS_SEIDEL) {
+        nextContrib.assign(z, 0);
+        const auto numBlocks = static_cast<count>(omp_get_max_threads());
+        const count work = G.numberOfNodes() + G.numberOfEdges() * (G.isDirected() ? 1 : 2);
+        blockBegin.push_back(0);
+        count done = 0;
+        for (node u = 0; u < z; ++u) {
+            if (G.hasNode(u))
+                done += 1 + G.degreeIn(u);
+            if (blockBegin.size() < numBlocks && done * numBlocks >= work * blockBegin.size())
+                blockBegin.push_back(u + 1);
         }
+        while (blockBegin.size() <= numBlocks)
+            blockBegin.push_back(z);
+    }
 
-        return G.parallelSumForNodes(sumL1Norm) <= tol;
-    });
+    // New rank of u; contribOf(v) returns the contribution of in-neighbor v.
+    auto pull = [&](const node u, double sinkContrib, auto contribOf) -> double {
+        // note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs we
+        // follow the verbal description, which requires to sum over the incoming edges
+        double sum = 0.0;
+        if (G.isWeighted())
+            G.forInEdgesOf(u, [&](node, const node v, const edgeweight w) {
+                sum += static_cast<double>(contribOf(v)) * w;
+            });
+        else
+            G.forInNeighborsOf(u, [&](const node v) { sum += static_cast<double>(contribOf(v)); });
+        return damp * sum + teleportProb + sinkContrib;
+    };
 
+    iterations = 0;
     bool isConverged = false;
     do {
         handler.assureRunning();
-        G.balancedParallelForNodes([&](const node u) {
-            pr[u] = 0.0;
-            G.forInEdgesOf(u, [&](const node u, const node v, const edgeweight w) {
-                // note: inconsistency in definition in Newman's book (Ch. 7) regarding directed
-                // graphs we follow the verbal description, which requires to sum over the incoming
-                // edges
-                pr[u] += scoreData[v] * w / deg[v];
-            });
-            pr[u] *= damp;
-            pr[u] += teleportProb;
-        });
 
         // For directed graphs sink-handling is needed to fulfill |pr| == 1 in each step. Otherwise
         // probability mass would be leaked, creating wrong results. For this, we add edges from
         // sinks to all other nodes. This is described amongst others in "PageRank revisited."
         // by M. Brinkmeyer et al. (2005).
-        if (G.isDirected() && ((distributeSinks == SinkHandling::DISTRIBUTE_SINKS) || normalized)) {
-            double totalSinkContrib = 0.0;
+        double totalSinkContrib = 0.0;
 #pragma omp parallel for reduction(+ : totalSinkContrib)
-            for (omp_index i = 0; i < static_cast<omp_index>(nSinks); i++) {
-                totalSinkContrib += factor * scoreData[sinks[i]];
+        for (omp_index i = 0; i < static_cast<omp_index>(nSinks); i++) {
+            totalSinkContrib += factor * static_cast<double>(rank[sinks[i]]);
+        }
+
+        // Factor applied to the new ranks
+        double scale = 1.0;
+        if (updateScheme == UpdateScheme::GAUSS_SEIDEL) {
+            double mass = 0.0;
+#pragma omp parallel for schedule(static, 1) reduction(+ : mass)
+            for (omp_index b = 0; b < static_cast<omp_index>(blockBegin.size() - 1); ++b) {
+                const node begin = blockBegin[b], end = blockBegin[b + 1];
+                for (node u = begin; u < end; ++u) {
+                    if (!G.hasNode(u))
+                        continue;
+                    // Nodes of this block before u already have their new contribution.
+                    nextRank[u] = static_cast<T>(pull(u, totalSinkContrib, [&](const node v) {
+                        return v >= begin && v < u ? nextContrib[v] : contrib[v];
+                    }));
+                    nextContrib[u] = static_cast<T>(nextRank[u] * invDeg[u]);
+                    mass += nextRank[u];
+                }
             }
-            G.balancedParallelForNodes([&](const node u) { pr[u] += totalSinkContrib; });
+            std::swap(contrib, nextContrib);
+
+            // The sink contribution stems from the previous iteration, so the sweep does not
+            // preserve the total rank, which is 1 in the solution.
+            if (handleSinks && mass > 0.0)
+                scale = 1.0 / mass;
+        } else {
+            G.balancedParallelForNodes([&](const node u) {
+                nextRank[u] = static_cast<T>(
+                    pull(u, totalSinkContrib, [&](const node v) { return contrib[v]; }));
+            });
+        }
+
+        // Residual and, unless they are up to date, the contributions for the next iteration
+        const bool updateContrib = updateScheme == UpdateScheme::SYNCHRONOUS || scale != 1.0;
+        double residual = 0.0, magnitude = 0.0;
+#pragma omp parallel for reduction(+ : residual, magnitude)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            if (!G.hasNode(u))
+                continue;
+            if (scale != 1.0)
+                nextRank[u] = static_cast<T>(nextRank[u] * scale);
+            const double d = static_cast<double>(nextRank[u]) - static_cast<double>(rank[u]);
+            if (norm == Norm::L2_NORM) {
+                residual += d * d;
+                magnitude += static_cast<double>(nextRank[u]) * nextRank[u];
+            } else {
+                residual += std::abs(d);
+                magnitude += nextRank[u];
+            }
+            if (updateContrib)
+                contrib[u] = static_cast<T>(nextRank[u] * invDeg[u]);
+        }
+        if (norm == Norm::L2_NORM) {
+            residual = std::sqrt(residual);
+            magnitude = std::sqrt(magnitude);
         }
 
+        // Ranks that are stored in single precision cannot get closer than their rounding error.
+        double threshold = tol;
+        if (std::is_same<T, float>::value)
+            threshold =
+                std::max(threshold, 8 * std::numeric_limits<float>::epsilon() * magnitude);
+
         ++iterations;
-        isConverged = converged();
-        std::swap(pr, scoreData);
+        isConverged = iterations >= maxIterations || residual <= threshold;
+        std::swap(rank, nextRank);
     } while (!isConverged);
 
+    G.parallelForNodes([&](const node u) { scoreData[u] = static_cast<double>(rank[u]); });
+
     handler.assureRunning();
 
     // Post-processing for normalized PageRank
@@ -0,0 +1,158 @@
+/*
+ * PersonalizedPageRank.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/centrality/PersonalizedPageRank.hpp>
+
+namespace NetworKit {
+
+PersonalizedPageRank::PersonalizedPageRank(const Graph &G,
+                                           std::vector<std::vector<node>> seedSets,
+                                           double damp, double tol)
+    : G(&G), seedSets(std::move(seedSets)), damp(damp), tol(tol),
+      numSets(this->seedSets.size()) {
+    for (auto &seeds : this->seedSets) {
+        if (seeds.empty())
+            throw std::runtime_error("Error, seed sets must not be empty");
+        for (const node s : seeds)
+            if (!G.hasNode(s))
+                throw std::runtime_error("Error, seed " + std::to_string(s)
+                                         + " is not a node of the graph");
+        std::sort(seeds.begin(), seeds.end());
+        seeds.erase(std::unique(seeds.begin(), seeds.end()), seeds.end());
+    }
+}
+
+void PersonalizedPageRank::run() {
+    Aux::SignalHandler handler;
+    const count z = G->upperNodeIdBound();
+    const count k = numSets;
+
+    // Start from the teleport distributions.
+    std::vector<double> teleport(k);
+    ranks.assign(z * k, 0.0);
+    for (index i = 0; i < k; ++i) {
+        teleport[i] = 1.0 / static_cast<double>(seedSets[i].size());
+        for (const node s : seedSets[i])
+            ranks[s * k + i] = teleport[i];
+    }
+
+    std::vector<double> invDeg(z, 0.0);
+    std::vector<node> sinks;
+    G->forNodes([&](const node u) {
+        const auto deg = G->weightedDegree(u);
+        if (deg == 0)
+            sinks.push_back(u);
+        else
+            invDeg[u] = 1.0 / deg;
+    });
+
+    // contrib[v * k + i] is the rank that v passes along each (unit weight) out-edge.
+    std::vector<double> next(z * k), contrib(z * k, 0.0);
+    G->parallelForNodes([&](const node u) {
+        for (index i = 0; i < k; ++i)
+            contrib[u * k + i] = ranks[u * k + i] * invDeg[u];
+    });
+
+    std::vector<std::vector<double>> perThread(omp_get_max_threads(), std::vector<double>(k));
+    std::vector<double> sinkRank(k), residual(k);
+
+    // Sums f(u, i) per seed set over the nodes in [0, size) accepted by nodeOf.
+    auto sumPerSet = [&](std::vector<double> &result, count size, auto nodeOf, auto f) {
+#pragma omp parallel
+        {
+            auto &local = perThread[omp_get_thread_num()];
+            std::fill(local.begin(), local.end(), 0.0);
+#pragma omp for schedule(static)
+            for (omp_index j = 0; j < static_cast<omp_index>(size); ++j) {
+                const node u = nodeOf(static_cast<index>(j));
+                if (u == none)
+                    continue;
+                for (index i = 0; i < k; ++i)
+                    local[i] += f(u, i);
+            }
+        }
+        std::fill(result.begin(), result.end(), 0.0);
+        for (const auto &local : perThread)
+            for (index i = 0; i < k; ++i)
+                result[i] += local[i];
+    };
+
+    iterations = 0;
+    bool converged = false;
+    do {
+        handler.assureRunning();
+
+        // One sweep over the incoming edges for all seed sets
+        G->balancedParallelForNodes([&](const node u) {
+            double *acc = next.data() + u * k;
+            std::fill(acc, acc + k, 0.0);
+            if (G->isWeighted()) {
+                G->forInEdgesOf(u, [&](node, const node v, const edgeweight w) {
+                    const double *c = contrib.data() + v * k;
+                    for (index i = 0; i < k; ++i)
+                        acc[i] += c[i] * w;
+                });
+            } else {
+                G->forInNeighborsOf(u, [&](const node v) {
+                    const double *c = contrib.data() + v * k;
+                    for (index i = 0; i < k; ++i)
+                        acc[i] += c[i];
+                });
+            }
+            for (index i = 0; i < k; ++i)
+                acc[i] *= damp;
+        });
+
+        // Teleport, and return the rank of the sinks to the seeds.
+        sumPerSet(
+            sinkRank, sinks.size(), [&](index j) { return sinks[j]; },
+            [&](node u, index i) { return ranks[u * k + i]; });
+#pragma omp parallel for schedule(dynamic)
+        for (omp_index i = 0; i < static_cast<omp_index>(k); ++i) {
+            const double mass = ((1.0 - damp) + damp * sinkRank[i]) * teleport[i];
+            for (const node s : seedSets[i])
+                next[s * k + i] += mass;
+        }
+
+        // Residual per seed set, and the contributions for the next iteration
+        const bool l2 = norm == PageRank::Norm::L2_NORM;
+        sumPerSet(
+            residual, z, [&](index u) { return G->hasNode(u) ? u : none; },
+            [&](node u, index i) {
+                const double d = next[u * k + i] - ranks[u * k + i];
+                contrib[u * k + i] = next[u * k + i] * invDeg[u];
+                return l2 ? d * d : std::abs(d);
+            });
+
+        double maxResidual = 0.0;
+        for (const double r : residual)
+            maxResidual = std::max(maxResidual, l2 ? std::sqrt(r) : r);
+
+        ++iterations;
+        converged = iterations >= maxIterations || maxResidual <= tol;
+        std::swap(ranks, next);
+    } while (!converged);
+
+    hasRun = true;
+}
+
+std::vector<double> PersonalizedPageRank::scores(index i) const {
+    assureFinished();
+    if (i >= numSets)
+        throw std::runtime_error("Error, invalid seed set index");
+
+    std::vector<double> result(G->upperNodeIdBound(), 0.0);
+    G->parallelForNodes([&](const node u) { result[u] = ranks[u * numSets + i]; });
+    return result;
+}
+
+} // namespace NetworKit
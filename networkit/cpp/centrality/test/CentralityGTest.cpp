@@ -5,8 +5,11 @@
  *      Author: cls
  */
 
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
+#include <omp.h>
 #include <random>
 
 #include <gtest/gtest.h>
@@ -23,7 +26,9 @@
 #include <networkit/centrality/CoreDecomposition.hpp>
 #include <networkit/centrality/DegreeCentrality.hpp>
 #include <networkit/centrality/DynApproxBetweenness.hpp>
+#include <networkit/centrality/DynCoreDecomposition.hpp>
 #include <networkit/centrality/DynKatzCentrality.hpp>
+#include <networkit/centrality/DynPageRank.hpp>
 #include <networkit/centrality/DynTopHarmonicCloseness.hpp>
 #include <networkit/centrality/EigenvectorCentrality.hpp>
 #include <networkit/centrality/EstimateBetweenness.hpp>
@@ -43,6 +48,7 @@
 #include <networkit/centrality/LocalClusteringCoefficient.hpp>
 #include <networkit/centrality/LocalSquareClusteringCoefficient.hpp>
 #include <networkit/centrality/PageRank.hpp>
+#include <networkit/centrality/PersonalizedPageRank.hpp>
 #include <networkit/centrality/PermanenceCentrality.hpp>
 #include <networkit/centrality/SpanningEdgeCentrality.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
@@ -514,6 +520,124 @@ TEST_P(CentralityGTest, testPageRank) {
     doTest(PageRank::Norm::L2_NORM);
 }
 
+TEST_P(CentralityGTest, testPageRankKernels) {
+    SNAPGraphReader reader(isDirected());
+    auto G = reader.read("input/wiki-Vote.txt");
+
+    for (const auto sinks :
+         {PageRank::SinkHandling::NO_SINK_HANDLING, PageRank::SinkHandling::DISTRIBUTE_SINKS}) {
+        PageRank reference(G, 0.85, 1e-10, false, sinks);
+        reference.run();
+
+        for (const auto scheme : {PageRank::UpdateScheme::SYNCHRONOUS,
+                                  PageRank::UpdateScheme::GAUSS_SEIDEL}) {
+            for (const bool singlePrecision : {false, true}) {
+                PageRank pr(G, 0.85, 1e-10, false, sinks);
+                pr.updateScheme = scheme;
+                pr.singlePrecision = singlePrecision;
+                pr.run();
+
+                const double eps = singlePrecision ? 1e-6 : 1e-9;
+                G.forNodes([&](node u) { EXPECT_NEAR(reference.score(u), pr.score(u), eps); });
+                if (scheme == PageRank::UpdateScheme::GAUSS_SEIDEL && !singlePrecision) {
+                    EXPECT_LE(pr.numberOfIterations(), reference.numberOfIterations());
+                }
+            }
+        }
+    }
+}
+
+TEST_P(CentralityGTest, testPersonalizedPageRank) {
+    SNAPGraphReader reader(isDirected());
+    auto G = reader.read("input/wiki-Vote.txt");
+
+    std::vector<node> allNodes;
+    G.forNodes([&](node u) { allNodes.push_back(u); });
+    PersonalizedPageRank ppr(G, {{30, 25}, allNodes, {326}}, 0.85, 1e-10);
+    ppr.run();
+
+    for (index i = 0; i < 3; ++i) {
+        const auto scores = ppr.scores(i);
+        EXPECT_NEAR(std::accumulate(scores.begin(), scores.end(), 0.0), 1.0, 1e-8);
+    }
+
+    // With all nodes as seeds and without sinks, this is plain PageRank.
+    if (!G.isDirected()) {
+        PageRank pr(G, 0.85, 1e-10);
+        pr.run();
+        G.forNodes([&](node u) { EXPECT_NEAR(pr.score(u), ppr.score(u, 1), 1e-9); });
+    }
+
+    // Path 0 -> 1: the rank of the sink 1 returns to the seed 0.
+    Graph path(2, false, true);
+    path.addEdge(0, 1);
+    PersonalizedPageRank pathPPR(path, {{0}, {1}}, 0.85, 1e-12);
+    pathPPR.run();
+    EXPECT_NEAR(pathPPR.score(0, 0), 1.0 / 1.85, 1e-9);
+    EXPECT_NEAR(pathPPR.score(1, 0), 0.85 / 1.85, 1e-9);
+    EXPECT_NEAR(pathPPR.score(0, 1), 0.0, 1e-9);
+    EXPECT_NEAR(pathPPR.score(1, 1), 1.0, 1e-9);
+
+    EXPECT_THROW(PersonalizedPageRank(path, {{}}), std::runtime_error);
+}
+
+TEST_P(CentralityGTest, testDynPageRank) {
+    for (const auto norm : {PageRank::Norm::L1_NORM, PageRank::Norm::L2_NORM}) {
+        Aux::Random::setSeed(42, false);
+        Graph G = ErdosRenyiGenerator(300, 0.02, isDirected()).generate();
+        if (isWeighted()) {
+            G = GraphTools::toWeighted(G);
+            G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::real(0.5, 2)); });
+        }
+
+        constexpr double damp = 0.85, tol = 1e-10;
+        DynPageRank dynPR(G, damp, tol);
+        dynPR.norm = norm;
+        dynPR.run();
+
+        // ||x - x*||_1 <= ||r||_1 / (1 - damp). The scores of directed graphs are rescaled by
+        // their sum, which is at least 1 - damp.
+        const double maxError = (norm == PageRank::Norm::L1_NORM ? 1.0 : std::sqrt(300.0))
+                                * tol / (1 - damp) * (isDirected() ? 2 / (1 - damp) : 1);
+        auto compare = [&]() {
+            PageRank pr(G, damp, 1e-14);
+            pr.run();
+            double error = 0;
+            G.forNodes([&](node u) { error += std::abs(pr.score(u) - dynPR.score(u)); });
+            EXPECT_LE(error, maxError);
+        };
+        compare();
+
+        for (int round = 0; round < 10; ++round) {
+            std::vector<GraphEvent> batch;
+            for (int i = 0; i < 5; ++i) {
+                const node u = GraphTools::randomNode(G), v = GraphTools::randomNode(G);
+                if (u != v && !G.hasEdge(u, v)) {
+                    const edgeweight w =
+                        isWeighted() ? Aux::Random::real(0.5, 2) : defaultEdgeWeight;
+                    G.addEdge(u, v, w);
+                    batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v, w);
+                }
+                const auto [x, y] = GraphTools::randomEdge(G);
+                G.removeEdge(x, y);
+                batch.emplace_back(GraphEvent::EDGE_REMOVAL, x, y);
+            }
+            if (isWeighted()) {
+                const auto [x, y] = GraphTools::randomEdge(G);
+                G.setWeight(x, y, 3);
+                batch.emplace_back(GraphEvent::EDGE_WEIGHT_UPDATE, x, y, 3);
+            }
+
+            dynPR.updateBatch(batch);
+            compare();
+        }
+
+        G.addNode();
+        EXPECT_THROW(dynPR.update(GraphEvent(GraphEvent::EDGE_ADDITION, 0, 300)),
+                     std::runtime_error);
+    }
+}
+
 TEST_P(CentralityGTest, testNormalizedPageRank) {
     /* Graph:
      0 <---> 1
@@ -805,6 +929,88 @@ TEST_F(CentralityGTest, testEdgeBetweennessCentrality) {
     EXPECT_NEAR(6.0, bc[5], tol);
 }
 
+TEST_P(CentralityGTest, testBetweennessMatchesBrandes) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(200, 0.03, isDirected()).generate();
+    if (isWeighted()) {
+        G = GraphTools::toWeighted(G);
+        // Integral weights to get many shortest paths of equal length
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 3)); });
+    }
+    G.indexEdges();
+
+    // Reference: Brandes' algorithm on top of the SSSP classes
+    std::vector<double> nodeRef(G.upperNodeIdBound()), edgeRef(G.upperEdgeIdBound());
+    G.forNodes([&](node s) {
+        std::unique_ptr<SSSP> sssp;
+        if (isWeighted())
+            sssp = std::make_unique<Dijkstra>(G, s, true, true);
+        else
+            sssp = std::make_unique<BFS>(G, s, true, true);
+        sssp->run();
+        std::vector<double> dependency(G.upperNodeIdBound());
+        const auto order = sssp->getNodesSortedByDistance();
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            const node t = *it;
+            for (const node p : sssp->getPredecessors(t)) {
+                double ratio;
+                (sssp->numberOfPaths(p) / sssp->numberOfPaths(t)).ToDouble(ratio);
+                const double c = ratio * (1 + dependency[t]);
+                dependency[p] += c;
+                edgeRef[G.edgeId(p, t)] += c;
+            }
+            if (t != s)
+                nodeRef[t] += dependency[t];
+        }
+    });
+
+    for (const count budget : {count{0}, count{1}}) {
+        Betweenness bc(G, false, true, budget);
+        if (budget == 1) {
+            EXPECT_EQ(bc.sourcesPerBatch(), static_cast<count>(omp_get_max_threads()));
+        }
+        bc.run();
+        G.forNodes([&](node u) { EXPECT_NEAR(bc.score(u), nodeRef[u], 1e-9 * (1 + nodeRef[u])); });
+        const auto edgeScores = bc.edgeScores();
+        G.forEdges([&](node, node, edgeweight, edgeid eid) {
+            EXPECT_NEAR(edgeScores[eid], edgeRef[eid], 1e-9 * (1 + edgeRef[eid]));
+        });
+    }
+}
+
+TEST_F(CentralityGTest, testBetweennessManyShortestPaths) {
+    // A chain of diamonds: hub 3i is connected to the hub 3(i + 1) via the nodes 3i + 1 and
+    // 3i + 2, so there are 2^k shortest paths between the first and the last hub.
+    constexpr count k = 1100;
+    for (const bool weighted : {false, true}) {
+        Graph G(3 * k + 1, weighted);
+        for (node i = 0; i < k; ++i) {
+            for (const node middle : {3 * i + 1, 3 * i + 2}) {
+                G.addEdge(3 * i, middle);
+                G.addEdge(middle, 3 * (i + 1));
+            }
+        }
+        G.indexEdges();
+
+        Betweenness bc(G, false, true);
+        bc.run();
+
+        G.forNodes([&](node u) { EXPECT_TRUE(std::isfinite(bc.score(u))); });
+        for (const double score : bc.edgeScores())
+            EXPECT_TRUE(std::isfinite(score));
+
+        for (node i = 0; i < k; ++i)
+            EXPECT_DOUBLE_EQ(bc.score(3 * i + 1), bc.score(3 * i + 2));
+
+        // All paths between nodes on different sides of an inner hub pass through it, and half
+        // of the paths between the two middle nodes of each adjacent diamond.
+        for (node i = 1; i < k; ++i) {
+            const double expected = 18. * static_cast<double>(i * (k - i)) + 2.;
+            EXPECT_NEAR(bc.score(3 * i), expected, 1e-9 * expected);
+        }
+    }
+}
+
 TEST_F(CentralityGTest, debugEdgeBetweennessCentrality) {
     auto path = "input/PGPgiantcompo.graph";
     METISGraphReader reader;
@@ -1034,7 +1240,7 @@ TEST_F(CentralityGTest, benchCoreDecompositionLocal) {
         timer.start();
         coreDec.run();
         timer.stop();
-        INFO("Time for ParK of ", filename, ": ", timer.elapsedTag());
+        INFO("Time for parallel bucket k-core decomposition of ", filename, ": ", timer.elapsedTag());
 
         CoreDecomposition coreDec2(G, true);
         timer.start();
@@ -1107,6 +1313,60 @@ TEST_F(CentralityGTest, testCoreDecompositionDirected) {
     EXPECT_EQ(2u, coreness[15]) << "expected coreness";
 }
 
+TEST_F(CentralityGTest, testCoreDecompositionParallelBuckets) {
+    Aux::Random::setSeed(42, false);
+    for (const double p : {0.001, 0.01, 0.05}) {
+        Graph G = ErdosRenyiGenerator(2000, p).generate();
+        // Deleted nodes and a dense part for deeper cores
+        for (node u = 0; u < 2000; u += 7)
+            G.removeNode(u);
+        for (node u = 1; u < 100; ++u)
+            for (node v = u + 1; v < 100; ++v)
+                if (G.hasNode(u) && G.hasNode(v) && !G.hasEdge(u, v))
+                    G.addEdge(u, v);
+
+        CoreDecomposition parallel(G);
+        parallel.run();
+        CoreDecomposition buckets(G, false, true);
+        buckets.run();
+        G.forNodes([&](node u) { EXPECT_EQ(parallel.score(u), buckets.score(u)); });
+        EXPECT_EQ(parallel.maxCoreNumber(), buckets.maxCoreNumber());
+    }
+}
+
+TEST_F(CentralityGTest, testDynCoreDecomposition) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.04).generate();
+    DynCoreDecomposition dynCores(G);
+    dynCores.run();
+
+    for (count batchSize : {1, 5, 50}) {
+        for (int iter = 0; iter < 20; ++iter) {
+            std::vector<GraphEvent> batch;
+            for (count i = 0; i < batchSize; ++i) {
+                if (Aux::Random::real() < 0.5) {
+                    const auto [u, v] = GraphTools::randomEdge(G);
+                    G.removeEdge(u, v);
+                    batch.emplace_back(GraphEvent::EDGE_REMOVAL, u, v);
+                } else {
+                    const node u = GraphTools::randomNode(G);
+                    const node v = GraphTools::randomNode(G);
+                    if (u == v || G.hasEdge(u, v))
+                        continue;
+                    G.addEdge(u, v);
+                    batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v);
+                }
+            }
+            dynCores.updateBatch(batch);
+
+            CoreDecomposition cores(G);
+            cores.run();
+            G.forNodes([&](node u) { EXPECT_EQ(dynCores.score(u), cores.score(u)); });
+            EXPECT_EQ(dynCores.maxCoreNumber(), cores.maxCoreNumber());
+        }
+    }
+}
+
 TEST_F(CentralityGTest, testLocalClusteringCoefficientUndirected) {
     count n = 16;
     Graph G(n, false, false);
@@ -1,54 +1,58 @@
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
-
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <numeric>
 #include <utility>
+
+#include <omp.h>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/centrality/CoreDecomposition.hpp>
 #include <networkit/clique/MaximalCliques.hpp>
+#include <networkit/graph/GraphTools.hpp>
 
 namespace {
 // Private implementation namespace
 using NetworKit::count;
 using NetworKit::index;
 using NetworKit::node;
+using NetworKit::none;
+using NetworKit::omp_index;
+
+// Subproblems with at most this many nodes in P and X are solved on adjacency bitmasks.
+constexpr count bitsetSize = 64;
+// The subproblem of a node with at least this many later neighbors is split into tasks.
+constexpr count minSplitSize = 64;
+// Number of buffered clique nodes after which a thread passes its cliques to the callback.
+constexpr count callbackBufferSize = 1024;
+
+// Subproblem that is solved as a separate task: all maximal cliques that contain r, some
+// nodes of p and none of x.
+struct Subproblem {
+    std::vector<node> r, x, p;
+};
 
-class MaximalCliquesImpl {
-private:
+// State that is shared by all threads.
+struct SharedState {
     const NetworKit::Graph *G;
-    std::vector<std::vector<node>> *result;
-    std::function<void(const std::vector<node> &)> &callback;
+    std::function<void(const std::vector<node> &)> *callback;
     bool maximumOnly;
-    count maxFound;
+    std::atomic<count> maxFound{0};
 
-    std::vector<node> pxvector;
-    std::vector<node> pxlookup;
+    // Position of each node in the degeneracy order.
+    std::vector<index> position;
 
+    // Out-going neighbors in the direction of higher positions. This means that the
+    // out-degree is bounded by the maximum core number.
     std::vector<index> firstOut;
     std::vector<node> head;
 
-public:
-    MaximalCliquesImpl(const NetworKit::Graph &G, std::vector<std::vector<node>> &result,
-                       std::function<void(const std::vector<node> &)> &callback, bool maximumOnly)
-        : G(&G), result(&result), callback(callback), maximumOnly(maximumOnly), maxFound(0),
-          pxvector(G.numberOfNodes()), pxlookup(G.upperNodeIdBound()),
-          firstOut(G.upperNodeIdBound() + 1), head(G.numberOfEdges()) {}
-
-private:
-    void buildOutGraph() {
-        index currentOut = 0;
-        for (node u = 0; u < G->upperNodeIdBound(); ++u) {
-            firstOut[u] = currentOut;
-            if (G->hasNode(u)) {
-                index xpboundU = pxlookup[u];
-                G->forEdgesOf(u, [&](node v) {
-                    if (xpboundU < pxlookup[v]) {
-                        head[currentOut++] = v;
-                    }
-                });
-            }
-        }
-        firstOut[G->upperNodeIdBound()] = currentOut;
-    }
+    Aux::SignalHandler *handler;
+    std::atomic<bool> aborted{false};
+    std::exception_ptr error;
 
     template <typename F>
     void forOutEdgesOf(node u, F callback) const {
@@ -68,130 +72,162 @@ private:
 
     count outDegree(node u) const { return firstOut[u + 1] - firstOut[u]; }
 
-    void swapNodeToPos(node u, index pos) {
-        assert(pos < pxvector.size());
-        node pxvec2 = pxvector[pos];
-        std::swap(pxvector[pxlookup[u]], pxvector[pos]);
-        pxlookup[pxvec2] = pxlookup[u];
-        pxlookup[u] = pos;
-    }
-
-public:
-    void run() {
-        NetworKit::CoreDecomposition cores(*G, false, false, true);
-        cores.run();
-
-        Aux::SignalHandler handler;
-        handler.assureRunning();
+    bool stopped() const { return aborted.load(std::memory_order_relaxed) || !handler->isRunning(); }
+};
 
-        const auto &orderedNodes = cores.getNodeOrder();
+// Enumerates the cliques of one thread. P and X are stored in pxvector: X is the range
+// [xbound, xpbound), P the range [xpbound, pbound). pxlookup stores the position of each node
+// in pxvector, or none if the node is not part of the current subproblem.
+class CliqueEnumerator {
+private:
+    SharedState *shared;
 
-        index ii = 0;
-        for (const node u : orderedNodes) {
-            pxvector[ii] = u;
-            pxlookup[u] = ii;
-            ii += 1;
-        }
+    std::vector<node> pxvector;
+    std::vector<index> pxlookup;
+    std::vector<node> r;
 
-        handler.assureRunning();
+    std::array<uint64_t, bitsetSize> neighborMasks;
 
-#ifndef NDEBUG
-        for (auto u : orderedNodes) {
-            assert(pxvector[pxlookup[u]] == u);
-        }
-#endif
+    // Cliques that have not been passed to the callback yet, the i-th clique ends at
+    // bufferedEnds[i].
+    std::vector<node> bufferedNodes;
+    std::vector<index> bufferedEnds;
+    std::vector<node> clique;
 
-        // Store out-going neighbors in the direction of higher core numbers.
-        // This means that the out-degree is bounded by the maximum core number.
-        buildOutGraph();
+public:
+    std::vector<std::vector<node>> cliques;
+    std::vector<node> largestClique;
+
+    CliqueEnumerator(SharedState &shared, count maxDegree)
+        : shared(&shared), pxvector(maxDegree), pxlookup(shared.G->upperNodeIdBound(), none) {}
+
+    // Lists the maximal cliques whose node with the lowest position is u. If the subproblem is
+    // large and split is not null, it is split into subproblems that are appended to split.
+    void solveNode(node u, std::vector<Subproblem> *split) {
+        // Check if u can be the starting point of a new clique
+        // of size greater than maxFound.
+        // Note that the clique starting at u could be of
+        // size outDegree(u) + 1, but then it is still only the
+        // same size as maxFound.
+        if (shared->maximumOnly && shared->maxFound.load(std::memory_order_relaxed)
+                                       > shared->outDegree(u))
+            return;
 
-        handler.assureRunning();
+        const index positionU = shared->position[u];
+        count xcount = 0;
+        shared->G->forNeighborsOf(u, [&](node v) { xcount += shared->position[v] < positionU; });
 
-        for (index iu = orderedNodes.size(); iu-- > 0;) {
-            node u = orderedNodes[iu];
-            index xpbound = iu + 1;
+        index xpos = 0, ppos = xcount;
+        shared->G->forNeighborsOf(u, [&](node v) {
+            if (shared->position[v] < positionU) // v is in X
+                place(v, xpos++);
+            else if (v != u) // v is in P
+                place(v, ppos++);
+        });
 
-#ifndef NDEBUG
-            for (auto v : orderedNodes) {
-                if (v == u)
-                    break;
+        r.assign(1, u);
+        if (split && ppos - xcount >= minSplitSize) {
+            forEachBranch(0, xcount, ppos, [&](index newXbound, index newXpbound, index newPbound) {
+                split->push_back(
+                    {r,
+                     {pxvector.begin() + newXbound, pxvector.begin() + newXpbound},
+                     {pxvector.begin() + newXpbound, pxvector.begin() + newPbound}});
+            });
+        } else {
+            tomita(0, xcount, ppos);
+        }
 
-                assert(pxlookup[v] < xpbound);
-            }
-#endif
+        release(ppos);
+    }
 
-            // Check if u can be the starting point of a new clique
-            // of size greater than maxFound.
-            // Note that the clique starting at u could be of
-            // size outDegree(u) + 1, but then it is still only the
-            // same size as maxFound.
-            if (maximumOnly && maxFound > outDegree(u)) {
-                swapNodeToPos(u, iu);
-                continue;
-            }
+    void solve(const Subproblem &subproblem) {
+        index pos = 0;
+        for (const node v : subproblem.x)
+            place(v, pos++);
+        for (const node v : subproblem.p)
+            place(v, pos++);
 
-            count xcount = 0;
-            count pcount = 0;
-            G->forNeighborsOf(u, [&](node v) {
+        r = subproblem.r;
+        if (!shared->maximumOnly
+            || shared->maxFound.load(std::memory_order_relaxed) < r.size() + subproblem.p.size())
+            tomita(0, subproblem.x.size(), pos);
 
-#ifndef NDEBUG
-                assert(pxlookup[v] < pxvector.size());
+        release(pos);
+    }
 
-                assert(xcount <= xpbound);
-                assert(pcount <= pxvector.size() - xpbound);
-#endif
+    // Passes the buffered cliques to the callback. The calls are serialized over all threads,
+    // exceptions are stored and stop the enumeration.
+    void flush() {
+        if (bufferedEnds.empty())
+            return;
 
-                if (pxlookup[v] < xpbound) { // v is in X
-                    swapNodeToPos(v, xpbound - xcount - 1);
-                    xcount += 1;
-                } else { // v is in P
-                    swapNodeToPos(v, xpbound + pcount);
-                    pcount += 1;
+#pragma omp critical(MaximalCliquesCallback)
+        {
+            if (!shared->aborted.load(std::memory_order_relaxed)) {
+                try {
+                    index begin = 0;
+                    for (const index end : bufferedEnds) {
+                        clique.assign(bufferedNodes.begin() + begin, bufferedNodes.begin() + end);
+                        (*shared->callback)(clique);
+                        begin = end;
+                    }
+                } catch (...) {
+                    shared->error = std::current_exception();
+                    shared->aborted.store(true, std::memory_order_relaxed);
                 }
-            });
+            }
+        }
 
-#ifndef NDEBUG
-            { // assert all neighbors of u were stored in one range around xpbound
+        bufferedNodes.clear();
+        bufferedEnds.clear();
+    }
 
-                assert(xcount + pcount == G->degree(u));
+private:
+    void place(node u, index pos) {
+        pxvector[pos] = u;
+        pxlookup[u] = pos;
+    }
 
-                std::vector<index> neighborPositions;
-                G->forNeighborsOf(u, [&](node v) {
-                    neighborPositions.push_back(pxlookup[v]);
-                    assert(pxvector[pxlookup[v]] == v);
-                });
+    void release(index pbound) {
+        for (index i = 0; i < pbound; ++i)
+            pxlookup[pxvector[i]] = none;
+    }
 
-                std::sort(neighborPositions.begin(), neighborPositions.end());
-                for (index i = 0; i < neighborPositions.size(); ++i) {
-                    assert(neighborPositions[i] == xpbound - xcount + i);
+    void swapNodeToPos(node u, index pos) {
+        assert(pos < pxvector.size());
+        node pxvec2 = pxvector[pos];
+        std::swap(pxvector[pxlookup[u]], pxvector[pos]);
+        pxlookup[pxvec2] = pxlookup[u];
+        pxlookup[u] = pos;
+    }
+
+    void report() {
+        if (shared->maximumOnly) {
+            if (r.size() > largestClique.size()) {
+                largestClique = r;
+                count found = shared->maxFound.load(std::memory_order_relaxed);
+                while (found < r.size()
+                       && !shared->maxFound.compare_exchange_weak(found, r.size(),
+                                                                  std::memory_order_relaxed)) {
                 }
             }
-#endif
-
-            std::vector<node> r = {u};
-            tomita(xpbound - xcount, xpbound, xpbound + pcount, r);
-
-            swapNodeToPos(u, iu);
-
-            handler.assureRunning();
+        } else if (*shared->callback) {
+            bufferedNodes.insert(bufferedNodes.end(), r.begin(), r.end());
+            bufferedEnds.push_back(bufferedNodes.size());
+            if (bufferedNodes.size() >= callbackBufferSize)
+                flush();
+        } else {
+            cliques.push_back(r);
         }
     }
 
-    void tomita(index xbound, index xpbound, index pbound, std::vector<node> &r) {
+    void tomita(index xbound, index xpbound, index pbound) {
         if (xbound == pbound) { // if (X, P are empty)
-            if (callback) {
-                callback(r);
-            } else if (!maximumOnly) {
-                result->push_back(r);
-            } else if (r.size() > maxFound) {
-                result->clear();
-                result->push_back(r);
-                maxFound = r.size();
-            }
+            report();
             return;
         }
 
-        if (xpbound == pbound)
+        if (xpbound == pbound || shared->stopped())
             return;
 
 #ifndef NDEBUG
@@ -200,9 +236,20 @@ public:
         assert(pbound <= pxvector.size());
 #endif
 
-        Aux::SignalHandler handler;
-        handler.assureRunning();
+        if (pbound - xbound <= bitsetSize) {
+            bitsetTomita(xbound, xpbound, pbound);
+            return;
+        }
 
+        forEachBranch(xbound, xpbound, pbound, [&](index newXbound, index newXpbound, index newPbound) {
+            tomita(newXbound, newXpbound, newPbound);
+        });
+    }
+
+    // Chooses a pivot and calls f(xbound, xpbound, pbound) with the subproblem of each node in P
+    // that is not a neighbor of the pivot, while this node is appended to r.
+    template <typename F>
+    void forEachBranch(index xbound, index xpbound, index pbound, F f) {
         node u = findPivot(xbound, xpbound, pbound);
         std::vector<node> movedNodes;
 
@@ -213,7 +260,7 @@ public:
 
         // Step 1: mark all outgoing neighbors of the pivot in P
         std::vector<bool> pivotNeighbors(pbound - xpbound);
-        forOutEdgesOf(u, [&](node v) {
+        shared->forOutEdgesOf(u, [&](node v) {
             index vpos = pxlookup[v];
             if (vpos >= xpbound && vpos < pbound) {
                 pivotNeighbors[vpos - xpbound] = true;
@@ -226,7 +273,7 @@ public:
             if (!pivotNeighbors[i - xpbound]) {
                 node p = pxvector[i];
 
-                if (!hasNeighbor(p, u)) {
+                if (!shared->hasNeighbor(p, u)) {
                     toCheck.push_back(p);
                 }
             }
@@ -237,7 +284,7 @@ public:
 
             // Group all neighbors of pxveci in P \cup X around xpbound.
             // Step 1: collect all outgoing neighbors of pxveci
-            forOutEdgesOf(pxveci, [&](node v) {
+            shared->forOutEdgesOf(pxveci, [&](node v) {
                 if (pxlookup[v] < xpbound && pxlookup[v] >= xbound) { // v is in X
                     swapNodeToPos(v, xpbound - xcount - 1);
                     xcount += 1;
@@ -255,7 +302,7 @@ public:
                     break;
                 node x = pxvector[i];
 
-                if (hasNeighbor(x, pxveci)) {
+                if (shared->hasNeighbor(x, pxveci)) {
                     swapNodeToPos(x, xpbound - xcount - 1);
                     xcount += 1;
                 } else {
@@ -270,7 +317,7 @@ public:
             for (index i = xpbound + pcount; i < pbound; ++i) {
                 node p = pxvector[i];
 
-                if (hasNeighbor(p, pxveci)) {
+                if (shared->hasNeighbor(p, pxveci)) {
                     swapNodeToPos(p, xpbound + pcount);
                     pcount += 1;
                 }
@@ -287,8 +334,9 @@ public:
             // therefore r.size() + pcount is an upper bound for the maximum
             // size of the clique that can still be found in this branch
             // of the recursion.
-            if (!maximumOnly || maxFound < (r.size() + pcount)) {
-                tomita(xpbound - xcount, xpbound, xpbound + pcount, r);
+            if (!shared->maximumOnly
+                || shared->maxFound.load(std::memory_order_relaxed) < (r.size() + pcount)) {
+                f(xpbound - xcount, xpbound, xpbound + pcount);
             }
 
             r.pop_back();
@@ -321,7 +369,7 @@ public:
         // Step 1: for all nodes in X count how many outgoing neighbors they have in P
         for (index i = 0; i < xpbound - xbound; i++) {
             node u = pxvector[i + xbound];
-            forOutEdgesOf(u, [&](node v) {
+            shared->forOutEdgesOf(u, [&](node v) {
                 if (pxlookup[v] >= xpbound && pxlookup[v] < pbound) {
                     ++pivotNeighbors[i];
                 }
@@ -337,7 +385,7 @@ public:
         // b) count all outgoing neighbors in P
         for (index i = xpbound - xbound; i < pivotNeighbors.size(); ++i) {
             node u = pxvector[i + xbound];
-            forOutEdgesOf(u, [&](node v) {
+            shared->forOutEdgesOf(u, [&](node v) {
                 index neighborPos = pxlookup[v];
                 if (neighborPos >= xbound && neighborPos < pbound) {
                     ++pivotNeighbors[neighborPos - xbound];
@@ -360,12 +408,182 @@ public:
             }
         }
 
-#ifndef NDEBUG
-        assert(maxnode < G->upperNodeIdBound() + 1);
-#endif
-
         return maxnode;
     }
+
+    static uint64_t lowBits(count k) { return k == 64 ? ~uint64_t{0} : (uint64_t{1} << k) - 1; }
+
+    // Solves a subproblem with at most bitsetSize nodes in P and X on adjacency bitmasks: bit j
+    // of neighborMasks[i] is set if the nodes at positions xbound + i and xbound + j are
+    // adjacent.
+    void bitsetTomita(index xbound, index xpbound, index pbound) {
+        const count size = pbound - xbound;
+        std::fill_n(neighborMasks.begin(), size, 0);
+        for (index i = 0; i < size; ++i) {
+            shared->forOutEdgesOf(pxvector[xbound + i], [&](node v) {
+                const index pos = pxlookup[v];
+                if (pos >= xbound && pos < pbound) {
+                    const index j = pos - xbound;
+                    neighborMasks[i] |= uint64_t{1} << j;
+                    neighborMasks[j] |= uint64_t{1} << i;
+                }
+            });
+        }
+
+        const uint64_t x = lowBits(xpbound - xbound);
+        bitsetTomita(lowBits(size) & ~x, x, pxvector.data() + xbound);
+    }
+
+    void bitsetTomita(uint64_t p, uint64_t x, const node *nodes) {
+        if (!p) {
+            if (!x)
+                report();
+            return;
+        }
+
+        // Choose the node in P \cup X with the most neighbors in P as pivot.
+        index pivot = 0;
+        count maxval = 0;
+        for (uint64_t px = p | x; px; px &= px - 1) {
+            const auto i = static_cast<index>(__builtin_ctzll(px));
+            const auto neighborsInP = static_cast<count>(__builtin_popcountll(p & neighborMasks[i]));
+            if (neighborsInP >= maxval) {
+                maxval = neighborsInP;
+                pivot = i;
+            }
+        }
+
+        for (uint64_t candidates = p & ~neighborMasks[pivot]; candidates;
+             candidates &= candidates - 1) {
+            const auto i = static_cast<index>(__builtin_ctzll(candidates));
+            const uint64_t newP = p & neighborMasks[i];
+            if (!shared->maximumOnly
+                || shared->maxFound.load(std::memory_order_relaxed)
+                       < r.size() + 1 + static_cast<count>(__builtin_popcountll(newP))) {
+                r.push_back(nodes[i]);
+                bitsetTomita(newP, x & neighborMasks[i], nodes);
+                r.pop_back();
+            }
+
+            // move from P -> X
+            p &= ~(uint64_t{1} << i);
+            x |= uint64_t{1} << i;
+        }
+    }
+};
+
+class MaximalCliquesImpl {
+private:
+    SharedState shared;
+    std::vector<std::vector<node>> *result;
+
+public:
+    MaximalCliquesImpl(const NetworKit::Graph &G, std::vector<std::vector<node>> &result,
+                       std::function<void(const std::vector<node> &)> &callback, bool maximumOnly)
+        : result(&result) {
+        shared.G = &G;
+        shared.callback = &callback;
+        shared.maximumOnly = maximumOnly;
+    }
+
+private:
+    void buildOutGraph() {
+        const NetworKit::Graph &G = *shared.G;
+        const auto &position = shared.position;
+        auto &firstOut = shared.firstOut;
+
+        firstOut.assign(G.upperNodeIdBound() + 1, 0);
+        G.parallelForNodes([&](node u) {
+            G.forNeighborsOf(u, [&](node v) { firstOut[u + 1] += position[u] < position[v]; });
+        });
+        std::partial_sum(firstOut.begin(), firstOut.end(), firstOut.begin());
+
+        shared.head.resize(firstOut.back());
+        G.parallelForNodes([&](node u) {
+            index currentOut = firstOut[u];
+            G.forNeighborsOf(u, [&](node v) {
+                if (position[u] < position[v]) {
+                    shared.head[currentOut++] = v;
+                }
+            });
+        });
+    }
+
+public:
+    void run() {
+        const NetworKit::Graph &G = *shared.G;
+        NetworKit::CoreDecomposition cores(G, false, false, true);
+        cores.run();
+
+        Aux::SignalHandler handler;
+        handler.assureRunning();
+        shared.handler = &handler;
+
+        const auto &orderedNodes = cores.getNodeOrder();
+        const count n = orderedNodes.size();
+
+        shared.position.resize(G.upperNodeIdBound());
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i)
+            shared.position[orderedNodes[i]] = static_cast<index>(i);
+
+        buildOutGraph();
+
+        handler.assureRunning();
+
+        const count maxDegree = NetworKit::GraphTools::maxDegree(G);
+        std::vector<CliqueEnumerator> enumerators;
+        enumerators.reserve(omp_get_max_threads());
+        for (int t = 0; t < omp_get_max_threads(); ++t)
+            enumerators.emplace_back(shared, maxDegree);
+
+        // The subproblems of the nodes are independent. They are processed starting from the
+        // highest core, such that large cliques are found early when searching for the maximum.
+        // Subproblems with many candidates are split into tasks, so idle threads take over parts
+        // of them.
+#pragma omp parallel
+        {
+            std::vector<Subproblem> split;
+
+#pragma omp for schedule(dynamic, 16)
+            for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+                if (shared.stopped())
+                    continue;
+
+                enumerators[omp_get_thread_num()].solveNode(orderedNodes[n - 1 - i], &split);
+
+                for (auto &subproblem : split) {
+                    auto task = std::make_shared<Subproblem>(std::move(subproblem));
+#pragma omp task firstprivate(task)
+                    {
+                        if (!shared.stopped())
+                            enumerators[omp_get_thread_num()].solve(*task);
+                    }
+                }
+                split.clear();
+            }
+        }
+
+        for (auto &enumerator : enumerators)
+            enumerator.flush();
+
+        if (shared.error)
+            std::rethrow_exception(shared.error);
+        handler.assureRunning();
+
+        if (shared.maximumOnly) {
+            auto largest = std::max_element(
+                enumerators.begin(), enumerators.end(), [](const auto &a, const auto &b) {
+                    return a.largestClique.size() < b.largestClique.size();
+                });
+            if (largest != enumerators.end() && !largest->largestClique.empty())
+                result->push_back(std::move(largest->largestClique));
+        } else {
+            for (auto &enumerator : enumerators)
+                for (auto &clique : enumerator.cliques)
+                    result->push_back(std::move(clique));
+        }
+    }
 };
 
 } // namespace
@@ -1,6 +1,11 @@
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
 #include <gtest/gtest.h>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/auxiliary/Timer.hpp>
 #include <networkit/clique/MaximalCliques.hpp>
 #include <networkit/graph/Graph.hpp>
@@ -156,4 +161,78 @@ TEST_F(MaximalCliquesGTest, benchMaximalCliques) {
     }
 }
 
+TEST_F(MaximalCliquesGTest, testMaximalCliquesWithLargeCandidateSets) {
+    // Three cliques of 80 nodes with random edges between them, such that the subproblems of
+    // many nodes have more candidates than fit into a bitmask.
+    Aux::Random::setSeed(42, false);
+    const count n = 240;
+    Graph G(n);
+    for (node u = 0; u < n; ++u) {
+        for (node v = u + 1; v < n; ++v) {
+            if (u / 80 == v / 80 || Aux::Random::probability() < 0.1)
+                G.addEdge(u, v);
+        }
+    }
+
+    std::set<std::vector<node>> found;
+    MaximalCliques withCallback(G, [&](const std::vector<node> &clique) {
+        auto sorted = clique;
+        std::sort(sorted.begin(), sorted.end());
+        EXPECT_TRUE(found.insert(sorted).second) << "clique reported twice";
+    });
+    withCallback.run();
+
+    count maxSize = 0;
+    std::vector<bool> inClique(n);
+    for (const auto &clique : found) {
+        maxSize = std::max<count>(maxSize, clique.size());
+        for (node u : clique)
+            inClique[u] = true;
+
+        // Check that the clique is a clique and that no other node is adjacent to all its nodes.
+        std::vector<count> neighborsInClique(n);
+        for (node u : clique)
+            G.forNeighborsOf(u, [&](node v) { ++neighborsInClique[v]; });
+        for (node u = 0; u < n; ++u) {
+            if (inClique[u])
+                EXPECT_EQ(clique.size() - 1, neighborsInClique[u]);
+            else
+                EXPECT_LT(neighborsInClique[u], clique.size());
+        }
+
+        for (node u : clique)
+            inClique[u] = false;
+    }
+    EXPECT_GE(maxSize, 80u);
+
+    MaximalCliques stored(G);
+    stored.run();
+    std::set<std::vector<node>> storedCliques;
+    for (auto clique : stored.getCliques()) {
+        std::sort(clique.begin(), clique.end());
+        storedCliques.insert(clique);
+    }
+    EXPECT_EQ(stored.getCliques().size(), found.size());
+    EXPECT_EQ(storedCliques, found);
+
+    MaximalCliques maximum(G, true);
+    maximum.run();
+    ASSERT_EQ(1u, maximum.getCliques().size());
+    EXPECT_EQ(maxSize, maximum.getCliques().front().size());
+}
+
+TEST_F(MaximalCliquesGTest, testMaximalCliquesCallbackThrows) {
+    METISGraphReader reader;
+    Graph G = reader.read("input/hep-th.graph");
+
+    count numCalls = 0;
+    MaximalCliques clique(G, [&](const std::vector<node> &) {
+        ++numCalls;
+        throw std::runtime_error("stop");
+    });
+
+    EXPECT_THROW(clique.run(), std::runtime_error);
+    EXPECT_EQ(1u, numCalls);
+}
+
 } // namespace NetworKit
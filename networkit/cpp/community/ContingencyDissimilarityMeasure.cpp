@@ -0,0 +1,27 @@
+/*
+ * ContingencyDissimilarityMeasure.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <networkit/community/ContingencyDissimilarityMeasure.hpp>
+
+namespace NetworKit {
+
+double ContingencyDissimilarityMeasure::getDissimilarity(const Graph &G, const Partition &first,
+                                                         const Partition &second) {
+    return getDissimilarity(ContingencyTable(G, first, second));
+}
+
+std::vector<double>
+ContingencyDissimilarityMeasure::getDissimilarities(const Graph &G, const Partition &reference,
+                                                    const std::vector<Partition> &candidates) {
+    std::vector<double> dissimilarities(candidates.size());
+    ContingencyTable::forCandidates(G, reference, candidates,
+                                    [&](index i, const ContingencyTable &table) {
+                                        dissimilarities[i] = getDissimilarity(table);
+                                    });
+    return dissimilarities;
+}
+
+} // namespace NetworKit
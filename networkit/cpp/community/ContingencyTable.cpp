@@ -0,0 +1,211 @@
+/*
+ * ContingencyTable.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/community/ContingencyTable.hpp>
+
+namespace NetworKit {
+
+namespace {
+// Buckets with at least this many nodes are sorted in parallel, one after another.
+constexpr count minLargeBucket = 1 << 16;
+
+count sumOfPairs(const std::vector<count> &clusterSizes) {
+    count pairs = 0;
+#pragma omp parallel for reduction(+ : pairs)
+    for (omp_index C = 0; C < static_cast<omp_index>(clusterSizes.size()); ++C)
+        pairs += clusterSizes[C] * (clusterSizes[C] - 1) / 2;
+    return pairs;
+}
+
+double entropy(const std::vector<count> &clusterSizes, count n) {
+    double H = 0.0;
+#pragma omp parallel for reduction(+ : H)
+    for (omp_index C = 0; C < static_cast<omp_index>(clusterSizes.size()); ++C) {
+        if (clusterSizes[C] > 0) {
+            const double p = static_cast<double>(clusterSizes[C]) / static_cast<double>(n);
+            H -= p * std::log2(p);
+        }
+    }
+    return H;
+}
+} // namespace
+
+// The nodes of G that are assigned in the first partition, grouped by their cluster.
+struct ContingencyTable::Buckets {
+    Buckets(const Graph &G, const Partition &first) {
+        const index rows = first.upperBound();
+        auto isAssigned = [&](node u) { return u < first.numberOfElements() && first[u] != none; };
+
+        begin.assign(rows + 1, 0);
+        G.parallelForNodes([&](node u) {
+            if (isAssigned(u)) {
+#pragma omp atomic
+                ++begin[first[u] + 1];
+            }
+        });
+        for (index C = 0; C < rows; ++C)
+            begin[C + 1] += begin[C];
+
+        nodes.resize(begin.back());
+        std::vector<index> cursor(begin.begin(), begin.end() - 1);
+        G.parallelForNodes([&](node u) {
+            if (isAssigned(u)) {
+                index pos;
+#pragma omp atomic capture
+                pos = cursor[first[u]]++;
+                nodes[pos] = u;
+            }
+        });
+    }
+
+    std::vector<index> begin;
+    std::vector<node> nodes;
+};
+
+ContingencyTable::ContingencyTable(const Graph &G, const Partition &first, const Partition &second)
+    : ContingencyTable(Buckets(G, first), second) {}
+
+void ContingencyTable::forCandidates(
+    const Graph &G, const Partition &reference, const std::vector<Partition> &candidates,
+    const std::function<void(index, const ContingencyTable &)> &handle) {
+    const Buckets buckets(G, reference);
+    for (index i = 0; i < candidates.size(); ++i)
+        handle(i, ContingencyTable(buckets, candidates[i]));
+}
+
+ContingencyTable::ContingencyTable(const Buckets &buckets, const Partition &second) {
+    struct Entry {
+        index row;
+        index column;
+        count size;
+    };
+
+    const count rows = buckets.begin.size() - 1;
+    firstSizes.assign(rows, 0);
+    secondSizes.assign(second.upperBound(), 0);
+    rowBegin.assign(rows + 1, 0);
+
+    const count largeBucket =
+        std::max<count>(minLargeBucket, buckets.nodes.size() / (4 * omp_get_max_threads()));
+    std::vector<std::vector<Entry>> entries(omp_get_max_threads());
+    std::vector<index> largeRows;
+
+    // Collects the clusters of the second partition of the nodes in row C.
+    auto gather = [&](index C, std::vector<index> &clusters) {
+        clusters.clear();
+        for (index i = buckets.begin[C]; i < buckets.begin[C + 1]; ++i) {
+            const node u = buckets.nodes[i];
+            if (u < second.numberOfElements() && second[u] != none)
+                clusters.push_back(second[u]);
+        }
+    };
+    // Appends the entries of row C to local, given the sorted clusters of its nodes.
+    auto countRuns = [&](index C, const std::vector<index> &clusters, std::vector<Entry> &local) {
+        count distinct = 0;
+        for (index i = 0, j = 0; i < clusters.size(); i = j) {
+            while (j < clusters.size() && clusters[j] == clusters[i])
+                ++j;
+            local.push_back({C, clusters[i], j - i});
+#pragma omp atomic
+            secondSizes[clusters[i]] += j - i;
+            ++distinct;
+        }
+        rowBegin[C + 1] = distinct;
+        firstSizes[C] = clusters.size();
+    };
+
+#pragma omp parallel
+    {
+        auto &local = entries[omp_get_thread_num()];
+        std::vector<index> clusters;
+#pragma omp for schedule(guided) nowait
+        for (omp_index C = 0; C < static_cast<omp_index>(rows); ++C) {
+            if (buckets.begin[C + 1] - buckets.begin[C] >= largeBucket) {
+#pragma omp critical
+                largeRows.push_back(C);
+                continue;
+            }
+            gather(C, clusters);
+            std::sort(clusters.begin(), clusters.end());
+            countRuns(C, clusters, local);
+        }
+    }
+
+    // Few large buckets would serialize the loop above, so each of them is sorted in parallel.
+    std::vector<index> clusters;
+    for (const index C : largeRows) {
+        gather(C, clusters);
+        Aux::Parallel::sort(clusters.begin(), clusters.end());
+        countRuns(C, clusters, entries.front());
+    }
+
+    for (index C = 0; C < rows; ++C) {
+        n += firstSizes[C];
+        rowBegin[C + 1] += rowBegin[C];
+    }
+
+    // The entries of a row are contiguous in the list of a single thread.
+    columns.resize(rowBegin.back());
+    sizes.resize(rowBegin.back());
+#pragma omp parallel for schedule(static, 1)
+    for (omp_index t = 0; t < static_cast<omp_index>(entries.size()); ++t) {
+        index pos = 0, row = none;
+        for (const Entry &entry : entries[t]) {
+            if (entry.row != row) {
+                row = entry.row;
+                pos = rowBegin[row];
+            }
+            columns[pos] = entry.column;
+            sizes[pos] = entry.size;
+            ++pos;
+        }
+    }
+}
+
+count ContingencyTable::pairsInFirst() const {
+    return sumOfPairs(firstSizes);
+}
+
+count ContingencyTable::pairsInSecond() const {
+    return sumOfPairs(secondSizes);
+}
+
+count ContingencyTable::pairsInBoth() const {
+    count pairs = 0;
+#pragma omp parallel for reduction(+ : pairs)
+    for (omp_index i = 0; i < static_cast<omp_index>(sizes.size()); ++i)
+        pairs += sizes[i] * (sizes[i] - 1) / 2;
+    return pairs;
+}
+
+double ContingencyTable::mutualInformation() const {
+    // $MI(\zeta,\eta):=\sum_{C\in\zeta}\sum_{D\in\eta}\frac{|C\cap
+    // D|}{n}\cdot\log_{2}\left(\frac{|C\cap D|\cdot n}{|C|\cdot|D|}\right)$
+    const double total = static_cast<double>(n);
+    return parallelSumForEntries([&](index C, index D, count size) {
+        const double overlap = static_cast<double>(size);
+        return overlap / total
+               * std::log2(overlap * total
+                           / (static_cast<double>(firstSizes[C])
+                              * static_cast<double>(secondSizes[D])));
+    });
+}
+
+double ContingencyTable::entropyOfFirst() const {
+    return entropy(firstSizes, n);
+}
+
+double ContingencyTable::entropyOfSecond() const {
+    return entropy(secondSizes, n);
+}
+
+} // namespace NetworKit
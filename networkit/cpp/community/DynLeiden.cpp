@@ -0,0 +1,97 @@
+/*
+ * DynLeiden.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <omp.h>
+
+#include <networkit/community/DynLeiden.hpp>
+#include <networkit/community/ParallelLeiden.hpp>
+
+namespace NetworKit {
+
+DynLeiden::DynLeiden(const Graph &G, int iterations, bool randomize, double gamma)
+    : CommunityDetectionAlgorithm(G), iterations(iterations), randomize(randomize), gamma(gamma) {
+    if (G.isDirected())
+        throw std::runtime_error("DynLeiden only supports undirected graphs.");
+}
+
+DynLeiden::DynLeiden(const Graph &G, const Partition &previous, bool randomize, double gamma)
+    : CommunityDetectionAlgorithm(G, previous), iterations(3), randomize(randomize),
+      gamma(gamma) {
+    if (G.isDirected())
+        throw std::runtime_error("DynLeiden only supports undirected graphs.");
+    if (result.numberOfElements() > G.upperNodeIdBound())
+        throw std::runtime_error("The partition contains more elements than the graph has nodes.");
+    hasRun = true;
+}
+
+void DynLeiden::run() {
+    ParallelLeiden leiden(*G, iterations, randomize, gamma);
+    leiden.run();
+    result = leiden.getPartition();
+    hasRun = true;
+}
+
+void DynLeiden::updateBatch(const std::vector<GraphEvent> &batch) {
+    assureFinished();
+
+    const count z = G->upperNodeIdBound();
+    while (result.numberOfElements() < z)
+        result.extend();
+
+    std::vector<uint8_t> endpoint(z, 0);
+    for (const auto &e : batch) {
+        switch (e.type) {
+        case GraphEvent::NODE_ADDITION:
+        case GraphEvent::NODE_REMOVAL:
+        case GraphEvent::NODE_RESTORATION:
+            endpoint[e.u] = 1;
+            break;
+        case GraphEvent::EDGE_ADDITION:
+        case GraphEvent::EDGE_REMOVAL:
+        case GraphEvent::EDGE_WEIGHT_UPDATE:
+        case GraphEvent::EDGE_WEIGHT_INCREMENT:
+            endpoint[e.u] = 1;
+            endpoint[e.v] = 1;
+            break;
+        case GraphEvent::TIME_STEP:
+            break;
+        default:
+            throw std::runtime_error("Event type not allowed. Use edge or node events only.");
+        }
+    }
+
+    // New nodes start as singletons, removed nodes are dropped. The communities of the
+    // endpoints (including the old communities of removed nodes) are affected as a whole.
+    for (node u = 0; u < z; ++u) {
+        if (G->hasNode(u) && result[u] == none) {
+            result.toSingleton(u);
+            endpoint[u] = 1;
+        }
+    }
+    std::vector<uint8_t> affected(result.upperBound(), 0);
+    for (node u = 0; u < z; ++u) {
+        if (!endpoint[u] || result[u] == none)
+            continue;
+        affected[result[u]] = 1;
+        if (!G->hasNode(u))
+            result.remove(u);
+    }
+
+    std::vector<std::vector<node>> activePerThread(omp_get_max_threads());
+    G->parallelForNodes([&](node u) {
+        if (endpoint[u] || affected[result[u]])
+            activePerThread[omp_get_thread_num()].push_back(u);
+    });
+    std::vector<node> active;
+    for (const auto &local : activePerThread)
+        active.insert(active.end(), local.begin(), local.end());
+
+    ParallelLeiden leiden(*G, std::move(result), std::move(active), 1, randomize, gamma);
+    leiden.run();
+    result = leiden.getPartition();
+}
+
+} // namespace NetworKit
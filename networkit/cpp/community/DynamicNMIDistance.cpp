@@ -5,6 +5,8 @@
  *      Author: Henning
  */
 
+#include <algorithm>
+
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/MissingMath.hpp>
 #include <networkit/auxiliary/NumericTools.hpp>
@@ -24,91 +26,14 @@ bool DynamicNMIDistance::isInBoth(node u, const Partition &oldClustering,
 /**
  * Formula follows Dhillon, Guan, Kulis: A Unified View of Kernel k-means, ...
  */
-double DynamicNMIDistance::getDissimilarity(const Graph &newGraph, const Partition &oldClustering,
-                                            const Partition &newClustering) {
-
-    INFO("compressing clusterings");
-    INFO("calculating dissimilarity");
-
-    auto log_b = Aux::MissingMath::log_b; // import convenient logarithm function
-
-    DEBUG("oldClustering=", oldClustering.getVector());
-    DEBUG("newClustering=", newClustering.getVector());
-
-    std::vector<count> size_old(oldClustering.upperBound());
-    std::vector<count> size_new(newClustering.upperBound());
-
-    // precompute sizes for each cluster
-    newGraph.forNodes([&](node u) {
-        if (isInBoth(u, oldClustering, newClustering)) {
-            index C = oldClustering[u];
-            index D = newClustering[u];
-            size_old[C]++;
-            size_new[D]++;
-        }
-    });
-
-    DEBUG("size_old=", size_old);
-    DEBUG("size_new=", size_new);
-
-    // confusion matrix
-    std::vector<std::vector<count>> confMatrix =
-        this->confusionMatrix(newGraph, oldClustering, newClustering);
-
-    auto numOverlap = [&](Matrix &confMatrix) {
-        count num = 0;
-        for (Matrix::iterator iter = confMatrix.begin(); iter != confMatrix.end(); ++iter) {
-            for (index i = 0; i < iter->size(); ++i) {
-                num += (*iter)[i];
-            }
-        }
-        return num;
-    };
-
-    count totalOverlap = numOverlap(confMatrix);
-    double numDouble = (double)totalOverlap;
-
-    double MI = 0.0; // mutual information
-    for (index C = 0; C < oldClustering.upperBound(); C++) {
-        for (index D = 0; D < newClustering.upperBound(); D++) {
-            count currOverlap = confMatrix[C][D];
-            if (currOverlap > 0) {
-                double factor1 = (double)currOverlap / (double)numDouble;
-                double nominator = (double)(currOverlap * numDouble);
-                double aggregate1 = (double)size_old[C];
-                double aggregate2 = (double)size_new[D];
-                double denom = aggregate1 * aggregate2;
-                DEBUG("frac: ", nominator, " / ", denom, " = ", nominator / denom);
-                double factor2 = log_b(nominator / denom, 2);
-                MI += factor1 * factor2;
-
-                DEBUG("contribution of ", C, " and ", D, ": ", factor1, " * ", factor2, " = ",
-                      factor1 * factor2);
-            }
-        }
-    }
-
-    // precompute cluster probabilities
-    std::vector<double> P_old(oldClustering.upperBound(), 0.0);
-    std::vector<double> P_new(newClustering.upperBound(), 0.0);
-#pragma omp parallel for
-    for (omp_index C = static_cast<omp_index>(oldClustering.lowerBound());
-         C < static_cast<omp_index>(oldClustering.upperBound()); ++C) {
-        P_old[C] = ((double)size_old[C]) / numDouble;
-    }
-#pragma omp parallel for
-    for (omp_index C = static_cast<omp_index>(newClustering.lowerBound());
-         C < static_cast<omp_index>(newClustering.upperBound()); ++C) {
-        P_new[C] = ((double)size_new[C]) / numDouble;
-    }
-
-    // sanity check
+double DynamicNMIDistance::getDissimilarity(const ContingencyTable &table) {
+    // mutual information; may be slightly negative due to rounding
+    const double MI = std::max(table.mutualInformation(), 0.0);
     assert(!std::isnan(MI));
-    assert(MI >= 0.0);
 
     // compute entropy for both clusterings
-    double H_old = entropy(oldClustering, totalOverlap, P_old);
-    double H_new = entropy(newClustering, totalOverlap, P_new);
+    double H_old = table.entropyOfFirst();
+    double H_new = table.entropyOfSecond();
 
     // calculate NMID:
     /* $NMI(\zeta,\eta):=\frac{2\cdot MI(\zeta,\eta)}{H(\zeta)+H\text{(\eta)}}$
@@ -0,0 +1,392 @@
+/*
+ * GraphPartitioner.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/coarsening/ParallelPartitionCoarsening.hpp>
+#include <networkit/community/CommunityWeights.hpp>
+#include <networkit/community/GraphPartitioner.hpp>
+
+namespace NetworKit {
+
+namespace {
+// Coarsening stops once the graph has at most contractionLimit * k nodes, or if a level removes
+// less than minShrinkage of the nodes.
+constexpr count contractionLimit = 160;
+constexpr double minShrinkage = 0.05;
+constexpr count clusteringIterations = 5;
+constexpr count refinementIterations = 5;
+constexpr count initialPartitioningAttempts = 8;
+
+// Moves a node of the given weight from block from to block to, unless the weight of to would
+// exceed maxWeight. Safe to call concurrently.
+bool tryMove(std::vector<count> &blockWeight, index from, index to, count weight,
+             count maxWeight) {
+    count newWeight;
+#pragma omp atomic capture
+    newWeight = blockWeight[to] += weight;
+    if (newWeight > maxWeight) {
+#pragma omp atomic
+        blockWeight[to] -= weight;
+        return false;
+    }
+#pragma omp atomic
+    blockWeight[from] -= weight;
+    return true;
+}
+
+// Size-constrained label propagation: each node joins the neighboring cluster it is most strongly
+// connected to, as long as the weight of the cluster stays at most maxWeight.
+std::vector<index> clusterNodes(const Graph &G, const std::vector<count> &weights,
+                                count maxWeight) {
+    std::vector<index> cluster(G.upperNodeIdBound());
+    std::iota(cluster.begin(), cluster.end(), 0);
+    std::vector<count> clusterWeight(weights);
+    std::vector<CommunityWeights> connections(omp_get_max_threads());
+    std::vector<count> moved(omp_get_max_threads());
+
+    for (count iteration = 0; iteration < clusteringIterations; ++iteration) {
+        std::fill(moved.begin(), moved.end(), 0);
+        G.balancedParallelForNodes([&](node u) {
+            const index tid = omp_get_thread_num();
+            auto &connection = connections[tid];
+            connection.clear();
+            G.forNeighborsOf(u, [&](node v, edgeweight w) {
+                if (v != u)
+                    connection.add(cluster[v], w);
+            });
+
+            const index current = cluster[u];
+            index best = current;
+            edgeweight bestWeight = connection[current];
+            connection.forEntries([&](index c, edgeweight w) {
+                if (w > bestWeight && clusterWeight[c] + weights[u] <= maxWeight) {
+                    best = c;
+                    bestWeight = w;
+                }
+            });
+
+            if (best != current && tryMove(clusterWeight, current, best, weights[u], maxWeight)) {
+                cluster[u] = best;
+                ++moved[tid];
+            }
+        });
+        if (std::accumulate(moved.begin(), moved.end(), count{0}) == 0)
+            break;
+    }
+
+    return cluster;
+}
+
+// Size-constrained label propagation refinement: moves the nodes in parallel to the adjacent block
+// that reduces the cut the most, as long as that block stays within maxWeight.
+void refine(const Graph &G, const std::vector<count> &weights, std::vector<index> &part,
+            std::vector<count> &blockWeight, count maxWeight) {
+    std::vector<CommunityWeights> connections(omp_get_max_threads());
+    std::vector<count> moved(omp_get_max_threads());
+
+    for (count iteration = 0; iteration < refinementIterations; ++iteration) {
+        std::fill(moved.begin(), moved.end(), 0);
+        G.balancedParallelForNodes([&](node u) {
+            const index tid = omp_get_thread_num();
+            auto &connection = connections[tid];
+            connection.clear();
+            G.forNeighborsOf(u, [&](node v, edgeweight w) {
+                if (v != u)
+                    connection.add(part[v], w);
+            });
+
+            const index current = part[u];
+            const edgeweight own = connection[current];
+            index best = current;
+            edgeweight bestGain = 0;
+            connection.forEntries([&](index b, edgeweight w) {
+                if (w - own > bestGain && blockWeight[b] + weights[u] <= maxWeight) {
+                    best = b;
+                    bestGain = w - own;
+                }
+            });
+
+            if (best != current && tryMove(blockWeight, current, best, weights[u], maxWeight)) {
+                part[u] = best;
+                ++moved[tid];
+            }
+        });
+        if (std::accumulate(moved.begin(), moved.end(), count{0}) == 0)
+            break;
+    }
+}
+
+// Moves nodes out of the blocks that are heavier than maxWeight, those with the smallest loss in
+// cut weight first. Returns false if this is not possible, e.g., because the nodes are too heavy.
+bool rebalance(const Graph &G, const std::vector<count> &weights, std::vector<index> &part,
+               std::vector<count> &blockWeight, count maxWeight) {
+    struct Candidate {
+        edgeweight gain;
+        node u;
+        index target;
+    };
+
+    auto isOverloaded = [&](index b) { return blockWeight[b] > maxWeight; };
+    std::vector<CommunityWeights> connections(omp_get_max_threads());
+    std::vector<std::vector<Candidate>> local(omp_get_max_threads());
+    std::vector<Candidate> candidates;
+
+    while (std::any_of(blockWeight.begin(), blockWeight.end(),
+                       [&](count w) { return w > maxWeight; })) {
+        // For each node in an overloaded block, the adjacent block with room that it is most
+        // strongly connected to; none means that any block with room is fine.
+        G.parallelForNodes([&](node u) {
+            if (weights[u] == 0 || !isOverloaded(part[u]))
+                return;
+            const index tid = omp_get_thread_num();
+            auto &connection = connections[tid];
+            connection.clear();
+            G.forNeighborsOf(u, [&](node v, edgeweight w) {
+                if (v != u)
+                    connection.add(part[v], w);
+            });
+
+            const edgeweight own = connection[part[u]];
+            Candidate candidate{-own, u, none};
+            connection.forEntries([&](index b, edgeweight w) {
+                if (w - own > candidate.gain && blockWeight[b] + weights[u] <= maxWeight) {
+                    candidate.gain = w - own;
+                    candidate.target = b;
+                }
+            });
+            local[tid].push_back(candidate);
+        });
+
+        candidates.clear();
+        for (auto &localCandidates : local) {
+            candidates.insert(candidates.end(), localCandidates.begin(), localCandidates.end());
+            localCandidates.clear();
+        }
+        Aux::Parallel::sort(candidates.begin(), candidates.end(),
+                            [&](const Candidate &a, const Candidate &b) {
+                                return std::tie(b.gain, weights[a.u], a.u)
+                                       < std::tie(a.gain, weights[b.u], b.u);
+                            });
+
+        bool moved = false;
+        index lightest =
+            std::min_element(blockWeight.begin(), blockWeight.end()) - blockWeight.begin();
+        for (const auto &candidate : candidates) {
+            const node u = candidate.u;
+            const index from = part[u];
+            if (!isOverloaded(from))
+                continue;
+
+            index to = candidate.target;
+            if (to == none || blockWeight[to] + weights[u] > maxWeight) {
+                if (blockWeight[lightest] + weights[u] > maxWeight)
+                    lightest = std::min_element(blockWeight.begin(), blockWeight.end())
+                               - blockWeight.begin();
+                to = lightest;
+            }
+            if (to == from || blockWeight[to] + weights[u] > maxWeight)
+                continue;
+
+            blockWeight[from] -= weights[u];
+            blockWeight[to] += weights[u];
+            part[u] = to;
+            moved = true;
+        }
+
+        if (!moved)
+            return false;
+    }
+
+    return true;
+}
+
+// Greedy graph growing: the blocks are grown one after another by breadth-first search from random
+// seed nodes until they reach their share of the total weight. Nodes that are left over, e.g.,
+// because they are too heavy for the block that reached them, go to the lightest block.
+std::vector<index> growBlocks(const Graph &G, const std::vector<count> &weights,
+                              std::vector<count> &blockWeight, count maxWeight) {
+    const count z = G.upperNodeIdBound();
+    const count k = blockWeight.size();
+    const count total = std::accumulate(weights.begin(), weights.end(), count{0});
+    const count target = (total + k - 1) / k;
+
+    std::vector<index> part(z, none);
+    std::vector<node> seeds(z);
+    std::iota(seeds.begin(), seeds.end(), 0);
+    std::shuffle(seeds.begin(), seeds.end(), Aux::Random::getURNG());
+    std::fill(blockWeight.begin(), blockWeight.end(), 0);
+
+    index nextSeed = 0;
+    for (index b = 0; b < k; ++b) {
+        std::queue<node> queue;
+        while (blockWeight[b] < target) {
+            if (queue.empty()) {
+                while (nextSeed < z && part[seeds[nextSeed]] != none)
+                    ++nextSeed;
+                if (nextSeed == z || blockWeight[b] + weights[seeds[nextSeed]] > maxWeight)
+                    break;
+                queue.push(seeds[nextSeed]);
+            }
+
+            const node u = queue.front();
+            queue.pop();
+            if (part[u] != none || blockWeight[b] + weights[u] > maxWeight)
+                continue;
+            part[u] = b;
+            blockWeight[b] += weights[u];
+            G.forNeighborsOf(u, [&](node v) {
+                if (part[v] == none)
+                    queue.push(v);
+            });
+        }
+    }
+
+    for (node u = 0; u < z; ++u) {
+        if (part[u] == none) {
+            const index lightest =
+                std::min_element(blockWeight.begin(), blockWeight.end()) - blockWeight.begin();
+            part[u] = lightest;
+            blockWeight[lightest] += weights[u];
+        }
+    }
+
+    return part;
+}
+
+edgeweight cutWeight(const Graph &G, const std::vector<index> &part) {
+    return G.parallelSumForEdges(
+        [&](node u, node v, edgeweight w) { return part[u] != part[v] ? w : 0.0; });
+}
+} // namespace
+
+GraphPartitioner::GraphPartitioner(const Graph &G, count k, double imbalance)
+    : CommunityDetectionAlgorithm(G), k(k), imbalance(imbalance) {
+    if (G.isDirected())
+        throw std::runtime_error("GraphPartitioner only supports undirected graphs.");
+    if (k == 0)
+        throw std::invalid_argument("The number of blocks must be positive.");
+    if (imbalance < 0)
+        throw std::invalid_argument("The imbalance must not be negative.");
+}
+
+void GraphPartitioner::run() {
+    hasRun = false;
+    Aux::SignalHandler handler;
+
+    const count n = G->numberOfNodes();
+    const count maxBlockWeight = static_cast<count>(
+        std::floor((1.0 + imbalance) * static_cast<double>((n + k - 1) / k)));
+
+    // The hierarchy of graphs: level 0 is G, level i + 1 is the contraction of level i according
+    // to maps[i]. weights[i][u] is the number of nodes of G that node u of level i represents.
+    std::vector<Graph> coarseGraphs;
+    std::vector<std::vector<node>> maps;
+    std::vector<std::vector<count>> weights(1, std::vector<count>(G->upperNodeIdBound(), 0));
+    G->parallelForNodes([&](node u) { weights[0][u] = 1; });
+    auto graphAt = [&](index level) -> const Graph & {
+        return level == 0 ? *G : coarseGraphs[level - 1];
+    };
+
+    // Keep clusters small enough that the coarsest graph can still be partitioned in balance.
+    const count kPrime = std::max<count>(2, std::min(k, n / contractionLimit));
+    const count maxClusterWeight =
+        std::max<count>(1, static_cast<count>(imbalance * static_cast<double>(n) / kPrime));
+
+    while (k > 1 && graphAt(maps.size()).numberOfNodes() > contractionLimit * k) {
+        handler.assureRunning();
+        const Graph &fine = graphAt(maps.size());
+
+        const Partition clustering(clusterNodes(fine, weights.back(), maxClusterWeight));
+        ParallelPartitionCoarsening coarsening(fine, clustering);
+        coarsening.run();
+        if (static_cast<double>(coarsening.getCoarseGraph().numberOfNodes())
+            > (1.0 - minShrinkage) * static_cast<double>(fine.numberOfNodes()))
+            break;
+
+        const auto &map = coarsening.getFineToCoarseNodeMapping();
+        const auto &fineWeights = weights.back();
+        std::vector<count> coarseWeights(coarsening.getCoarseGraph().upperNodeIdBound(), 0);
+#pragma omp parallel for
+        for (omp_index u = 0; u < static_cast<omp_index>(fineWeights.size()); ++u) {
+            if (fineWeights[u] > 0) {
+#pragma omp atomic
+                coarseWeights[map[u]] += fineWeights[u];
+            }
+        }
+
+        weights.push_back(std::move(coarseWeights));
+        maps.push_back(std::move(coarsening.getFineToCoarseNodeMapping()));
+        coarseGraphs.push_back(std::move(coarsening.getCoarseGraph()));
+    }
+
+    // Initial partitioning of the coarsest graph: keep the best of several attempts, preferring
+    // balanced partitions.
+    handler.assureRunning();
+    std::vector<index> part;
+    std::vector<count> blockWeight(k);
+    bool balanced = false;
+    {
+        const Graph &coarsest = graphAt(maps.size());
+        edgeweight bestCut = std::numeric_limits<edgeweight>::max();
+        bool bestBalanced = false;
+        std::vector<count> attemptBlockWeight(k);
+        const count attempts = k > 1 ? initialPartitioningAttempts : 1;
+        for (index attempt = 0; attempt < attempts; ++attempt) {
+            std::vector<index> attemptPart =
+                growBlocks(coarsest, weights.back(), attemptBlockWeight, maxBlockWeight);
+            const bool attemptBalanced = rebalance(coarsest, weights.back(), attemptPart,
+                                                   attemptBlockWeight, maxBlockWeight);
+            refine(coarsest, weights.back(), attemptPart, attemptBlockWeight, maxBlockWeight);
+            const edgeweight cut = cutWeight(coarsest, attemptPart);
+            if ((attemptBalanced && !bestBalanced)
+                || (attemptBalanced == bestBalanced && cut < bestCut)) {
+                part = std::move(attemptPart);
+                blockWeight = attemptBlockWeight;
+                bestCut = cut;
+                bestBalanced = attemptBalanced;
+            }
+        }
+        balanced = bestBalanced;
+    }
+
+    // Uncoarsening: project the partition to the next finer graph and refine it there.
+    for (index level = maps.size(); level-- > 0;) {
+        handler.assureRunning();
+        const auto &map = maps[level];
+        std::vector<index> finePart(map.size());
+#pragma omp parallel for
+        for (omp_index u = 0; u < static_cast<omp_index>(map.size()); ++u)
+            finePart[u] = part[map[u]];
+        part = std::move(finePart);
+
+        balanced = rebalance(graphAt(level), weights[level], part, blockWeight, maxBlockWeight);
+        refine(graphAt(level), weights[level], part, blockWeight, maxBlockWeight);
+    }
+
+    // On G, all nodes have unit weight, so the blocks can always be balanced.
+    if (!balanced)
+        throw std::runtime_error("GraphPartitioner failed to balance the blocks.");
+
+    result = Partition(G->upperNodeIdBound());
+    G->parallelForNodes([&](node u) { result[u] = part[u]; });
+    result.setUpperBound(k);
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
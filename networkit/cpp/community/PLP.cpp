@@ -5,16 +5,31 @@
  *      Author: Christian Staudt
  */
 
+#include <algorithm>
+#include <atomic>
 #include <omp.h>
 
 #include <networkit/Globals.hpp>
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/Random.hpp>
 #include <networkit/auxiliary/Timer.hpp>
+#include <networkit/community/CommunityWeights.hpp>
 #include <networkit/community/PLP.hpp>
 
 namespace NetworKit {
 
+namespace {
+// Minimum total degree of the active nodes that are processed as one chunk.
+constexpr count minChunkWork = 4096;
+
+// SplitMix64 finalizer
+uint64_t mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+} // namespace
+
 PLP::PLP(const Graph &G, count theta, count maxIterations)
     : CommunityDetectionAlgorithm(G), updateThreshold(theta), maxIterations(maxIterations) {}
 
@@ -60,50 +75,127 @@ void PLP::run() {
      * iteration.
      */
 
-    std::vector<bool> activeNodes(z, true); // record if node must be processed
+    // The frontier holds the active nodes; nodes are added to the next frontier at most once,
+    // guarded by a bitmap.
+    std::vector<node> frontier;
+    frontier.reserve(n);
+    G->forNodes([&](node v) {
+        if (G->degree(v) > 0) // isolated nodes stay singletons
+            frontier.push_back(v);
+    });
+    std::vector<std::atomic<uint64_t>> inNext((z + 63) / 64);
+    std::vector<std::vector<node>> nextPerThread(omp_get_max_threads());
+    std::vector<index> workBegin;
+    std::vector<label> proposed(deterministic ? z : 0);
+
+    auto activate = [&](node u, std::vector<node> &next) {
+        const uint64_t bit = uint64_t{1} << (u & 63);
+        if (!(inNext[u >> 6].load(std::memory_order_relaxed) & bit)
+            && !(inNext[u >> 6].fetch_or(bit, std::memory_order_relaxed) & bit))
+            next.push_back(u);
+    };
+
+    // Deterministic mode: half of an iteration a node belongs to, and priority of a label in
+    // case of ties (smaller wins).
+    auto halfOf = [&](node v) -> int { return mix(seed ^ mix(nIterations * z + v)) & 1; };
+    auto tiePriority = [&](label l) -> uint64_t {
+        return deterministic ? mix(seed ^ mix(l + 1)) : static_cast<uint64_t>(l);
+    };
 
     Aux::Timer runtime;
 
     // propagate labels
     // as long as a label has changed... or maximum iterations reached
-    while ((nUpdated > this->updateThreshold) && (nIterations < maxIterations)) {
+    while (!frontier.empty() && nUpdated > this->updateThreshold && nIterations < maxIterations) {
         runtime.start();
         nIterations += 1;
-        DEBUG("[BEGIN] LabelPropagation: iteration #", nIterations);
+        DEBUG("[BEGIN] LabelPropagation: iteration #", nIterations, ", ", frontier.size(),
+              " active nodes");
 
         // reset updated
         nUpdated = 0;
 
-        G->balancedParallelForNodes([&](node v) {
-            if (!activeNodes[v] || G->degree(v) == 0)
-                return; // node is isolated
-
-            // neighborLabelCounts maps label -> frequency in the neighbors
-            std::map<label, double> labelWeights;
-
-            // weigh the labels in the neighborhood of v
-            G->forNeighborsOf(v, [&](node w, edgeweight weight) {
-                label lw = result.subsetOf(w);
-                labelWeights[lw] += weight; // add weight of edge {v, w}
-            });
-
-            // get heaviest label
-            label heaviest = std::max_element(labelWeights.begin(), labelWeights.end(),
-                                              [](const std::pair<label, edgeweight> &p1,
-                                                 const std::pair<label, edgeweight> &p2) {
-                                                  return p1.second < p2.second;
-                                              })
-                                 ->first;
-
-            if (result.subsetOf(v) != heaviest) { // UPDATE
-                result.moveToSubset(heaviest, v); // result[v] = heaviest;
-#pragma omp atomic
-                nUpdated += 1;
-                G->forNeighborsOf(v, [&](node u) { activeNodes[u] = true; });
-            } else {
-                activeNodes[v] = false;
+        // Chunks of roughly equal total degree; node i belongs to chunk workBegin[i] / chunkWork.
+        workBegin.resize(frontier.size() + 1);
+        workBegin[0] = 0;
+        for (index i = 0; i < frontier.size(); ++i)
+            workBegin[i + 1] = workBegin[i] + G->degree(frontier[i]) + 1;
+        const count chunkWork =
+            std::max<count>(minChunkWork, workBegin.back() / (16 * omp_get_max_threads()));
+        const count numChunks = (workBegin.back() + chunkWork - 1) / chunkWork;
+
+        for (int half = 0; half < (deterministic ? 2 : 1); ++half) {
+#pragma omp parallel reduction(+ : nUpdated)
+            {
+                auto &next = nextPerThread[omp_get_thread_num()];
+                // labelWeights maps label -> weight of the edges to the neighbors with this label
+                CommunityWeights labelWeights;
+#pragma omp for schedule(dynamic, 1)
+                for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+                    const auto frontierEnd = workBegin.begin() + frontier.size();
+                    const index first =
+                        std::lower_bound(workBegin.begin(), frontierEnd, c * chunkWork)
+                        - workBegin.begin();
+                    const index last =
+                        std::lower_bound(workBegin.begin(), frontierEnd, (c + 1) * chunkWork)
+                        - workBegin.begin();
+
+                    for (index i = first; i < last; ++i) {
+                        const node v = frontier[i];
+                        if (deterministic && halfOf(v) != half)
+                            continue;
+
+                        // weigh the labels in the neighborhood of v
+                        labelWeights.clear();
+                        G->forNeighborsOf(v, [&](node w, edgeweight weight) {
+                            labelWeights.add(result[w], weight); // add weight of edge {v, w}
+                        });
+
+                        // get heaviest label
+                        label heaviest = none;
+                        double maxWeight = -1;
+                        labelWeights.forEntries([&](label l, double weight) {
+                            if (weight > maxWeight
+                                || (weight == maxWeight && tiePriority(l) < tiePriority(heaviest))) {
+                                heaviest = l;
+                                maxWeight = weight;
+                            }
+                        });
+
+                        if (deterministic)
+                            proposed[v] = heaviest;
+                        if (result[v] != heaviest) { // UPDATE
+                            if (!deterministic)
+                                result[v] = heaviest;
+                            nUpdated += 1;
+                            // Neighbors that already have the new label stay as they are
+                            G->forNeighborsOf(v, [&](node u) {
+                                if (u != v && result[u] != heaviest)
+                                    activate(u, next);
+                            });
+                        }
+                    }
+                }
             }
-        });
+
+            if (deterministic) {
+#pragma omp parallel for
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i)
+                    if (halfOf(frontier[i]) == half)
+                        result[frontier[i]] = proposed[frontier[i]];
+            }
+        }
+
+        frontier.clear();
+        for (auto &next : nextPerThread) {
+            frontier.insert(frontier.end(), next.begin(), next.end());
+            next.clear();
+        }
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+            const node u = frontier[i];
+            inNext[u >> 6].fetch_and(~(uint64_t{1} << (u & 63)), std::memory_order_relaxed);
+        }
 
         // for each while loop iteration...
 
@@ -120,6 +212,11 @@ void PLP::setUpdateThreshold(count th) {
     this->updateThreshold = th;
 }
 
+void PLP::setDeterministic(bool deterministic, uint64_t seed) {
+    this->deterministic = deterministic;
+    this->seed = seed;
+}
+
 count PLP::numberOfIterations() {
     assureFinished();
     return this->nIterations;
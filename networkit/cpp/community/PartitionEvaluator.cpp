@@ -0,0 +1,265 @@
+/*
+ * PartitionEvaluator.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/community/PartitionEvaluator.hpp>
+
+namespace NetworKit {
+
+namespace {
+// Sums of a cluster, or the contribution of a single node to its cluster.
+struct ClusterAccumulator {
+    count size = 0;
+    count intraEdges = 0; // intra-cluster edges, counted from both ends
+    count maxInternalDegree = 0;
+    edgeweight intraWeight = 0; // intra-cluster edge weight, counted from both ends
+    edgeweight cutWeight = 0;
+    edgeweight volume = 0;
+};
+
+void add(ClusterAccumulator &sum, const ClusterAccumulator &acc) {
+    sum.size += acc.size;
+    sum.intraEdges += acc.intraEdges;
+    sum.maxInternalDegree = std::max(sum.maxInternalDegree, acc.maxInternalDegree);
+    sum.intraWeight += acc.intraWeight;
+    sum.cutWeight += acc.cutWeight;
+    sum.volume += acc.volume;
+}
+} // namespace
+
+PartitionEvaluator::PartitionEvaluator(const Graph &G, const Partition &zeta)
+    : G(&G), zeta(&zeta) {
+    if (G.isDirected())
+        throw std::runtime_error("PartitionEvaluator only supports undirected graphs.");
+}
+
+void PartitionEvaluator::run() {
+    hasRun = false;
+
+    Aux::SignalHandler handler;
+
+    const count z = G->upperNodeIdBound();
+    const index k = zeta->upperBound();
+    const Partition &P = *zeta;
+
+    // Union-find over all edges, for the connected components of G. Roots are linked to the
+    // smaller root, so parents only decrease and paths can be halved concurrently.
+    std::vector<std::atomic<node>> parent(z);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        parent[u].store(u, std::memory_order_relaxed);
+
+    auto find = [&](node u) {
+        node p = parent[u].load(std::memory_order_relaxed);
+        while (p != u) {
+            const node grandParent = parent[p].load(std::memory_order_relaxed);
+            if (grandParent != p)
+                parent[u].compare_exchange_weak(p, grandParent, std::memory_order_relaxed);
+            u = p;
+            p = parent[u].load(std::memory_order_relaxed);
+        }
+        return u;
+    };
+
+    auto unite = [&](node u, node v) {
+        while (true) {
+            u = find(u);
+            v = find(v);
+            if (u == v)
+                return;
+            if (u < v)
+                std::swap(u, v);
+            node expected = u;
+            if (parent[u].compare_exchange_strong(expected, v, std::memory_order_relaxed))
+                return;
+        }
+    };
+
+    // The contribution of a single node to its cluster
+    auto evaluateNode = [&](node u) {
+        const index c = P[u];
+        ClusterAccumulator acc;
+        acc.size = 1;
+        G->forNeighborsOf(u, [&](node v, edgeweight w) {
+            // self-loops count twice, as in the volume used by Modularity
+            const count multiplicity = (u == v) ? 2 : 1;
+            acc.volume += multiplicity * w;
+            if (P[v] == c) {
+                ++acc.maxInternalDegree;
+                acc.intraEdges += multiplicity;
+                acc.intraWeight += multiplicity * w;
+            } else {
+                acc.cutWeight += w;
+            }
+            if (v < u)
+                unite(u, v);
+        });
+        return acc;
+    };
+
+    // Each thread sums up the contributions of its nodes. If there are few clusters, it uses
+    // one accumulator per cluster, which are summed up afterwards. Otherwise, it buckets the
+    // contributions by ranges of clusters, and each thread sums up one range from all threads,
+    // so the memory stays in O(n + k).
+    std::vector<ClusterAccumulator> sums(k);
+    const bool dense =
+        k * static_cast<count>(omp_get_max_threads()) <= std::max<count>(G->numberOfNodes(), 1);
+    std::vector<std::vector<ClusterAccumulator>> accumulators;
+    std::vector<std::vector<std::vector<std::pair<index, ClusterAccumulator>>>> buckets;
+
+#pragma omp parallel
+    {
+        const auto numThreads = static_cast<count>(omp_get_num_threads());
+        const auto tid = static_cast<index>(omp_get_thread_num());
+#pragma omp single
+        {
+            if (dense)
+                accumulators.assign(numThreads, std::vector<ClusterAccumulator>(k));
+            else
+                buckets.assign(numThreads, decltype(buckets)::value_type(numThreads));
+        }
+
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+            const node u = static_cast<node>(i);
+            if (!G->hasNode(u) || P[u] == none)
+                continue;
+
+            const ClusterAccumulator acc = evaluateNode(u);
+            if (dense)
+                add(accumulators[tid][P[u]], acc);
+            else
+                buckets[tid][P[u] * numThreads / k].emplace_back(P[u], acc);
+        }
+
+        if (dense) {
+#pragma omp for
+            for (omp_index c = 0; c < static_cast<omp_index>(k); ++c) {
+                for (const auto &local : accumulators)
+                    add(sums[c], local[c]);
+            }
+        } else {
+            for (const auto &local : buckets) {
+                for (const auto &[c, acc] : local[tid])
+                    add(sums[c], acc);
+            }
+        }
+    }
+    accumulators.clear();
+    buckets.clear();
+
+    handler.assureRunning();
+
+    result = PartitionQuality{};
+    result.clusterSizes.resize(k);
+    result.intraClusterWeights.resize(k);
+    result.cutWeights.resize(k);
+    result.volumes.resize(k);
+    result.conductances.resize(k);
+    result.intrapartitionDensities.resize(k);
+    result.hubDominances.resize(k);
+    result.fragmentations.resize(k);
+    std::vector<count> intraEdges(k), maxInternalDegree(k);
+
+    edgeweight totalVolume = 0;
+#pragma omp parallel for reduction(+ : totalVolume)
+    for (omp_index c = 0; c < static_cast<omp_index>(k); ++c) {
+        const ClusterAccumulator &sum = sums[c];
+        result.clusterSizes[c] = sum.size;
+        result.intraClusterWeights[c] = sum.intraWeight / 2;
+        result.cutWeights[c] = sum.cutWeight;
+        result.volumes[c] = sum.volume;
+        intraEdges[c] = sum.intraEdges / 2;
+        maxInternalDegree[c] = sum.maxInternalDegree;
+        totalVolume += sum.volume;
+    }
+    sums.clear();
+
+    const edgeweight totalWeight = totalVolume / 2;
+    if (totalWeight == 0)
+        throw std::invalid_argument(
+            "Partition quality is undefined for graphs without edges (including self-loops).");
+
+    handler.assureRunning();
+
+    // Sizes of the intersections of the clusters with the connected components
+    std::vector<std::pair<index, node>> fragments;
+    fragments.reserve(G->numberOfNodes());
+    G->forNodes([&](node u) {
+        if (P[u] != none)
+            fragments.emplace_back(P[u], find(u));
+    });
+    Aux::Parallel::sort(fragments.begin(), fragments.end());
+
+    std::vector<count> largestFragment(k);
+    for (index i = 0, j = 0; i < fragments.size(); i = j) {
+        while (j < fragments.size() && fragments[j] == fragments[i])
+            ++j;
+        auto &largest = largestFragment[fragments[i].first];
+        largest = std::max(largest, j - i);
+    }
+
+    handler.assureRunning();
+
+    count numberOfClusters = 0, intraEdgesSum = 0, possibleIntraEdgesSum = 0;
+    edgeweight intraWeightSum = 0, cutWeightSum = 0;
+    double expectedCoverage = 0, maxConductance = 0, hubDominanceSum = 0, fragmentationSum = 0;
+
+#pragma omp parallel for reduction(+ : numberOfClusters, intraEdgesSum, possibleIntraEdgesSum,   \
+                                       intraWeightSum, cutWeightSum, expectedCoverage,          \
+                                       hubDominanceSum, fragmentationSum)                       \
+    reduction(max : maxConductance)
+    for (omp_index c = 0; c < static_cast<omp_index>(k); ++c) {
+        const count size = result.clusterSizes[c];
+        if (size == 0)
+            continue;
+
+        ++numberOfClusters;
+        intraWeightSum += result.intraClusterWeights[c];
+        cutWeightSum += result.cutWeights[c];
+        const double volumeFraction = result.volumes[c] / totalWeight;
+        expectedCoverage += volumeFraction * volumeFraction / 4;
+
+        const edgeweight denominator = std::min(result.volumes[c], totalVolume - result.volumes[c]);
+        if (denominator > 0)
+            result.conductances[c] = result.cutWeights[c] / denominator;
+        maxConductance = std::max(maxConductance, result.conductances[c]);
+
+        const count possibleEdges = size * (size - 1) / 2;
+        result.intrapartitionDensities[c] =
+            possibleEdges > 0 ? static_cast<double>(intraEdges[c]) / possibleEdges : 1.0;
+        intraEdgesSum += intraEdges[c];
+        possibleIntraEdgesSum += possibleEdges;
+
+        result.hubDominances[c] =
+            size > 1 ? static_cast<double>(maxInternalDegree[c]) / (size - 1) : 1.0;
+        hubDominanceSum += result.hubDominances[c];
+
+        result.fragmentations[c] = 1.0 - static_cast<double>(largestFragment[c]) / size;
+        fragmentationSum += result.fragmentations[c];
+    }
+
+    result.numberOfClusters = numberOfClusters;
+    result.coverage = intraWeightSum / totalWeight;
+    result.modularity = result.coverage - expectedCoverage;
+    result.edgeCut = cutWeightSum / 2; // cut edges are counted from both ends
+    result.conductance = maxConductance;
+    result.intrapartitionDensity = static_cast<double>(intraEdgesSum) / possibleIntraEdgesSum;
+    result.hubDominance = hubDominanceSum / numberOfClusters;
+    result.fragmentation = fragmentationSum / numberOfClusters;
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
@@ -5,20 +5,28 @@
  *      Author: cls
  */
 
+#include <map>
+
 #include <gtest/gtest.h>
 
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/auxiliary/Parallelism.hpp>
+#include <networkit/community/AdjustedRandMeasure.hpp>
 #include <networkit/community/ClusteringGenerator.hpp>
+#include <networkit/community/Conductance.hpp>
+#include <networkit/community/ContingencyTable.hpp>
 #include <networkit/community/CoverF1Similarity.hpp>
 #include <networkit/community/Coverage.hpp>
+#include <networkit/community/DynLeiden.hpp>
 #include <networkit/community/DynamicNMIDistance.hpp>
 #include <networkit/community/EdgeCut.hpp>
 #include <networkit/community/GraphClusteringTools.hpp>
+#include <networkit/community/GraphPartitioner.hpp>
 #include <networkit/community/GraphStructuralRandMeasure.hpp>
 #include <networkit/community/HubDominance.hpp>
 #include <networkit/community/IntrapartitionDensity.hpp>
+#include <networkit/community/IsolatedInterpartitionConductance.hpp>
 #include <networkit/community/JaccardMeasure.hpp>
 #include <networkit/community/LFM.hpp>
 #include <networkit/community/Modularity.hpp>
@@ -29,6 +37,7 @@
 #include <networkit/community/PLP.hpp>
 #include <networkit/community/ParallelAgglomerativeClusterer.hpp>
 #include <networkit/community/ParallelLeiden.hpp>
+#include <networkit/community/PartitionEvaluator.hpp>
 #include <networkit/community/PartitionFragmentation.hpp>
 #include <networkit/community/PartitionIntersection.hpp>
 #include <networkit/community/SampledGraphStructuralRandMeasure.hpp>
@@ -37,6 +46,7 @@
 #include <networkit/generators/DynamicBarabasiAlbertGenerator.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
 #include <networkit/generators/LFRGenerator.hpp>
+#include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 #include <networkit/overlap/HashingOverlapper.hpp>
 #include <networkit/scd/LocalTightnessExpansion.hpp>
@@ -146,6 +156,30 @@ TEST_F(CommunityGTest, testLabelPropagationOnManySmallClusters) {
         << "Can LabelPropagation detect the reference clustering?";
 }
 
+TEST_F(CommunityGTest, testLabelPropagationDeterministic) {
+    Aux::Random::setSeed(42, false);
+    ClusteredRandomGraphGenerator graphGen(2000, 20, 0.3, 0.01);
+    Graph G = graphGen.generate();
+
+    const int maxThreads = Aux::getMaxNumberOfThreads();
+    auto runPLP = [&](int threads, uint64_t seed) {
+        Aux::setNumberOfThreads(threads);
+        PLP lp(G);
+        lp.setDeterministic(true, seed);
+        lp.run();
+        Aux::setNumberOfThreads(maxThreads);
+        return lp.getPartition();
+    };
+
+    const Partition zeta = runPLP(1, 7);
+    EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+    EXPECT_GT(Modularity().getQuality(zeta, G), 0.5);
+    for (int threads : {2, 4}) {
+        const Partition other = runPLP(threads, 7);
+        G.forNodes([&](node u) { EXPECT_EQ(zeta[u], other[u]); });
+    }
+}
+
 TEST_F(CommunityGTest, testPLM) {
     METISGraphReader reader;
     Modularity modularity;
@@ -174,7 +208,6 @@ TEST_F(CommunityGTest, testParallelLeiden) {
     Graph G = reader.read("input/caidaRouterLevel.graph");
 
     ParallelLeiden pl(G);
-    pl.VECTOR_OVERSIZE = 1;
     pl.run();
     Partition zeta = pl.getPartition();
 
@@ -191,6 +224,81 @@ TEST_F(CommunityGTest, testParallelLeiden) {
     EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta2));
 }
 
+TEST_F(CommunityGTest, testParallelLeidenClusteredGraph) {
+    Aux::Random::setSeed(42, false);
+    Modularity modularity;
+    ClusteredRandomGraphGenerator gen(2000, 20, 0.2, 0.002);
+    Graph G = gen.generate();
+
+    PLM plm(G, true);
+    plm.run();
+    const double plmModularity = modularity.getQuality(plm.getPartition(), G);
+
+    for (bool randomize : {true, false}) {
+        ParallelLeiden pl(G, 3, randomize);
+        pl.run();
+        Partition zeta = pl.getPartition();
+        EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+        // Leiden aggregates the graph, so it should find the planted clusters like PLM does
+        EXPECT_GE(modularity.getQuality(zeta, G), 0.98 * plmModularity);
+        EXPECT_LE(zeta.numberOfSubsets(), 40);
+    }
+}
+
+TEST_F(CommunityGTest, testDynLeiden) {
+    Aux::Random::setSeed(42, false);
+    Modularity modularity;
+    Graph G = ClusteredRandomGraphGenerator(3000, 30, 0.1, 0.001).generate();
+
+    DynLeiden dyn(G);
+    dyn.run();
+
+    for (int round = 0; round < 3; ++round) {
+        // Change about 1% of the edges, and add and remove a node
+        std::vector<GraphEvent> batch;
+        for (count i = 0; i < G.numberOfEdges() / 200; ++i) {
+            const auto [u, v] = GraphTools::randomEdge(G);
+            G.removeEdge(u, v);
+            batch.emplace_back(GraphEvent::EDGE_REMOVAL, u, v);
+        }
+        for (count i = 0; i < G.numberOfEdges() / 200; ++i) {
+            const node u = GraphTools::randomNode(G), v = GraphTools::randomNode(G);
+            if (u != v && !G.hasEdge(u, v)) {
+                G.addEdge(u, v);
+                batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v);
+            }
+        }
+        const node x = G.addNode();
+        batch.emplace_back(GraphEvent::NODE_ADDITION, x);
+        const node y = GraphTools::randomNode(G);
+        G.addEdge(x, y);
+        batch.emplace_back(GraphEvent::EDGE_ADDITION, x, y);
+        const node r = GraphTools::randomNode(G);
+        G.forNeighborsOf(r, [&](node w) { batch.emplace_back(GraphEvent::EDGE_REMOVAL, r, w); });
+        G.removeNode(r);
+        batch.emplace_back(GraphEvent::NODE_REMOVAL, r);
+
+        dyn.updateBatch(batch);
+        const Partition &zeta = dyn.getPartition();
+        EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+        EXPECT_EQ(zeta[r], none);
+
+        ParallelLeiden full(G);
+        full.run();
+        EXPECT_GE(modularity.getQuality(zeta, G),
+                  0.98 * modularity.getQuality(full.getPartition(), G));
+    }
+
+    // Warm start from a given partition
+    DynLeiden warm(G, dyn.getPartition());
+    const node u = GraphTools::randomNode(G), v = GraphTools::randomNode(G);
+    if (!G.hasEdge(u, v)) {
+        G.addEdge(u, v);
+        warm.update(GraphEvent(GraphEvent::EDGE_ADDITION, u, v));
+        EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, warm.getPartition()));
+    }
+}
+
 TEST_F(CommunityGTest, testDeletedNodesPLM) {
     METISGraphReader reader;
     Modularity modularity;
@@ -417,6 +525,79 @@ TEST_F(CommunityGTest, testNMIDistance) {
     EXPECT_LE(0.0, distSingleIntersection) << "NMID always needs to be 0 or positive";
 }
 
+TEST_F(CommunityGTest, testContingencyTable) {
+    // large enough for a bucket that is sorted in parallel
+    const count n = 200000;
+    Graph G(n);
+    G.removeNode(7);
+
+    Aux::Random::setSeed(42, false);
+    Partition reference(n);
+    reference.setUpperBound(1000);
+    for (node u = 0; u < n; ++u)
+        reference[u] = (u % 3 == 0) ? 0 : Aux::Random::integer(999);
+    reference[11] = none;
+
+    std::vector<Partition> candidates;
+    for (count k : {1, 50, 5000}) {
+        Partition candidate(n);
+        candidate.setUpperBound(k);
+        for (node u = 0; u < n; ++u)
+            candidate[u] = Aux::Random::integer(k - 1);
+        candidates.push_back(std::move(candidate));
+    }
+    candidates.back()[13] = none;
+
+    for (const auto &candidate : candidates) {
+        std::map<std::pair<index, index>, count> expected;
+        count elements = 0;
+        G.forNodes([&](node u) {
+            if (reference[u] != none && candidate[u] != none) {
+                ++expected[{reference[u], candidate[u]}];
+                ++elements;
+            }
+        });
+
+        ContingencyTable table(G, reference, candidate);
+        EXPECT_EQ(table.numberOfElements(), elements);
+        EXPECT_EQ(table.numberOfEntries(), expected.size());
+        auto it = expected.begin();
+        table.forEntries([&](index C, index D, count size) {
+            ASSERT_NE(it, expected.end());
+            EXPECT_EQ(it->first, std::make_pair(C, D));
+            EXPECT_EQ(it->second, size);
+            ++it;
+        });
+
+        count firstSum = 0;
+        for (count size : table.getFirstSizes())
+            firstSum += size;
+        EXPECT_EQ(firstSum, elements);
+        count secondSum = 0;
+        for (count size : table.getSecondSizes())
+            secondSum += size;
+        EXPECT_EQ(secondSum, elements);
+    }
+
+    // Batch comparison gives the same results as separate ones
+    NMIDistance nmi;
+    AdjustedRandMeasure adjustedRand;
+    JaccardMeasure jaccard;
+    NodeStructuralRandMeasure rand;
+    for (ContingencyDissimilarityMeasure *measure :
+         std::initializer_list<ContingencyDissimilarityMeasure *>{&nmi, &adjustedRand, &jaccard,
+                                                                  &rand}) {
+        const auto batch = measure->getDissimilarities(G, reference, candidates);
+        ASSERT_EQ(batch.size(), candidates.size());
+        for (index i = 0; i < candidates.size(); ++i)
+            EXPECT_NEAR(batch[i], measure->getDissimilarity(G, reference, candidates[i]), 1e-9);
+    }
+
+    // NMI distance of the 1-clustering and a 50-clustering of the same nodes is 1
+    EXPECT_NEAR(nmi.getDissimilarity(G, candidates[0], candidates[1]), 1.0, 1e-9);
+    EXPECT_NEAR(nmi.getDissimilarity(G, candidates[1], candidates[1]), 0.0, 1e-9);
+}
+
 TEST_F(CommunityGTest, testSampledRandMeasures) {
     count n = 42;
     // make complete graph
@@ -650,6 +831,77 @@ TEST_F(CommunityGTest, testPartitionFragmentation) {
     EXPECT_DOUBLE_EQ(0.9, frag3.getWeightedAverage());
 }
 
+TEST_F(CommunityGTest, testPartitionEvaluator) {
+    Aux::Random::setSeed(42, false);
+    ClusteredRandomGraphGenerator gen(300, 6, 0.05, 0.002);
+    Graph G = GraphTools::toWeighted(gen.generate());
+    G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::real(0.5, 2)); });
+    for (node u = 0; u < G.numberOfNodes(); u += 17)
+        G.addEdge(u, u, 1.5);
+    G.removeNode(5);
+
+    Partition P = gen.getCommunities();
+    P.setUpperBound(P.upperBound() + 1); // leave a cluster empty
+    for (node u = 0; u < G.upperNodeIdBound(); u += 11)
+        P[u] = Aux::Random::integer(5);
+
+    PartitionEvaluator evaluator(G, P);
+    evaluator.run();
+    const auto &result = evaluator.getResult();
+
+    EXPECT_NEAR(result.modularity, Modularity().getQuality(P, G), 1e-9);
+    EXPECT_NEAR(result.coverage, Coverage().getQuality(P, G), 1e-9);
+    EXPECT_NEAR(result.edgeCut, EdgeCut().getQuality(P, G), 1e-9);
+    EXPECT_NEAR(result.hubDominance, HubDominance().getQuality(P, G), 1e-9);
+    EXPECT_EQ(result.numberOfClusters, P.numberOfSubsets());
+
+    IntrapartitionDensity density(G, P);
+    density.run();
+    EXPECT_NEAR(result.intrapartitionDensity, density.getGlobal(), 1e-9);
+    PartitionFragmentation fragmentation(G, P);
+    fragmentation.run();
+    EXPECT_NEAR(result.fragmentation, fragmentation.getUnweightedAverage(), 1e-9);
+    IsolatedInterpartitionConductance conductance(G, P);
+    conductance.run();
+    EXPECT_NEAR(result.conductance, conductance.getMaximumValue(), 1e-9);
+
+    for (index c = 0; c < 5; ++c) {
+        EXPECT_NEAR(result.intrapartitionDensities[c], density.getValue(c), 1e-9);
+        EXPECT_NEAR(result.fragmentations[c], fragmentation.getValue(c), 1e-9);
+        EXPECT_NEAR(result.conductances[c], conductance.getValue(c), 1e-9);
+    }
+    EXPECT_EQ(result.clusterSizes[6], 0);
+
+    // For 2-partitions, the conductance is the one of the cut
+    G.removeSelfLoops();
+    Partition bisection(G.upperNodeIdBound());
+    bisection.setUpperBound(2);
+    G.forNodes([&](node u) { bisection[u] = u % 2; });
+    PartitionEvaluator bisectionEvaluator(G, bisection);
+    bisectionEvaluator.run();
+    EXPECT_NEAR(bisectionEvaluator.getResult().conductance,
+                Conductance().getQuality(bisection, G), 1e-9);
+
+    // Many (mostly empty) clusters compared to the number of nodes
+    Partition fine(G.upperNodeIdBound());
+    fine.setUpperBound(4 * G.upperNodeIdBound());
+    G.forNodes([&](node u) { fine[u] = 4 * (u / 3); });
+    PartitionEvaluator fineEvaluator(G, fine);
+    fineEvaluator.run();
+    const auto &fineResult = fineEvaluator.getResult();
+    EXPECT_NEAR(fineResult.modularity, Modularity().getQuality(fine, G), 1e-9);
+    EXPECT_NEAR(fineResult.coverage, Coverage().getQuality(fine, G), 1e-9);
+    EXPECT_NEAR(fineResult.edgeCut, EdgeCut().getQuality(fine, G), 1e-9);
+    EXPECT_NEAR(fineResult.hubDominance, HubDominance().getQuality(fine, G), 1e-9);
+    EXPECT_EQ(fineResult.numberOfClusters, fine.numberOfSubsets());
+    IntrapartitionDensity fineDensity(G, fine);
+    fineDensity.run();
+    EXPECT_NEAR(fineResult.intrapartitionDensity, fineDensity.getGlobal(), 1e-9);
+    EXPECT_EQ(fineResult.clusterSizes[0], 3);
+    EXPECT_EQ(fineResult.clusterSizes[4], 2); // node 5 has been removed
+    EXPECT_EQ(fineResult.clusterSizes[5], 0);
+}
+
 TEST_F(CommunityGTest, testCoverF1Similarity) {
     count n = 20;
     Graph G(n);
@@ -844,4 +1096,56 @@ TEST_F(CommunityGTest, testLFM) {
     Aux::setNumberOfThreads(numThreads);
 }
 
+TEST_F(CommunityGTest, testGraphPartitioner) {
+    EXPECT_THROW(GraphPartitioner(Graph(10, false, true), 2), std::runtime_error);
+    EXPECT_THROW(GraphPartitioner(Graph(10), 0), std::invalid_argument);
+
+    Aux::Random::setSeed(42, false);
+    Graph G = METISGraphReader{}.read("input/PGPgiantcompo.graph");
+    G.removeNode(7);
+    const count n = G.numberOfNodes();
+    EdgeCut edgeCut;
+
+    for (const count k : {1, 2, 4, 16}) {
+        GraphPartitioner partitioner(G, k);
+        partitioner.run();
+        const Partition &P = partitioner.getPartition();
+
+        EXPECT_EQ(P.upperBound(), k);
+        EXPECT_EQ(P[7], none);
+        std::vector<count> sizes(k);
+        G.forNodes([&](node u) {
+            ASSERT_LT(P[u], k);
+            ++sizes[P[u]];
+        });
+        const count maxSize = static_cast<count>(1.03 * static_cast<double>((n + k - 1) / k));
+        for (const count size : sizes)
+            EXPECT_LE(size, maxSize);
+
+        // much better than distributing the nodes round-robin
+        Partition roundRobin(G.upperNodeIdBound());
+        roundRobin.setUpperBound(k);
+        G.forNodes([&](node u) { roundRobin[u] = u % k; });
+        EXPECT_LE(edgeCut.getQuality(P, G), 0.25 * edgeCut.getQuality(roundRobin, G));
+    }
+
+    // Disconnected cliques without any imbalance: nodes that do not fit into the block that
+    // reaches them have to be placed elsewhere.
+    Graph cliques(70);
+    for (node c = 0; c < 10; ++c) {
+        for (node u = 7 * c; u < 7 * (c + 1); ++u) {
+            for (node v = u + 1; v < 7 * (c + 1); ++v)
+                cliques.addEdge(u, v);
+        }
+    }
+    for (const count k : {3, 4, 7}) {
+        GraphPartitioner partitioner(cliques, k, 0.0);
+        partitioner.run();
+        std::vector<count> sizes(k);
+        cliques.forNodes([&](node u) { ++sizes[partitioner.getPartition()[u]]; });
+        for (const count size : sizes)
+            EXPECT_LE(size, (70 + k - 1) / k);
+    }
+}
+
 } /* namespace NetworKit */
@@ -0,0 +1,120 @@
+/*
+ * AfforestConnectedComponents.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <atomic>
+#include <random>
+#include <unordered_map>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/components/AfforestConnectedComponents.hpp>
+
+namespace NetworKit {
+
+namespace {
+// Number of nodes sampled to find the largest intermediate tree
+constexpr count numSamples = 1024;
+} // namespace
+
+AfforestConnectedComponents::AfforestConnectedComponents(const Graph &G, count neighborRounds)
+    : ComponentDecomposition(G), neighborRounds(neighborRounds) {
+    if (G.isDirected())
+        throw std::runtime_error("Error, connected components of directed graphs cannot be "
+                                 "computed, use StronglyConnectedComponents or "
+                                 "WeaklyConnectedComponents instead.");
+}
+
+void AfforestConnectedComponents::run() {
+    const count z = G->upperNodeIdBound();
+
+    // Parent pointers; roots are always the smallest node of their tree, so that trees only
+    // ever get linked from larger to smaller ids.
+    std::vector<std::atomic<node>> parent(z);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        parent[u].store(u, std::memory_order_relaxed);
+
+    auto link = [&](node u, node v) {
+        node p1 = parent[u].load(std::memory_order_relaxed);
+        node p2 = parent[v].load(std::memory_order_relaxed);
+        while (p1 != p2) {
+            const node high = std::max(p1, p2), low = std::min(p1, p2);
+            node pHigh = parent[high].load(std::memory_order_relaxed);
+            // Either high already points to low, or we are the ones to hook it.
+            if (pHigh == low
+                || (pHigh == high
+                    && parent[high].compare_exchange_strong(pHigh, low,
+                                                            std::memory_order_relaxed)))
+                break;
+            p1 = parent[parent[high].load(std::memory_order_relaxed)].load(
+                std::memory_order_relaxed);
+            p2 = parent[low].load(std::memory_order_relaxed);
+        }
+    };
+
+    auto compress = [&]() {
+#pragma omp parallel for schedule(static, 2048)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            node p = parent[u].load(std::memory_order_relaxed);
+            for (node pp = parent[p].load(std::memory_order_relaxed); p != pp;
+                 pp = parent[p].load(std::memory_order_relaxed)) {
+                p = pp;
+            }
+            parent[u].store(p, std::memory_order_relaxed);
+        }
+    };
+
+    // Link the first neighbors of every node.
+    for (index r = 0; r < neighborRounds; ++r) {
+        G->balancedParallelForNodes([&](node u) {
+            if (r < G->degree(u))
+                link(u, G->getIthNeighbor(u, r));
+        });
+        compress();
+    }
+
+    // Sample the root of the largest tree.
+    node largest = none;
+    if (G->numberOfNodes() > 0) {
+        std::mt19937_64 generator(Aux::Random::integer());
+        std::uniform_int_distribution<node> dist(0, z - 1);
+        std::unordered_map<node, count> frequency;
+        count maxFrequency = 0;
+        for (count i = 0; i < numSamples; ++i) {
+            node u;
+            do {
+                u = dist(generator);
+            } while (!G->hasNode(u));
+            const node root = parent[u].load(std::memory_order_relaxed);
+            if (++frequency[root] > maxFrequency) {
+                maxFrequency = frequency[root];
+                largest = root;
+            }
+        }
+    }
+
+    // Finish the remaining edges of nodes outside of the largest tree. Edges between the tree
+    // and other nodes are seen from the other endpoint.
+    G->balancedParallelForNodes([&](node u) {
+        if (parent[u].load(std::memory_order_relaxed) == largest)
+            return;
+        const count degree = G->degree(u);
+        for (index r = neighborRounds; r < degree; ++r)
+            link(u, G->getIthNeighbor(u, r));
+    });
+    compress();
+
+    // The roots are the smallest nodes of their components, so compacting numbers the
+    // components in increasing order of their smallest node.
+    component.reset(z, none);
+    G->parallelForNodes(
+        [&](node u) { component[u] = parent[u].load(std::memory_order_relaxed); });
+    component.setUpperBound(z);
+    component.compact(true);
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
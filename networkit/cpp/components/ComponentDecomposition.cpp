@@ -1,5 +1,8 @@
 
+#include <algorithm>
+
 #include <networkit/components/ComponentDecomposition.hpp>
+#include <networkit/graph/GraphTools.hpp>
 
 namespace NetworKit {
 
@@ -34,4 +37,27 @@ std::map<index, count> ComponentDecomposition::getComponentSizes() const {
     return component.subsetSizeMap();
 }
 
+Graph ComponentDecomposition::extractLargestComponent(const Graph &G, Partition components,
+                                                     bool compactGraph) {
+    // Number the components by their smallest node, max_element returns the first maximum.
+    components.compact(true);
+    const auto compSizes = components.subsetSizeMap();
+    if (compSizes.size() == 1) {
+        if (compactGraph && G.upperNodeIdBound() != G.numberOfNodes())
+            return GraphTools::getCompactedGraph(G, GraphTools::getContinuousNodeIds(G));
+        return G;
+    }
+
+    const auto largestIndex = std::max_element(compSizes.begin(), compSizes.end(),
+                                               [](const std::pair<index, count> &x,
+                                                  const std::pair<index, count> &y) -> bool {
+                                                   return x.second < y.second;
+                                               })
+                                  ->first;
+
+    const auto nodesInLargest = components.getMembers(largestIndex);
+    return GraphTools::subgraphFromNodes(G, nodesInLargest.begin(), nodesInLargest.end(),
+                                         compactGraph);
+}
+
 } // namespace NetworKit
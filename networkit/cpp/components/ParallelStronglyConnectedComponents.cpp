@@ -0,0 +1,351 @@
+/*
+ * ParallelStronglyConnectedComponents.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/components/ParallelStronglyConnectedComponents.hpp>
+
+namespace NetworKit {
+
+namespace {
+// Below this number of remaining nodes, coloring rounds are replaced by Tarjan's algorithm.
+constexpr count sequentialThreshold = 1 << 14;
+// A coloring round that assigns less than a 1/minProgress fraction of the remaining nodes is
+// the last one.
+constexpr count minProgress = 100;
+} // namespace
+
+ParallelStronglyConnectedComponents::ParallelStronglyConnectedComponents(const Graph &G)
+    : ComponentDecomposition(G) {
+
+    if (!G.isDirected())
+        WARN("The input graph is undirected, use ConnectedComponents for more efficiency.");
+}
+
+void ParallelStronglyConnectedComponents::run() {
+    const count z = G->upperNodeIdBound();
+    const int maxThreads = omp_get_max_threads();
+
+    // Some node of the component of each node, none while the node is still active. The backward
+    // searches read entries that other threads may write concurrently, hence the atomics.
+    std::vector<std::atomic<node>> rep(z);
+    std::vector<std::atomic<uint8_t>> active(z);
+    std::vector<node> remaining;
+    remaining.reserve(G->numberOfNodes());
+    for (node u = 0; u < z; ++u) {
+        rep[u].store(none, std::memory_order_relaxed);
+        active[u].store(G->hasNode(u), std::memory_order_relaxed);
+        if (G->hasNode(u))
+            remaining.push_back(u);
+    }
+
+    auto isActive = [&](node v) -> bool { return active[v].load(std::memory_order_relaxed); };
+
+    std::vector<std::vector<node>> perThread(maxThreads);
+    auto gather = [&](std::vector<node> &out) {
+        out.clear();
+        for (auto &local : perThread) {
+            out.insert(out.end(), local.begin(), local.end());
+            local.clear();
+        }
+    };
+
+    auto dropInactive = [&]() {
+#pragma omp parallel
+        {
+            auto &local = perThread[omp_get_thread_num()];
+#pragma omp for schedule(static)
+            for (omp_index i = 0; i < static_cast<omp_index>(remaining.size()); ++i)
+                if (isActive(remaining[i]))
+                    local.push_back(remaining[i]);
+        }
+        gather(remaining);
+    };
+
+    // Nodes without active in- or out-neighbors are components on their own. Removing them may
+    // create new such nodes, so they are peeled level by level.
+    std::vector<std::atomic<count>> inDeg(z), outDeg(z);
+    std::vector<node> frontier, next;
+    auto trim = [&]() {
+#pragma omp parallel for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(remaining.size()); ++i) {
+            const node v = remaining[i];
+            count in = 0, out = 0;
+            G->forNeighborsOf(v, [&](node w) { out += isActive(w); });
+            G->forInNeighborsOf(v, [&](node w) { in += isActive(w); });
+            inDeg[v].store(in, std::memory_order_relaxed);
+            outDeg[v].store(out, std::memory_order_relaxed);
+        }
+
+#pragma omp parallel
+        {
+            auto &local = perThread[omp_get_thread_num()];
+#pragma omp for schedule(static)
+            for (omp_index i = 0; i < static_cast<omp_index>(remaining.size()); ++i) {
+                const node v = remaining[i];
+                if (inDeg[v].load(std::memory_order_relaxed) == 0
+                    || outDeg[v].load(std::memory_order_relaxed) == 0)
+                    local.push_back(v);
+            }
+        }
+        gather(frontier);
+        for (const node v : frontier) {
+            active[v].store(0, std::memory_order_relaxed);
+            rep[v].store(v, std::memory_order_relaxed);
+        }
+
+        auto removeEdge = [&](std::atomic<count> &deg, node w, std::vector<node> &local) {
+            if (isActive(w) && deg.fetch_sub(1, std::memory_order_relaxed) == 1
+                && active[w].exchange(0, std::memory_order_relaxed)) {
+                rep[w].store(w, std::memory_order_relaxed);
+                local.push_back(w);
+            }
+        };
+
+        bool trimmed = false;
+        while (!frontier.empty()) {
+            trimmed = true;
+#pragma omp parallel if (frontier.size() > 256)
+            {
+                auto &local = perThread[omp_get_thread_num()];
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    const node v = frontier[i];
+                    G->forNeighborsOf(v, [&](node w) { removeEdge(inDeg[w], w, local); });
+                    G->forInNeighborsOf(v, [&](node w) { removeEdge(outDeg[w], w, local); });
+                }
+            }
+            gather(next);
+            std::swap(frontier, next);
+        }
+
+        if (trimmed)
+            dropInactive();
+    };
+
+    // Parallel level-synchronous search from source over active nodes accepted by allowed(v);
+    // reached nodes are marked and returned.
+    std::vector<std::atomic<uint8_t>> fwMark(z), bwMark(z);
+    auto reach = [&](node source, bool forward, std::vector<std::atomic<uint8_t>> &mark,
+                     auto allowed) {
+        std::vector<node> reached{source};
+        mark[source].store(1, std::memory_order_relaxed);
+        frontier.assign(1, source);
+        while (!frontier.empty()) {
+#pragma omp parallel if (frontier.size() > 256)
+            {
+                auto &local = perThread[omp_get_thread_num()];
+                auto visit = [&](node w) {
+                    if (isActive(w) && allowed(w) && !mark[w].load(std::memory_order_relaxed)
+                        && !mark[w].exchange(1, std::memory_order_relaxed))
+                        local.push_back(w);
+                };
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    if (forward)
+                        G->forNeighborsOf(frontier[i], visit);
+                    else
+                        G->forInNeighborsOf(frontier[i], visit);
+                }
+            }
+            gather(next);
+            reached.insert(reached.end(), next.begin(), next.end());
+            std::swap(frontier, next);
+        }
+        return reached;
+    };
+
+    trim();
+
+    // Forward-backward search from the pivot, which likely lies in the giant component.
+    if (!remaining.empty()) {
+        node pivot = remaining.front();
+        count bestScore = 0;
+        for (const node v : remaining) {
+            const count score = G->degreeIn(v) * G->degreeOut(v);
+            if (score > bestScore) {
+                bestScore = score;
+                pivot = v;
+            }
+        }
+
+        for (const node v : remaining) {
+            fwMark[v].store(0, std::memory_order_relaxed);
+            bwMark[v].store(0, std::memory_order_relaxed);
+        }
+        reach(pivot, true, fwMark, [](node) { return true; });
+        const auto scc = reach(pivot, false, bwMark, [&](node w) {
+            return fwMark[w].load(std::memory_order_relaxed) != 0;
+        });
+
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(scc.size()); ++i) {
+            rep[scc[i]].store(pivot, std::memory_order_relaxed);
+            active[scc[i]].store(0, std::memory_order_relaxed);
+        }
+        dropInactive();
+    }
+
+    // Coloring rounds
+    std::vector<std::atomic<node>> color(z);
+    std::vector<std::atomic<uint8_t>> inNext(z);
+    while (remaining.size() >= sequentialThreshold) {
+        trim();
+        if (remaining.size() < sequentialThreshold)
+            break;
+
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(remaining.size()); ++i) {
+            color[remaining[i]].store(remaining[i], std::memory_order_relaxed);
+            inNext[remaining[i]].store(0, std::memory_order_relaxed);
+        }
+
+        // Propagate the largest color along the out-edges.
+        frontier = remaining;
+        while (!frontier.empty()) {
+#pragma omp parallel if (frontier.size() > 256)
+            {
+                auto &local = perThread[omp_get_thread_num()];
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    const node c = color[frontier[i]].load(std::memory_order_relaxed);
+                    G->forNeighborsOf(frontier[i], [&](node w) {
+                        if (!isActive(w))
+                            return;
+                        node cur = color[w].load(std::memory_order_relaxed);
+                        while (c > cur) {
+                            if (color[w].compare_exchange_weak(cur, c,
+                                                               std::memory_order_relaxed)) {
+                                if (!inNext[w].exchange(1, std::memory_order_relaxed))
+                                    local.push_back(w);
+                                break;
+                            }
+                        }
+                    });
+                }
+            }
+            gather(next);
+            for (const node v : next)
+                inNext[v].store(0, std::memory_order_relaxed);
+            std::swap(frontier, next);
+        }
+
+        // Every node that kept its own color is the root of a color class. Its component
+        // consists of the nodes of the class that reach it. Classes are disjoint, so the
+        // backward searches run independently.
+#pragma omp parallel
+        {
+            std::vector<node> stack;
+#pragma omp for schedule(dynamic, 16)
+            for (omp_index i = 0; i < static_cast<omp_index>(remaining.size()); ++i) {
+                const node root = remaining[i];
+                if (color[root].load(std::memory_order_relaxed) != root)
+                    continue;
+
+                rep[root].store(root, std::memory_order_relaxed);
+                stack.push_back(root);
+                while (!stack.empty()) {
+                    const node v = stack.back();
+                    stack.pop_back();
+                    G->forInNeighborsOf(v, [&](node w) {
+                        if (rep[w].load(std::memory_order_relaxed) == none && isActive(w)
+                            && color[w].load(std::memory_order_relaxed) == root) {
+                            rep[w].store(root, std::memory_order_relaxed);
+                            stack.push_back(w);
+                        }
+                    });
+                }
+            }
+        }
+
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(remaining.size()); ++i)
+            if (rep[remaining[i]].load(std::memory_order_relaxed) != none)
+                active[remaining[i]].store(0, std::memory_order_relaxed);
+        const count before = remaining.size();
+        dropInactive();
+
+        // Long chains of components are peeled off only a few at a time.
+        if ((before - remaining.size()) * minProgress < before)
+            break;
+    }
+
+    // Tarjan's algorithm on the remaining nodes
+    if (!remaining.empty()) {
+        std::vector<index> depth(z, none), lowLink(z, none);
+        std::vector<uint8_t> onStack(z, 0);
+        std::vector<node> stack;
+        std::vector<std::pair<node, index>> dfsStack;
+        index curDepth = 0;
+
+        auto visit = [&](node v) {
+            depth[v] = lowLink[v] = curDepth++;
+            stack.push_back(v);
+            onStack[v] = 1;
+            dfsStack.emplace_back(v, 0);
+        };
+
+        for (const node r : remaining) {
+            if (depth[r] != none)
+                continue;
+            visit(r);
+            while (!dfsStack.empty()) {
+                const node v = dfsStack.back().first;
+                const index i = dfsStack.back().second++;
+                if (i < G->degreeOut(v)) {
+                    const node w = G->getIthNeighbor(v, i);
+                    if (!isActive(w))
+                        continue;
+                    if (depth[w] == none)
+                        visit(w);
+                    else if (onStack[w])
+                        lowLink[v] = std::min(lowLink[v], depth[w]);
+                    continue;
+                }
+
+                // All neighbors of v have been visited.
+                dfsStack.pop_back();
+                if (!dfsStack.empty()) {
+                    const node parent = dfsStack.back().first;
+                    lowLink[parent] = std::min(lowLink[parent], lowLink[v]);
+                }
+                if (lowLink[v] == depth[v]) {
+                    node w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        onStack[w] = 0;
+                        rep[w].store(v, std::memory_order_relaxed);
+                    } while (w != v);
+                }
+            }
+        }
+    }
+
+    // Number the components by their smallest node.
+    component.reset(z, none);
+    G->parallelForNodes([&](node u) { component[u] = rep[u].load(std::memory_order_relaxed); });
+    component.setUpperBound(z);
+    component.compact(true);
+
+    hasRun = true;
+}
+
+Graph ParallelStronglyConnectedComponents::extractLargestStronglyConnectedComponent(
+    const Graph &G, bool compactGraph) {
+    if (G.isEmpty())
+        return G;
+
+    ParallelStronglyConnectedComponents scc(G);
+    scc.run();
+    return extractLargestComponent(G, scc.getPartition(), compactGraph);
+}
+
+} // namespace NetworKit
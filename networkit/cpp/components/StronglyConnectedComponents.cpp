@@ -12,7 +12,6 @@
 
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/components/StronglyConnectedComponents.hpp>
-#include <networkit/graph/GraphTools.hpp>
 
 namespace NetworKit {
 
@@ -129,24 +128,7 @@ Graph StronglyConnectedComponents::extractLargestStronglyConnectedComponent(cons
 
     StronglyConnectedComponents scc(G);
     scc.run();
-    auto component = scc.getPartition();
-
-    const auto compSizes = component.subsetSizeMap();
-    if (compSizes.size() == 1) {
-        if (compactGraph && G.upperNodeIdBound() != G.numberOfNodes())
-            return GraphTools::getCompactedGraph(G, GraphTools::getContinuousNodeIds(G));
-        return G;
-    }
-
-    const auto largestSCCIndex = std::max_element(compSizes.begin(), compSizes.end(),
-                                                  [](const std::pair<index, count> &x,
-                                                     const std::pair<index, count> &y) -> bool {
-                                                      return x.second < y.second;
-                                                  })
-                                     ->first;
-
-    const auto nodesInLSCC = component.getMembers(largestSCCIndex);
-    return GraphTools::subgraphFromNodes(G, nodesInLSCC.begin(), nodesInLSCC.end(), compactGraph);
+    return extractLargestComponent(G, scc.getPartition(), compactGraph);
 }
 
 } // namespace NetworKit
@@ -6,10 +6,15 @@
  */
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <numeric>
+
+#include <networkit/components/AfforestConnectedComponents.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
 #include <networkit/components/DynConnectedComponents.hpp>
 #include <networkit/components/DynWeaklyConnectedComponents.hpp>
 #include <networkit/components/ParallelConnectedComponents.hpp>
+#include <networkit/components/ParallelStronglyConnectedComponents.hpp>
 #include <networkit/components/StronglyConnectedComponents.hpp>
 #include <networkit/components/WeaklyConnectedComponents.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
@@ -125,6 +130,46 @@ TEST_F(ConnectedComponentsGTest, testParallelConnectedComponentsWithDeletedNodes
     }
 }
 
+TEST_F(ConnectedComponentsGTest, testAfforestConnectedComponents) {
+    auto compare = [](const Graph &G) {
+        ConnectedComponents cc(G);
+        cc.run();
+        AfforestConnectedComponents afforest(G);
+        afforest.run();
+        EXPECT_EQ(cc.numberOfComponents(), afforest.numberOfComponents());
+        G.forNodes(
+            [&](node u) { EXPECT_EQ(cc.componentOfNode(u), afforest.componentOfNode(u)); });
+    };
+
+    METISGraphReader reader;
+    for (const auto graphName : {"PGPgiantcompo", "celegans_metabolic", "hep-th", "jazz"})
+        compare(reader.read(std::string("input/") + graphName + ".graph"));
+
+    // Many small components
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(5000, 1.5 / 5000).generate();
+    compare(G);
+
+    // Deleted nodes
+    G = ErdosRenyiGenerator(2000, 3. / 2000).generate();
+    for (node u = 0; u < G.upperNodeIdBound(); u += 7) {
+        G.forNeighborsOf(u, [&](node v) { G.removeEdge(u, v); });
+        G.removeNode(u);
+    }
+    compare(G);
+
+    // A long path whose nodes are shuffled, so that linking the first neighbors leaves many
+    // trees behind.
+    const count n = 10000;
+    std::vector<node> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), Aux::Random::getURNG());
+    Graph path(n);
+    for (index i = 1; i < n; ++i)
+        path.addEdge(perm[i - 1], perm[i]);
+    compare(path);
+}
+
 TEST_F(ConnectedComponentsGTest, benchConnectedComponents) {
     // construct graph
     METISGraphReader reader;
@@ -253,6 +298,64 @@ TEST_F(ConnectedComponentsGTest, testStronglyConnectedComponents) {
     }
 }
 
+TEST_F(ConnectedComponentsGTest, testParallelStronglyConnectedComponents) {
+    Aux::Random::setSeed(42, false);
+    std::vector<Graph> graphs;
+    graphs.push_back(ErdosRenyiGenerator(200, 0.01, true).generate());
+    // Large enough to use the coloring rounds
+    graphs.push_back(ErdosRenyiGenerator(40000, 1.2 / 40000, true).generate());
+    graphs.push_back(ErdosRenyiGenerator(40000, 2. / 40000, true).generate());
+    graphs.back().removeNode(17);
+
+    // A long path of 3-cycles with random node ids
+    {
+        const count n = 60000;
+        std::vector<node> perm(n);
+        std::iota(perm.begin(), perm.end(), 0);
+        std::shuffle(perm.begin(), perm.end(), Aux::Random::getURNG());
+        Graph G(n, false, true);
+        for (node u = 0; u < n; u += 3) {
+            G.addEdge(perm[u], perm[u + 1]);
+            G.addEdge(perm[u + 1], perm[u + 2]);
+            G.addEdge(perm[u + 2], perm[u]);
+            if (u + 3 < n)
+                G.addEdge(perm[u + 2], perm[u + 3]);
+        }
+        graphs.push_back(std::move(G));
+    }
+
+    for (const Graph &G : graphs) {
+        StronglyConnectedComponents scc(G);
+        scc.run();
+        ParallelStronglyConnectedComponents pscc(G);
+        pscc.run();
+
+        EXPECT_EQ(scc.numberOfComponents(), pscc.numberOfComponents());
+        std::vector<index> toParallel(scc.numberOfComponents(), none);
+        index lastFirst = 0;
+        std::vector<bool> seen(pscc.numberOfComponents());
+        G.forNodes([&](node u) {
+            const index c = scc.componentOfNode(u), pc = pscc.componentOfNode(u);
+            if (toParallel[c] == none)
+                toParallel[c] = pc;
+            EXPECT_EQ(toParallel[c], pc);
+
+            // Components are numbered by their smallest node
+            if (!seen[pc]) {
+                seen[pc] = true;
+                EXPECT_EQ(pc, lastFirst++);
+            }
+        });
+
+        const Graph lscc = StronglyConnectedComponents::extractLargestStronglyConnectedComponent(G);
+        const Graph plscc =
+            ParallelStronglyConnectedComponents::extractLargestStronglyConnectedComponent(G);
+        EXPECT_EQ(lscc.numberOfNodes(), plscc.numberOfNodes());
+        EXPECT_EQ(lscc.numberOfEdges(), plscc.numberOfEdges());
+        lscc.forNodes([&](node u) { EXPECT_TRUE(plscc.hasNode(u)); });
+    }
+}
+
 TEST_F(ConnectedComponentsGTest, testDynConnectedComponentsTiny) {
     // construct graph
     Graph g(20);
@@ -8,8 +8,8 @@
 #include <omp.h>
 
 #include <networkit/distance/APSP.hpp>
-#include <networkit/distance/BFS.hpp>
 #include <networkit/distance/Dijkstra.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 
 namespace NetworKit {
 
@@ -19,14 +19,28 @@ void APSP::run() {
     const count n = G.upperNodeIdBound();
     distances.assign(n, std::vector<edgeweight>(n));
 
+    if (!G.isWeighted()) {
+        const auto infDist = std::numeric_limits<edgeweight>::max();
+        using MSBFS = MultiSourceBFS<>;
+        MSBFS::forNodeBatches(G, [&](MSBFS &msbfs, const std::vector<node> &sources) {
+            for (const node source : sources)
+                std::fill(distances[source].begin(), distances[source].end(), infDist);
+            msbfs.run(sources.begin(), sources.end(),
+                      [&](node v, const MSBFS::Bitset &bits, count dist) {
+                          MSBFS::forBits(bits, [&](index i) {
+                              distances[sources[i]][v] = static_cast<edgeweight>(dist);
+                          });
+                      });
+        });
+        hasRun = true;
+        return;
+    }
+
     sssps.resize(omp_get_max_threads());
 #pragma omp parallel
     {
         omp_index i = omp_get_thread_num();
-        if (G.isWeighted())
-            sssps[i] = std::unique_ptr<SSSP>(new Dijkstra(G, 0, false));
-        else
-            sssps[i] = std::unique_ptr<SSSP>(new BFS(G, 0, false));
+        sssps[i] = std::unique_ptr<SSSP>(new Dijkstra(G, 0, false));
     }
 
     G.parallelForNodes([&](node source) {
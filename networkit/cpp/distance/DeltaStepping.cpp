@@ -0,0 +1,276 @@
+/*
+ * DeltaStepping.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/distance/DeltaStepping.hpp>
+
+namespace NetworKit {
+
+DeltaStepping::DeltaStepping(const Graph &G, node source, bool storePaths,
+                             bool storeNodesSortedByDistance, node target, edgeweight delta)
+    : SSSP(G, source, storePaths, storeNodesSortedByDistance, target), delta(delta) {
+    if (delta < 0 || std::isnan(delta))
+        throw std::runtime_error("Error: delta must not be negative");
+}
+
+void DeltaStepping::run() {
+    const count z = G->upperNodeIdBound();
+    const auto infDist = std::numeric_limits<edgeweight>::max();
+
+    edgeweight maxWeight = 0, minPositiveWeight = infDist;
+    bool zeroWeights = false, negativeWeights = false;
+#pragma omp parallel for reduction(max : maxWeight) reduction(min : minPositiveWeight) \
+    reduction(|| : zeroWeights, negativeWeights)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        if (!G->hasNode(u))
+            continue;
+        G->forNeighborsOf(u, [&](node, edgeweight w) {
+            maxWeight = std::max(maxWeight, w);
+            if (w > 0)
+                minPositiveWeight = std::min(minPositiveWeight, w);
+            zeroWeights = zeroWeights || w == 0;
+            negativeWeights = negativeWeights || w < 0;
+        });
+    }
+
+    if (negativeWeights)
+        throw std::runtime_error("Error: DeltaStepping does not support negative edge weights");
+
+    usedDelta = delta;
+    if (usedDelta == 0) {
+        // Wide enough to expose parallelism, but buckets narrower than the smallest weight would
+        // never see re-insertions anyway.
+        const double avgDegree = G->numberOfNodes() == 0
+                                     ? 0.
+                                     : static_cast<double>(G->numberOfEdges())
+                                           * (G->isDirected() ? 1. : 2.) / G->numberOfNodes();
+        usedDelta = maxWeight / std::max(1., avgDegree);
+        if (minPositiveWeight != infDist)
+            usedDelta = std::max(usedDelta, minPositiveWeight);
+        if (usedDelta == 0)
+            usedDelta = 1;
+    }
+
+    auto bucketOf = [&](edgeweight d) -> index { return static_cast<index>(d / usedDelta); };
+
+    std::vector<std::atomic<edgeweight>> dist(z);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        dist[u].store(infDist, std::memory_order_relaxed);
+    dist[source].store(0, std::memory_order_relaxed);
+
+    // Every thread keeps its own buckets, indexed by bucket number.
+    const int maxThreads = omp_get_max_threads();
+    std::vector<std::vector<std::vector<node>>> buckets(maxThreads);
+
+    std::vector<node> frontier{source};
+    index current = 0;
+
+    while (true) {
+#pragma omp parallel if (frontier.size() > 256)
+        {
+            auto &localBuckets = buckets[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64)
+            for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                const node u = frontier[i];
+                const edgeweight du = dist[u].load(std::memory_order_relaxed);
+                // u has been improved and settled in an earlier bucket
+                if (bucketOf(du) < current)
+                    continue;
+
+                G->forNeighborsOf(u, [&](node v, edgeweight w) {
+                    const edgeweight newDist = du + w;
+                    edgeweight cur = dist[v].load(std::memory_order_relaxed);
+                    while (newDist < cur) {
+                        if (dist[v].compare_exchange_weak(cur, newDist,
+                                                          std::memory_order_relaxed)) {
+                            const index b = bucketOf(newDist);
+                            if (b >= localBuckets.size())
+                                localBuckets.resize(b + 1);
+                            localBuckets[b].push_back(v);
+                            break;
+                        }
+                    }
+                });
+            }
+        }
+
+        // Relaxations never insert into earlier buckets, so the next bucket is at least current.
+        index next = none;
+        for (const auto &localBuckets : buckets)
+            for (index b = current; b < std::min<index>(localBuckets.size(), next); ++b)
+                if (!localBuckets[b].empty()) {
+                    next = b;
+                    break;
+                }
+
+        if (next == none)
+            break;
+
+        if (target != none && next != current) {
+            const edgeweight targetDist = dist[target].load(std::memory_order_relaxed);
+            if (targetDist != infDist && bucketOf(targetDist) < next)
+                break;
+        }
+
+        current = next;
+        frontier.clear();
+        for (auto &localBuckets : buckets) {
+            if (current < localBuckets.size()) {
+                frontier.insert(frontier.end(), localBuckets[current].begin(),
+                                localBuckets[current].end());
+                localBuckets[current].clear();
+            }
+        }
+    }
+
+    distances.resize(z);
+    std::vector<std::vector<node>> reachedPerThread(maxThreads);
+    double sum = 0;
+#pragma omp parallel reduction(+ : sum)
+    {
+        auto &localReached = reachedPerThread[omp_get_thread_num()];
+#pragma omp for
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            distances[u] = dist[u].load(std::memory_order_relaxed);
+            if (distances[u] != infDist) {
+                sum += distances[u];
+                localReached.push_back(u);
+            }
+        }
+    }
+
+    std::vector<node> reached;
+    for (const auto &localReached : reachedPerThread)
+        reached.insert(reached.end(), localReached.begin(), localReached.end());
+    reachedNodes = reached.size();
+    sumDist = sum;
+
+    if (storePaths || storeNodesSortedByDistance)
+        Aux::Parallel::sort(reached.begin(), reached.end(), [&](node u, node v) {
+            return std::tie(distances[u], u) < std::tie(distances[v], v);
+        });
+
+    if (storePaths) {
+        previous.clear();
+        previous.resize(z);
+        npaths.clear();
+        npaths.resize(z, 0);
+        npaths[source] = 1;
+
+        auto pullPaths = [&](node v) {
+            if (v == source)
+                return;
+            auto pull = [&](node u, edgeweight w) {
+                if (u != v && distances[u] != infDist && distances[u] + w == distances[v]) {
+                    previous[v].push_back(u);
+                    npaths[v] += npaths[u];
+                }
+            };
+            if (G->isDirected())
+                G->forInNeighborsOf(v, pull);
+            else
+                G->forNeighborsOf(v, pull);
+        };
+
+        if (zeroWeights) {
+            // Predecessors may have the same distance. Within each group of nodes with equal
+            // distance, the nodes are processed in a topological order of the zero-weight edges
+            // between them (Kahn's algorithm), so all predecessors are final before they are
+            // pulled from. Nodes on zero-weight cycles are processed last, in the sorted order.
+            std::vector<index> group(z, none);
+            std::vector<count> zeroInDegree(z, 0);
+            std::vector<node> order, queue;
+            auto forZeroWeightInNeighbors = [&](node v, auto handle) {
+                auto filter = [&](node u, edgeweight w) {
+                    if (w == 0 && u != v && group[u] == group[v])
+                        handle(u);
+                };
+                if (G->isDirected())
+                    G->forInNeighborsOf(v, filter);
+                else
+                    G->forNeighborsOf(v, filter);
+            };
+
+            for (index first = 0; first < reached.size();) {
+                index last = first + 1;
+                while (last < reached.size()
+                       && distances[reached[last]] == distances[reached[first]])
+                    ++last;
+
+                if (last - first == 1) {
+                    pullPaths(reached[first]);
+                    first = last;
+                    continue;
+                }
+
+                for (index i = first; i < last; ++i)
+                    group[reached[i]] = first;
+                queue.clear();
+                for (index i = first; i < last; ++i) {
+                    const node v = reached[i];
+                    forZeroWeightInNeighbors(v, [&](node) { ++zeroInDegree[v]; });
+                    if (zeroInDegree[v] == 0)
+                        queue.push_back(v);
+                }
+
+                order.clear();
+                for (index i = 0; i < queue.size(); ++i) {
+                    const node u = queue[i];
+                    order.push_back(u);
+                    G->forNeighborsOf(u, [&](node v, edgeweight w) {
+                        if (w == 0 && v != u && group[v] == first && zeroInDegree[v] > 0
+                            && --zeroInDegree[v] == 0)
+                            queue.push_back(v);
+                    });
+                }
+                for (index i = first; i < last; ++i) {
+                    const node v = reached[i];
+                    if (zeroInDegree[v] > 0) {
+                        order.push_back(v);
+                        zeroInDegree[v] = 0;
+                    }
+                }
+
+                for (const node v : order)
+                    pullPaths(v);
+                first = last;
+            }
+        } else {
+            // The predecessors of a node are at least minPositiveWeight closer to the source, so
+            // all nodes within a distance range of that width are independent of each other.
+            for (index first = 0; first < reached.size();) {
+                const edgeweight limit = distances[reached[first]] + minPositiveWeight;
+                index last = first + 1;
+                while (last < reached.size() && distances[reached[last]] < limit)
+                    ++last;
+
+#pragma omp parallel for schedule(guided) if (last - first > 256)
+                for (omp_index i = first; i < static_cast<omp_index>(last); ++i)
+                    pullPaths(reached[i]);
+                first = last;
+            }
+        }
+    }
+
+    if (storeNodesSortedByDistance)
+        nodesSortedByDistance = std::move(reached);
+    else
+        nodesSortedByDistance.clear();
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
@@ -8,7 +8,7 @@
 #include <numeric>
 
 #include <networkit/auxiliary/Log.hpp>
-#include <networkit/components/ConnectedComponents.hpp>
+#include <networkit/components/AfforestConnectedComponents.hpp>
 #include <networkit/distance/BFS.hpp>
 #include <networkit/distance/Diameter.hpp>
 #include <networkit/distance/Dijkstra.hpp>
@@ -109,7 +109,7 @@ std::pair<edgeweight, edgeweight> Diameter::estimatedDiameterRange(const Graph &
 
     G.parallelForNodes([&](node u) { eccUpperBound[u] = G.numberOfNodes(); });
 
-    ConnectedComponents comp(G);
+    AfforestConnectedComponents comp(G);
     comp.run();
     count numberOfComponents = comp.numberOfComponents();
 
@@ -313,7 +313,7 @@ edgeweight Diameter::estimatedVertexDiameterPedantic(const Graph &G) {
     } else if (G.isEmpty()) {
         vd = 0;
     } else {
-        ConnectedComponents cc(G);
+        AfforestConnectedComponents cc(G);
         DEBUG("finding connected components");
         cc.run();
         INFO("Number of components ", cc.numberOfComponents());
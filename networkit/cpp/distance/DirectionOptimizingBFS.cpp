@@ -0,0 +1,204 @@
+/*
+ * DirectionOptimizingBFS.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <atomic>
+#include <limits>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/distance/DirectionOptimizingBFS.hpp>
+
+namespace NetworKit {
+
+namespace {
+// Switching thresholds as proposed by Beamer et al.
+constexpr count alpha = 15;
+constexpr count beta = 18;
+
+constexpr count wordBits = 64;
+} // namespace
+
+DirectionOptimizingBFS::DirectionOptimizingBFS(const Graph &G, node source, bool storePaths,
+                                               bool storeNodesSortedByDistance, node target)
+    : SSSP(G, source, storePaths, storeNodesSortedByDistance, target) {}
+
+void DirectionOptimizingBFS::run() {
+    const count z = G->upperNodeIdBound();
+    const bool directed = G->isDirected();
+    const auto infDist = std::numeric_limits<edgeweight>::max();
+    reachedNodes = 1;
+    sumDist = 0.;
+    bottomUpSteps = 0;
+
+    distances.assign(z, infDist);
+
+    if (storePaths) {
+        previous.clear();
+        previous.resize(z);
+        npaths.clear();
+        npaths.resize(z, 0);
+        npaths[source] = 1;
+    }
+
+    nodesSortedByDistance.clear();
+
+    // Calls f(u) for all (incoming) neighbors u of v until f returns true.
+    auto forParentCandidates = [&](node v, auto f) {
+        if (directed) {
+            for (const node u : G->inNeighborRange(v))
+                if (f(u))
+                    return;
+        } else {
+            for (const node u : G->neighborRange(v))
+                if (f(u))
+                    return;
+        }
+    };
+
+    const count numWords = (z + wordBits - 1) / wordBits;
+    std::vector<std::atomic<uint64_t>> visited(numWords);
+    std::vector<uint64_t> frontierBits(numWords);
+    for (auto &word : visited)
+        word.store(0, std::memory_order_relaxed);
+
+    auto isSet = [](uint64_t word, node v) -> bool { return (word >> (v % wordBits)) & 1; };
+
+    std::vector<node> frontier{source};
+    visited[source / wordBits].fetch_or(uint64_t{1} << (source % wordBits));
+    distances[source] = 0.;
+
+    const int maxThreads = omp_get_max_threads();
+    std::vector<std::vector<node>> nextPerThread(maxThreads);
+    std::vector<node> next;
+
+    // Number of edges to check from unexplored nodes
+    count unexploredEdges = G->numberOfEdges() * (directed ? 1 : 2) - G->degreeOut(source);
+    bool bottomUp = false;
+    count previousFrontierSize = 0;
+
+    for (count level = 0; !frontier.empty(); ++level) {
+        if (storeNodesSortedByDistance)
+            nodesSortedByDistance.insert(nodesSortedByDistance.end(), frontier.begin(),
+                                         frontier.end());
+        if (target != none && distances[target] == static_cast<edgeweight>(level))
+            break;
+
+        count frontierEdges = 0;
+#pragma omp parallel for reduction(+ : frontierEdges) if (frontier.size() > 1000)
+        for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i)
+            frontierEdges += G->degreeOut(frontier[i]);
+
+        if (!bottomUp && frontierEdges > unexploredEdges / alpha)
+            bottomUp = true;
+        else if (bottomUp && frontier.size() < previousFrontierSize
+                 && frontier.size() < G->numberOfNodes() / beta)
+            bottomUp = false;
+        previousFrontierSize = frontier.size();
+
+        const edgeweight nextDist = static_cast<edgeweight>(level + 1);
+
+        if (bottomUp) {
+            ++bottomUpSteps;
+            std::fill(frontierBits.begin(), frontierBits.end(), 0);
+            for (const node u : frontier)
+                frontierBits[u / wordBits] |= uint64_t{1} << (u % wordBits);
+
+#pragma omp parallel
+            {
+                auto &localNext = nextPerThread[omp_get_thread_num()];
+                localNext.clear();
+
+                // Each thread owns whole words of the visited bitmap.
+#pragma omp for schedule(guided)
+                for (omp_index w = 0; w < static_cast<omp_index>(numWords); ++w) {
+                    uint64_t word = visited[w].load(std::memory_order_relaxed);
+                    const node last = std::min<node>(z, (w + 1) * wordBits);
+                    for (node v = w * wordBits; v < last; ++v) {
+                        if (isSet(word, v) || !G->hasNode(v))
+                            continue;
+
+                        bool found = false;
+                        forParentCandidates(v, [&](node u) {
+                            if (!isSet(frontierBits[u / wordBits], u))
+                                return false;
+                            found = true;
+                            if (!storePaths)
+                                return true;
+                            previous[v].push_back(u);
+                            npaths[v] += npaths[u];
+                            return false;
+                        });
+
+                        if (found) {
+                            word |= uint64_t{1} << (v % wordBits);
+                            distances[v] = nextDist;
+                            localNext.push_back(v);
+                        }
+                    }
+                    visited[w].store(word, std::memory_order_relaxed);
+                }
+            }
+        } else {
+#pragma omp parallel if (frontierEdges > 1000)
+            {
+                auto &localNext = nextPerThread[omp_get_thread_num()];
+                localNext.clear();
+
+#pragma omp for schedule(guided)
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    G->forNeighborsOf(frontier[i], [&](node v) {
+                        const uint64_t bit = uint64_t{1} << (v % wordBits);
+                        if (visited[v / wordBits].load(std::memory_order_relaxed) & bit)
+                            return;
+                        if (visited[v / wordBits].fetch_or(bit, std::memory_order_relaxed) & bit)
+                            return;
+                        distances[v] = nextDist;
+                        localNext.push_back(v);
+                    });
+                }
+            }
+        }
+
+        next.clear();
+        for (auto &localNext : nextPerThread) {
+            next.insert(next.end(), localNext.begin(), localNext.end());
+            localNext.clear();
+        }
+        if (storeNodesSortedByDistance)
+            Aux::Parallel::sort(next.begin(), next.end());
+
+        // Top-down steps do not collect the predecessors, pull them from the previous level.
+        if (storePaths && !bottomUp) {
+            const edgeweight dist = static_cast<edgeweight>(level);
+#pragma omp parallel for schedule(guided) if (next.size() > 1000)
+            for (omp_index i = 0; i < static_cast<omp_index>(next.size()); ++i) {
+                const node v = next[i];
+                forParentCandidates(v, [&](node u) {
+                    if (distances[u] == dist) {
+                        previous[v].push_back(u);
+                        npaths[v] += npaths[u];
+                    }
+                    return false;
+                });
+            }
+        }
+
+        count nextEdges = 0;
+#pragma omp parallel for reduction(+ : nextEdges) if (next.size() > 1000)
+        for (omp_index i = 0; i < static_cast<omp_index>(next.size()); ++i)
+            nextEdges += G->degreeOut(next[i]);
+        unexploredEdges -= std::min(unexploredEdges, nextEdges);
+
+        reachedNodes += next.size();
+        sumDist += nextDist * static_cast<double>(next.size());
+        std::swap(frontier, next);
+    }
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
@@ -5,12 +5,13 @@
  *      Author: Marc Nemes
  */
 
+#include <algorithm>
+#include <array>
 #include <cmath>
-#include <omp.h>
 
-#include <networkit/auxiliary/Random.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
 #include <networkit/distance/EffectiveDiameter.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 
 namespace NetworKit {
 
@@ -26,67 +27,31 @@ EffectiveDiameter::EffectiveDiameter(const Graph &G, const double ratio)
 }
 
 void EffectiveDiameter::run() {
-    count z = G->upperNodeIdBound();
-    // saves the reachable nodes of the current iteration
-    std::vector<std::vector<bool>> mCurr(z);
-    // saves the reachable nodes of the previous iteration
-    std::vector<std::vector<bool>> mPrev(z);
-    // sums over the number of edges needed to reach 90% of all other nodes
-    effectiveDiameter = 0;
-    // the current distance of the neighborhoods
-    count h = 1;
     // number of nodes that need to be connected with all other nodes
     auto threshold = static_cast<count>(std::ceil(ratio * G->numberOfNodes()));
-    // nodes that are not connected to enough nodes yet
-    std::vector<node> activeNodes;
+    // sums over the number of edges needed to reach the threshold
+    count sum = 0;
 
-    // initialize all nodes
-    G->forNodes([&](node v) {
-        std::vector<bool> connectedNodes;
-        // initialize n entries with value 0
-        connectedNodes.assign(z, 0);
-        // the node is always connected to itself
-        connectedNodes[v] = 1;
-        mCurr[v] = connectedNodes;
-        mPrev[v] = connectedNodes;
-        activeNodes.push_back(v);
-    });
-
-    // as long as we need to connect more nodes
-    while (!activeNodes.empty()) {
-        for (count x = 0; x < activeNodes.size(); x++) {
-            node v = activeNodes[x];
-            mCurr[v] = mPrev[v];
-            G->forNeighborsOf(v, [&](node u) {
-                for (count i = 0; i < G->numberOfNodes(); i++) {
-                    // add the current neighbor of u to the neighborhood of v
-                    mCurr[v][i] = mCurr[v][i] || mPrev[u][i];
-                }
-            });
+    using MSBFS = MultiSourceBFS<>;
+    MSBFS::forNodeBatches(*G, [&](MSBFS &msbfs, const std::vector<node> &sources) {
+        std::array<count, MSBFS::width> connected{}, steps{};
+        msbfs.run(sources.begin(), sources.end(),
+                  [&](node, const MSBFS::Bitset &bits, count dist) {
+                      MSBFS::forBits(bits, [&](index i) {
+                          // a node counts as connected to the threshold after at least one step
+                          if (++connected[i] >= threshold && steps[i] == 0 && dist > 0)
+                              steps[i] = dist;
+                      });
+                  });
 
-            // compute the number of connected nodes
-            count numConnectedNodes = 0;
-            for (count i = 0; i < G->numberOfNodes(); i++) {
-                if (mCurr[v][i] == 1) {
-                    numConnectedNodes++;
-                }
-            }
+        count batchSum = 0;
+        for (index i = 0; i < sources.size(); ++i)
+            batchSum += std::max<count>(steps[i], 1);
+#pragma omp atomic
+        sum += batchSum;
+    });
 
-            // when the number of connected nodes surpasses the threshold the node must no longer be
-            // considered
-            if (numConnectedNodes >= threshold) {
-                effectiveDiameter += h;
-                // remove the current node from future iterations
-                std::swap(activeNodes[x], activeNodes.back());
-                activeNodes.pop_back();
-                --x; // don't skip former activeNodes.back() that has been switched to
-                     // activeNodes[x]
-            }
-        }
-        mPrev = mCurr;
-        h++;
-    }
-    effectiveDiameter /= G->numberOfNodes();
+    effectiveDiameter = static_cast<double>(sum) / static_cast<double>(G->numberOfNodes());
     hasRun = true;
 }
 
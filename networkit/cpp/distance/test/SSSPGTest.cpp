@@ -7,13 +7,21 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
 #include <stack>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/distance/BFS.hpp>
+#include <networkit/distance/DeltaStepping.hpp>
 #include <networkit/distance/Dijkstra.hpp>
+#include <networkit/distance/DirectionOptimizingBFS.hpp>
 #include <networkit/distance/DynBFS.hpp>
 #include <networkit/distance/DynDijkstra.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 
 #include <tlx/unused.hpp>
@@ -194,4 +202,236 @@ TEST_F(SSSPGTest, testDirectedDijkstra) {
     EXPECT_EQ(sssp.distance(6), 1);
     EXPECT_EQ(sssp.distance(7), 3);
 }
+TEST_F(SSSPGTest, testDirectionOptimizingBFS) {
+    Aux::Random::setSeed(42, false);
+    std::vector<Graph> graphs;
+    graphs.push_back(METISGraphReader{}.read("input/PGPgiantcompo.graph"));
+    graphs.push_back(ErdosRenyiGenerator(3000, 0.01, false).generate());
+    graphs.push_back(ErdosRenyiGenerator(3000, 0.005, true).generate());
+    graphs.back().removeNode(17);
+
+    for (const Graph &G : graphs) {
+        for (int i = 0; i < 3; ++i) {
+            const node source = GraphTools::randomNode(G);
+            BFS bfs(G, source, true, true);
+            bfs.run();
+            DirectionOptimizingBFS dobfs(G, source, true, true);
+            dobfs.run();
+
+            EXPECT_GT(dobfs.getNumberOfBottomUpSteps(), 0u);
+            EXPECT_EQ(bfs.getReachableNodes(), dobfs.getReachableNodes());
+            EXPECT_DOUBLE_EQ(bfs.getSumOfDistances(), dobfs.getSumOfDistances());
+            G.forNodes([&](node u) {
+                EXPECT_EQ(bfs.distance(u), dobfs.distance(u));
+                EXPECT_EQ(bfs._numberOfPaths(u), dobfs._numberOfPaths(u));
+                auto expected = bfs.getPredecessors(u), actual = dobfs.getPredecessors(u);
+                std::sort(expected.begin(), expected.end());
+                std::sort(actual.begin(), actual.end());
+                EXPECT_EQ(expected, actual);
+            });
+
+            const auto &sorted = dobfs.getNodesSortedByDistance();
+            EXPECT_EQ(sorted.size(), dobfs.getReachableNodes());
+            for (index j = 1; j < sorted.size(); ++j)
+                EXPECT_LE(dobfs.distance(sorted[j - 1]), dobfs.distance(sorted[j]));
+
+            // Without paths, bottom-up steps stop at the first parent.
+            DirectionOptimizingBFS noPaths(G, source, false);
+            noPaths.run();
+            G.forNodes([&](node u) { EXPECT_EQ(bfs.distance(u), noPaths.distance(u)); });
+
+            // Stop at the target
+            const node target = sorted[sorted.size() / 2];
+            DirectionOptimizingBFS withTarget(G, source, true, false, target);
+            withTarget.run();
+            EXPECT_EQ(bfs.distance(target), withTarget.distance(target));
+            EXPECT_EQ(bfs._numberOfPaths(target), withTarget._numberOfPaths(target));
+        }
+    }
+}
+
+TEST_F(SSSPGTest, testDeltaStepping) {
+    Aux::Random::setSeed(42, false);
+    std::vector<Graph> graphs;
+    graphs.push_back(METISGraphReader{}.read("input/PGPgiantcompo.graph"));
+    for (const bool directed : {false, true}) {
+        Graph G = ErdosRenyiGenerator(3000, 0.005, directed).generate();
+        G = GraphTools::toWeighted(G);
+        // Small integral weights, so that there are many ties
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 5)); });
+        G.removeNode(17);
+        graphs.push_back(std::move(G));
+    }
+
+    for (const Graph &G : graphs) {
+        for (int i = 0; i < 3; ++i) {
+            const node source = GraphTools::randomNode(G);
+            Dijkstra dijkstra(G, source, true, true);
+            dijkstra.run();
+
+            for (const edgeweight delta : {0., 1., 2.5, 100.}) {
+                DeltaStepping ds(G, source, true, true, none, delta);
+                ds.run();
+
+                EXPECT_EQ(dijkstra.getReachableNodes(), ds.getReachableNodes());
+                EXPECT_DOUBLE_EQ(dijkstra.getSumOfDistances(), ds.getSumOfDistances());
+                G.forNodes([&](node u) {
+                    EXPECT_EQ(dijkstra.distance(u), ds.distance(u));
+                    EXPECT_EQ(dijkstra._numberOfPaths(u), ds._numberOfPaths(u));
+                    auto expected = dijkstra.getPredecessors(u), actual = ds.getPredecessors(u);
+                    std::sort(expected.begin(), expected.end());
+                    std::sort(actual.begin(), actual.end());
+                    EXPECT_EQ(expected, actual);
+                });
+
+                const auto &sorted = ds.getNodesSortedByDistance();
+                EXPECT_EQ(sorted.size(), ds.getReachableNodes());
+                for (index j = 1; j < sorted.size(); ++j)
+                    EXPECT_LE(ds.distance(sorted[j - 1]), ds.distance(sorted[j]));
+            }
+
+            // Stop at the target
+            const auto &sorted = dijkstra.getNodesSortedByDistance();
+            const node target = sorted[sorted.size() / 2];
+            DeltaStepping withTarget(G, source, true, false, target);
+            withTarget.run();
+            EXPECT_EQ(dijkstra.distance(target), withTarget.distance(target));
+            EXPECT_EQ(dijkstra._numberOfPaths(target), withTarget._numberOfPaths(target));
+        }
+    }
+
+    Graph negative(3, true);
+    negative.addEdge(0, 1, 1.);
+    negative.addEdge(1, 2, -1.);
+    DeltaStepping ds(negative, 0);
+    EXPECT_THROW(ds.run(), std::runtime_error);
+}
+
+TEST_F(SSSPGTest, testDeltaSteppingZeroWeights) {
+    auto checkPaths = [](const Graph &G, const DeltaStepping &ds, const Dijkstra &dijkstra,
+                         node source) {
+        // Number of shortest paths by recursion over the predecessors on shortest paths.
+        std::vector<double> paths(G.upperNodeIdBound(), -1);
+        std::function<double(node)> countPaths = [&](node v) -> double {
+            if (paths[v] >= 0)
+                return paths[v];
+            double result = v == source ? 1 : 0;
+            G.forInNeighborsOf(v, [&](node u, edgeweight w) {
+                if (u != v && dijkstra.distance(u) + w == dijkstra.distance(v))
+                    result += countPaths(u);
+            });
+            return paths[v] = result;
+        };
+
+        G.forNodes([&](node u) {
+            EXPECT_EQ(dijkstra.distance(u), ds.distance(u));
+            if (dijkstra.distance(u) == std::numeric_limits<edgeweight>::max())
+                return;
+            EXPECT_EQ(countPaths(u), ds._numberOfPaths(u)) << "node " << u;
+            std::vector<node> expected;
+            G.forInNeighborsOf(u, [&](node v, edgeweight w) {
+                if (v != u && dijkstra.distance(v) + w == dijkstra.distance(u))
+                    expected.push_back(v);
+            });
+            auto actual = ds.getPredecessors(u);
+            std::sort(expected.begin(), expected.end());
+            std::sort(actual.begin(), actual.end());
+            EXPECT_EQ(expected, actual) << "node " << u;
+        });
+    };
+
+    {
+        // The zero-weight edge leads from the node with the larger id to the smaller one.
+        Graph G(3, true, true);
+        G.addEdge(0, 2, 1);
+        G.addEdge(2, 1, 0);
+        Dijkstra dijkstra(G, 0, true);
+        dijkstra.run();
+        DeltaStepping ds(G, 0, true);
+        ds.run();
+        EXPECT_EQ(1, ds._numberOfPaths(1));
+        EXPECT_EQ(dijkstra._numberOfPaths(1), ds._numberOfPaths(1));
+        EXPECT_EQ(dijkstra.getPredecessors(1), ds.getPredecessors(1));
+        checkPaths(G, ds, dijkstra, 0);
+    }
+
+    // Random weights with many zero-weight edges, but no zero-weight cycles.
+    Aux::Random::setSeed(42, false);
+    Graph G = GraphTools::toWeighted(ErdosRenyiGenerator(1000, 0.005, true).generate());
+    G.forEdges([&](node u, node v) {
+        const bool zero = u < v && Aux::Random::probability() < 0.3;
+        G.setWeight(u, v, zero ? 0 : Aux::Random::integer(1, 3));
+    });
+    for (int i = 0; i < 3; ++i) {
+        const node source = GraphTools::randomNode(G);
+        Dijkstra dijkstra(G, source, true);
+        dijkstra.run();
+        for (const edgeweight delta : {0., 2.}) {
+            DeltaStepping ds(G, source, true, false, none, delta);
+            ds.run();
+            checkPaths(G, ds, dijkstra, source);
+        }
+    }
+}
+
+TEST_F(SSSPGTest, testMultiSourceBFS) {
+    Aux::Random::setSeed(42, false);
+    std::vector<Graph> graphs;
+    graphs.push_back(METISGraphReader{}.read("input/PGPgiantcompo.graph"));
+    graphs.push_back(ErdosRenyiGenerator(1000, 0.002, false).generate());
+    graphs.push_back(ErdosRenyiGenerator(1000, 0.005, true).generate());
+    graphs.back().removeNode(17);
+
+    auto check = [](const Graph &G, auto &msbfs, const std::vector<node> &sources) {
+        using MSBFS = std::remove_reference_t<decltype(msbfs)>;
+        std::vector<std::vector<edgeweight>> dist(
+            sources.size(),
+            std::vector<edgeweight>(G.upperNodeIdBound(), std::numeric_limits<edgeweight>::max()));
+        count lastDist = 0;
+        msbfs.run(sources.begin(), sources.end(),
+                  [&](node v, const typename MSBFS::Bitset &bits, count d) {
+                      EXPECT_GE(d, lastDist);
+                      lastDist = d;
+                      MSBFS::forBits(bits, [&](index i) {
+                          EXPECT_EQ(dist[i][v], std::numeric_limits<edgeweight>::max());
+                          dist[i][v] = static_cast<edgeweight>(d);
+                      });
+                  });
+
+        for (index i = 0; i < sources.size(); ++i) {
+            BFS bfs(G, sources[i], false);
+            bfs.run();
+            G.forNodes([&](node v) { EXPECT_EQ(bfs.distance(v), dist[i][v]); });
+        }
+    };
+
+    for (const Graph &G : graphs) {
+        // Duplicate sources are allowed
+        std::vector<node> sources(100);
+        for (auto &source : sources)
+            source = GraphTools::randomNode(G);
+        sources.push_back(sources.front());
+
+        MultiSourceBFS<64> msbfs64(G);
+        check(G, msbfs64, std::vector<node>(sources.begin(), sources.begin() + 64));
+        check(G, msbfs64, std::vector<node>(sources.begin() + 64, sources.end()));
+
+        MultiSourceBFS<128> msbfs128(G);
+        check(G, msbfs128, sources);
+
+        EXPECT_THROW(msbfs64.run(sources.begin(), sources.end(), [](node, const auto &, count) {}),
+                     std::runtime_error);
+
+        // Every node is a source of exactly one batch
+        std::vector<count> batchOf(G.upperNodeIdBound(), 0);
+        MultiSourceBFS<64>::forNodeBatches(
+            G, [&](MultiSourceBFS<64> &, const std::vector<node> &batch) {
+                EXPECT_LE(batch.size(), 64u);
+                for (const node u : batch)
+#pragma omp atomic
+                    ++batchOf[u];
+            });
+        G.forNodes([&](node u) { EXPECT_EQ(batchOf[u], 1u); });
+    }
+}
 } // namespace NetworKit
@@ -0,0 +1,271 @@
+/*
+ * TrussDecomposition.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+#include <networkit/auxiliary/SetIntersector.hpp>
+#include <networkit/edgescores/TrussDecomposition.hpp>
+#include <networkit/graph/TriangleCounting.hpp>
+
+namespace NetworKit {
+
+namespace {
+// States of the edges during the peeling
+constexpr uint8_t remaining = 0;
+constexpr uint8_t inFrontier = 1;
+constexpr uint8_t removed = 2;
+} // namespace
+
+TrussDecomposition::TrussDecomposition(const Graph &G) : EdgeScore<count>(G) {
+    if (G.isDirected())
+        throw std::runtime_error("Error, truss decomposition is only implemented for undirected "
+                                 "graphs");
+    if (!G.hasEdgeIds())
+        throw std::runtime_error("edges have not been indexed - call indexEdges first");
+}
+
+void TrussDecomposition::run() {
+    const count z = G->upperNodeIdBound();
+
+    TriangleCounting triangleCounting(*G, false, true);
+    triangleCounting.run();
+    std::vector<count> support = triangleCounting.edgeTriangles();
+
+    // Sorted neighborhoods without self-loops, together with the ids of the edges.
+    std::vector<index> adjBegin(z + 1, 0);
+    G->parallelForNodes([&](node u) {
+        count deg = 0;
+        G->forNeighborsOf(u, [&](node v) { deg += v != u; });
+        adjBegin[u + 1] = deg;
+    });
+    std::partial_sum(adjBegin.begin(), adjBegin.end(), adjBegin.begin());
+
+    // The neighbors of u are adjBegin[u] to adjEnd[u] - 1; removed edges are compacted away
+    // once they make up half of the neighborhood.
+    std::vector<index> adjEnd(adjBegin.begin() + 1, adjBegin.end());
+    std::vector<count> removedEdges(z, 0);
+    std::vector<node> adjNodes(adjBegin[z]);
+    std::vector<edgeid> adjEdges(adjBegin[z]);
+    std::vector<node> edgeSource(G->upperEdgeIdBound(), none);
+    std::vector<node> edgeTarget(G->upperEdgeIdBound(), none);
+#pragma omp parallel
+    {
+        std::vector<std::pair<node, edgeid>> local;
+#pragma omp for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+            const auto u = static_cast<node>(i);
+            if (!G->hasNode(u))
+                continue;
+
+            local.clear();
+            G->forNeighborsOf(u, [&](node, node v, edgeweight, edgeid eid) {
+                if (v == u)
+                    return;
+                local.emplace_back(v, eid);
+                if (u < v) {
+                    edgeSource[eid] = u;
+                    edgeTarget[eid] = v;
+                }
+            });
+            std::sort(local.begin(), local.end());
+            for (index j = 0; j < local.size(); ++j) {
+                adjNodes[adjBegin[u] + j] = local[j].first;
+                adjEdges[adjBegin[u] + j] = local[j].second;
+            }
+        }
+    }
+
+    // The edges that have not been removed yet, in ascending order of their ids (except for
+    // reordering between threads), so the supports and states are scanned mostly sequentially.
+    std::vector<edgeid> edges;
+    for (edgeid e = 0; e < G->upperEdgeIdBound(); ++e) {
+        if (edgeSource[e] != none)
+            edges.push_back(e);
+    }
+
+    scoreData.assign(G->upperEdgeIdBound(), 0);
+    std::vector<uint8_t> state(G->upperEdgeIdBound(), remaining);
+    std::vector<edgeid> frontier, next, stillRemaining;
+    std::vector<node> toCompact;
+    maxTruss = 0;
+
+    // A lower bound for the support of the remaining edges: it is the exact minimum of the
+    // supports when the edges are scanned, and only supports that are decreased to a smaller
+    // value afterwards lower it.
+    count nextLevel = std::numeric_limits<count>::max();
+#pragma omp parallel for reduction(min : nextLevel)
+    for (omp_index i = 0; i < static_cast<omp_index>(edges.size()); ++i)
+        nextLevel = std::min(nextLevel, support[edges[i]]);
+
+    while (!edges.empty()) {
+        const count level = nextLevel;
+        nextLevel = std::numeric_limits<count>::max();
+
+        frontier.clear();
+        stillRemaining.clear();
+#pragma omp parallel reduction(min : nextLevel)
+        {
+            std::vector<edgeid> localFrontier, localRemaining;
+#pragma omp for nowait
+            for (omp_index i = 0; i < static_cast<omp_index>(edges.size()); ++i) {
+                const edgeid e = edges[i];
+                if (state[e] != remaining)
+                    continue;
+                if (support[e] <= level) {
+                    localFrontier.push_back(e);
+                } else {
+                    localRemaining.push_back(e);
+                    nextLevel = std::min(nextLevel, support[e]);
+                }
+            }
+
+#pragma omp critical
+            {
+                frontier.insert(frontier.end(), localFrontier.begin(), localFrontier.end());
+                stillRemaining.insert(stillRemaining.end(), localRemaining.begin(),
+                                      localRemaining.end());
+            }
+        }
+        std::swap(edges, stillRemaining);
+        if (!frontier.empty())
+            maxTruss = level + 2;
+
+        // Remove the edges with support level, and the edges whose support drops to level
+        // while doing so, in rounds.
+        while (!frontier.empty()) {
+#pragma omp parallel for
+            for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                state[frontier[i]] = inFrontier;
+                scoreData[frontier[i]] = level + 2;
+            }
+
+            next.clear();
+#pragma omp parallel reduction(min : nextLevel)
+            {
+                std::vector<edgeid> localNext;
+
+                // Decreases the support of e unless it is already at level.
+                const auto decrease = [&](edgeid e) {
+                    count current;
+#pragma omp atomic read
+                    current = support[e];
+                    if (current <= level)
+                        return;
+#pragma omp atomic capture
+                    current = support[e]--;
+                    if (current == level + 1) {
+                        localNext.push_back(e);
+                    } else if (current <= level) {
+#pragma omp atomic
+                        ++support[e];
+                    } else {
+                        nextLevel = std::min(nextLevel, current - 1);
+                    }
+                };
+
+#pragma omp for schedule(dynamic, 64) nowait
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    const edgeid e = frontier[i];
+                    const node u = edgeSource[e], v = edgeTarget[e];
+                    Aux::forSortedIntersection(
+                        adjNodes.data() + adjBegin[u], adjEnd[u] - adjBegin[u],
+                        adjNodes.data() + adjBegin[v], adjEnd[v] - adjBegin[v],
+                        [&](index j, index k) {
+                            const edgeid eu = adjEdges[adjBegin[u] + j];
+                            const edgeid ev = adjEdges[adjBegin[v] + k];
+                            if (state[eu] == removed || state[ev] == removed)
+                                return;
+
+                            // If two edges of the triangle are removed in this round, only the
+                            // one with the smaller id updates the third edge.
+                            if (state[eu] == inFrontier) {
+                                if (state[ev] != inFrontier && e < eu)
+                                    decrease(ev);
+                            } else if (state[ev] == inFrontier) {
+                                if (e < ev)
+                                    decrease(eu);
+                            } else {
+                                decrease(eu);
+                                decrease(ev);
+                            }
+                        });
+                }
+
+#pragma omp critical
+                next.insert(next.end(), localNext.begin(), localNext.end());
+            }
+
+            toCompact.clear();
+#pragma omp parallel
+            {
+                std::vector<node> localCompact;
+#pragma omp for nowait
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    const edgeid e = frontier[i];
+                    state[e] = removed;
+                    for (const node x : {edgeSource[e], edgeTarget[e]}) {
+                        count removedOfX;
+#pragma omp atomic capture
+                        removedOfX = ++removedEdges[x];
+                        // Exactly one thread sees the count reach half of the neighborhood.
+                        if (2 * removedOfX >= adjEnd[x] - adjBegin[x]
+                            && 2 * (removedOfX - 1) < adjEnd[x] - adjBegin[x])
+                            localCompact.push_back(x);
+                    }
+                }
+
+#pragma omp critical
+                toCompact.insert(toCompact.end(), localCompact.begin(), localCompact.end());
+            }
+
+#pragma omp parallel for schedule(dynamic, 16)
+            for (omp_index i = 0; i < static_cast<omp_index>(toCompact.size()); ++i) {
+                const node x = toCompact[i];
+                index end = adjBegin[x];
+                for (index j = adjBegin[x]; j < adjEnd[x]; ++j) {
+                    if (state[adjEdges[j]] != removed) {
+                        adjNodes[end] = adjNodes[j];
+                        adjEdges[end++] = adjEdges[j];
+                    }
+                }
+                adjEnd[x] = end;
+                removedEdges[x] = 0;
+            }
+
+            std::swap(frontier, next);
+        }
+    }
+
+    hasRun = true;
+}
+
+Graph TrussDecomposition::maxTrussSubgraph() const {
+    assureFinished();
+
+    Graph S(G->upperNodeIdBound(), G->isWeighted(), false);
+    std::vector<bool> inTruss(G->upperNodeIdBound(), false);
+    if (maxTruss > 0) {
+        G->forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+            if (scoreData[eid] == maxTruss) {
+                inTruss[u] = true;
+                inTruss[v] = true;
+                S.addEdge(u, v, w);
+            }
+        });
+    }
+
+    for (node u = 0; u < G->upperNodeIdBound(); ++u) {
+        if (!inTruss[u])
+            S.removeNode(u);
+    }
+
+    return S;
+}
+
+} /* namespace NetworKit */
@@ -152,6 +152,34 @@ TEST_F(ChibaNishizekiTriangleEdgeScoreGTest, testNewTriangleCountsSimple) {
     EXPECT_EQ(1, (counts[g.edgeId(5, 4)])) << "wrong triangle count";
 }
 
+TEST_F(ChibaNishizekiTriangleEdgeScoreGTest, testNewTriangleCountsDirected) {
+    // Directed graphs are not supported by TriangleCounting; the out-edges are counted as
+    // undirected edges oriented by out-degree, as before.
+    Graph g(4, false, true);
+    g.addEdge(0, 1);
+    g.addEdge(1, 0);
+    g.addEdge(0, 2);
+    g.addEdge(2, 0);
+    g.addEdge(1, 2);
+    g.addEdge(2, 1);
+    g.addEdge(2, 3);
+    g.addEdge(3, 0);
+    g.indexEdges();
+
+    TriangleEdgeScore counter(g);
+    counter.run();
+    std::vector<count> counts = counter.scores();
+
+    EXPECT_EQ(0, (counts[g.edgeId(0, 1)]));
+    EXPECT_EQ(0, (counts[g.edgeId(0, 2)]));
+    EXPECT_EQ(1, (counts[g.edgeId(1, 0)]));
+    EXPECT_EQ(0, (counts[g.edgeId(1, 2)]));
+    EXPECT_EQ(2, (counts[g.edgeId(2, 0)]));
+    EXPECT_EQ(1, (counts[g.edgeId(2, 1)]));
+    EXPECT_EQ(0, (counts[g.edgeId(2, 3)]));
+    EXPECT_EQ(0, (counts[g.edgeId(3, 0)]));
+}
+
 } // namespace NetworKit
 
 /* namespace NetworKit */
@@ -0,0 +1,138 @@
+/*
+ * TrussDecompositionGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/edgescores/TrussDecomposition.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/io/METISGraphReader.hpp>
+
+namespace NetworKit {
+
+class TrussDecompositionGTest : public testing::Test {
+protected:
+    // Trussness by repeatedly removing all edges that are in less than k - 2 triangles.
+    static std::vector<count> naiveTrussness(const Graph &G) {
+        std::vector<count> trussness(G.upperEdgeIdBound(), 0);
+        std::vector<std::set<node>> adjacency(G.upperNodeIdBound());
+        G.forEdges([&](node u, node v) {
+            if (u != v) {
+                adjacency[u].insert(v);
+                adjacency[v].insert(u);
+            }
+        });
+
+        for (count k = 3;; ++k) {
+            bool anyEdge = false, removedEdge = true;
+            while (removedEdge) {
+                removedEdge = false;
+                anyEdge = false;
+                G.forEdges([&](node u, node v, edgeweight, edgeid eid) {
+                    if (u == v || !adjacency[u].count(v))
+                        return;
+                    anyEdge = true;
+                    count support = 0;
+                    for (node w : adjacency[u])
+                        support += adjacency[v].count(w);
+                    if (support < k - 2) {
+                        adjacency[u].erase(v);
+                        adjacency[v].erase(u);
+                        trussness[eid] = k - 1;
+                        removedEdge = true;
+                    }
+                });
+            }
+            if (!anyEdge)
+                return trussness;
+        }
+    }
+};
+
+TEST_F(TrussDecompositionGTest, testSmallGraph) {
+    // K4 on 0-3, a triangle 3, 4, 5 attached to it, a pendant edge and a self-loop.
+    Graph G(7);
+    for (node u = 0; u < 4; ++u)
+        for (node v = u + 1; v < 4; ++v)
+            G.addEdge(u, v);
+    G.addEdge(3, 4);
+    G.addEdge(3, 5);
+    G.addEdge(4, 5);
+    G.addEdge(5, 6);
+    G.addEdge(6, 6);
+    G.indexEdges();
+
+    TrussDecomposition truss(G);
+    truss.run();
+
+    EXPECT_EQ(4u, truss.maxTrussness());
+    EXPECT_EQ(4u, truss.score(0, 1));
+    EXPECT_EQ(4u, truss.score(2, 3));
+    EXPECT_EQ(3u, truss.score(3, 4));
+    EXPECT_EQ(3u, truss.score(4, 5));
+    EXPECT_EQ(2u, truss.score(5, 6));
+    EXPECT_EQ(0u, truss.score(6, 6));
+
+    const Graph maxTruss = truss.maxTrussSubgraph();
+    EXPECT_EQ(4u, maxTruss.numberOfNodes());
+    EXPECT_EQ(6u, maxTruss.numberOfEdges());
+    EXPECT_TRUE(maxTruss.hasEdge(0, 3));
+    EXPECT_FALSE(maxTruss.hasNode(4));
+}
+
+TEST_F(TrussDecompositionGTest, testRandomGraphs) {
+    Aux::Random::setSeed(42, false);
+    for (const double p : {0.05, 0.2}) {
+        Graph G = ErdosRenyiGenerator(150, p).generate();
+        // Plant a clique, so there is a large truss
+        for (node u = 0; u < 15; ++u)
+            for (node v = u + 1; v < 15; ++v)
+                if (!G.hasEdge(u, v))
+                    G.addEdge(u, v);
+        G.removeNode(140);
+        G.indexEdges();
+
+        TrussDecomposition truss(G);
+        truss.run();
+        const auto expected = naiveTrussness(G);
+        G.forEdges([&](node u, node v, edgeid eid) {
+            EXPECT_EQ(expected[eid], truss.scores()[eid]) << "edge " << u << "-" << v;
+        });
+        EXPECT_GE(truss.maxTrussness(), 15u);
+
+        const Graph maxTruss = truss.maxTrussSubgraph();
+        G.forEdges([&](node u, node v, edgeid eid) {
+            EXPECT_EQ(truss.scores()[eid] == truss.maxTrussness(), maxTruss.hasEdge(u, v));
+        });
+    }
+}
+
+TEST_F(TrussDecompositionGTest, testRealGraph) {
+    METISGraphReader reader;
+    Graph G = reader.read("input/jazz.graph");
+    G.indexEdges();
+
+    TrussDecomposition truss(G);
+    truss.run();
+    const auto expected = naiveTrussness(G);
+    G.forEdges(
+        [&](node, node, edgeid eid) { EXPECT_EQ(expected[eid], truss.scores()[eid]); });
+}
+
+TEST_F(TrussDecompositionGTest, testInvalidGraphs) {
+    Graph unindexed(3);
+    unindexed.addEdge(0, 1);
+    EXPECT_THROW(TrussDecomposition{unindexed}, std::runtime_error);
+
+    Graph directed(3, false, true);
+    directed.addEdge(0, 1);
+    directed.indexEdges();
+    EXPECT_THROW(TrussDecomposition{directed}, std::runtime_error);
+}
+
+} // namespace NetworKit
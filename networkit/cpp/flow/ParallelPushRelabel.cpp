@@ -0,0 +1,437 @@
+/*
+ * ParallelPushRelabel.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/flow/ParallelPushRelabel.hpp>
+
+namespace NetworKit {
+
+namespace {
+// Work charged for a discharge in addition to the degree of the node, and the amount of work
+// (relative to 6n + m) after which the labels are recomputed.
+constexpr count dischargeOverhead = 12;
+constexpr double globalRelabelFrequency = 0.5;
+
+edgeweight atomicRead(const edgeweight &x) {
+    edgeweight value;
+#pragma omp atomic read
+    value = x;
+    return value;
+}
+
+void atomicAdd(edgeweight &x, edgeweight delta) {
+#pragma omp atomic
+    x += delta;
+}
+
+// Concatenates the per-thread lists into out and clears them.
+void concatenate(std::vector<std::vector<node>> &local, std::vector<node> &out) {
+    std::vector<index> begin(local.size() + 1, out.size());
+    for (index t = 0; t < local.size(); ++t)
+        begin[t + 1] = begin[t] + local[t].size();
+    out.resize(begin.back());
+#pragma omp parallel for schedule(static, 1)
+    for (omp_index t = 0; t < static_cast<omp_index>(local.size()); ++t) {
+        std::copy(local[t].begin(), local[t].end(), out.begin() + begin[t]);
+        local[t].clear();
+    }
+}
+} // namespace
+
+ParallelPushRelabel::ParallelPushRelabel(const Graph &graph, node source, node sink)
+    : graph(&graph), source(source), sink(sink) {}
+
+template <typename N>
+std::vector<node> ParallelPushRelabel::parallelBFS(node root,
+                                                   std::vector<std::atomic<bool>> &visited,
+                                                   N neighbors,
+                                                   std::vector<index> &levelBegin) const {
+    std::vector<node> order{root};
+    std::vector<std::vector<node>> next(omp_get_max_threads());
+    visited[root].store(true, std::memory_order_relaxed);
+    levelBegin.assign({0, 1});
+
+    while (levelBegin.back() > levelBegin[levelBegin.size() - 2]) {
+        const index begin = levelBegin[levelBegin.size() - 2], end = levelBegin.back();
+#pragma omp parallel
+        {
+            auto &local = next[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64)
+            for (omp_index i = begin; i < static_cast<omp_index>(end); ++i)
+                neighbors(order[i], [&](node v) {
+                    if (!visited[v].load(std::memory_order_relaxed)
+                        && !visited[v].exchange(true, std::memory_order_relaxed))
+                        local.push_back(v);
+                });
+        }
+        concatenate(next, order);
+        levelBegin.push_back(order.size());
+    }
+    levelBegin.pop_back();
+
+    return order;
+}
+
+void ParallelPushRelabel::run() {
+    if (!graph->hasEdgeIds())
+        throw std::runtime_error("edges have not been indexed - call indexEdges first");
+
+    hasRun = false;
+    Aux::SignalHandler handler;
+
+    const count z = graph->upperNodeIdBound();
+    buildResidualNetwork();
+    labels.assign(z, z);
+    newLabels.assign(z, z);
+    excess.assign(z, 0);
+    addedExcess.assign(z, 0);
+    isDiscovered = std::vector<std::atomic<bool>>(z);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        isDiscovered[u].store(false, std::memory_order_relaxed);
+
+    // Saturate all arcs leaving the source.
+    for (index a = offsets[source]; a < offsets[source + 1]; ++a) {
+        const edgeweight delta = residual[a];
+        if (delta > 0) {
+            residual[a] = 0;
+            residual[reverseArcs[a]] += delta;
+            excess[heads[a]] += delta;
+        }
+    }
+
+    handler.assureRunning();
+    runPhase(sink, source);
+    flowValue = excess[sink];
+
+    handler.assureRunning();
+    runPhase(source, sink);
+
+    flow.assign(graph->upperEdgeIdBound(), 0);
+    graph->parallelForEdges([&](node u, node v, edgeid eid) {
+        if (u == v)
+            return;
+        const index a = edgeArcs[eid];
+        if (graph->isDirected())
+            flow[eid] = residual[reverseArcs[a]];
+        else // a belongs to the larger endpoint
+            flow[eid] = (residual[reverseArcs[a]] - residual[a]) / 2;
+    });
+
+    labels = {};
+    newLabels = {};
+    labelCount = {};
+    excess = {};
+    addedExcess = {};
+    isDiscovered = std::vector<std::atomic<bool>>();
+    activeNodes = {};
+
+    hasRun = true;
+}
+
+void ParallelPushRelabel::buildResidualNetwork() {
+    const count z = graph->upperNodeIdBound();
+    const bool directed = graph->isDirected();
+
+    // Each edge (u, v) is an arc from u to v and a reverse arc from v to u. On directed graphs,
+    // the reverse arc has no capacity of its own. The arcs of a node are stored in the order of
+    // its out-edges, followed by its in-edges on directed graphs.
+    offsets.assign(z + 1, 0);
+    graph->parallelForNodes([&](node u) {
+        count arcs = 0;
+        auto countArc = [&](node, node v, edgeweight, edgeid) { arcs += (u != v); };
+        graph->forNeighborsOf(u, countArc);
+        if (directed)
+            graph->forInEdgesOf(u, countArc);
+        offsets[u + 1] = arcs;
+    });
+    for (index u = 0; u < z; ++u)
+        offsets[u + 1] += offsets[u];
+
+    const count arcs = offsets.back();
+    heads.resize(arcs);
+    reverseArcs.resize(arcs);
+    residual.resize(arcs);
+    edgeArcs.assign(graph->upperEdgeIdBound(), none);
+
+    graph->balancedParallelForNodes([&](node u) {
+        index a = offsets[u];
+        graph->forNeighborsOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+            if (u == v)
+                return;
+            heads[a] = v;
+            residual[a] = w;
+            if (directed || u > v)
+                edgeArcs[eid] = a;
+            ++a;
+        });
+        if (directed)
+            graph->forInEdgesOf(u, [&](node, node v, edgeweight, edgeid) {
+                if (u == v)
+                    return;
+                heads[a] = v;
+                residual[a] = 0;
+                ++a;
+            });
+    });
+
+    // Pair the arcs that are not in edgeArcs with their reverse arcs.
+    graph->balancedParallelForNodes([&](node u) {
+        index a = offsets[u];
+        auto pair = [&](node v, edgeid eid, bool isReverse) {
+            if (u == v)
+                return;
+            if (isReverse) {
+                reverseArcs[a] = edgeArcs[eid];
+                reverseArcs[edgeArcs[eid]] = a;
+            }
+            ++a;
+        };
+        graph->forNeighborsOf(u, [&](node, node v, edgeweight, edgeid eid) {
+            pair(v, eid, !directed && u < v);
+        });
+        if (directed)
+            graph->forInEdgesOf(u,
+                                [&](node, node v, edgeweight, edgeid eid) { pair(v, eid, true); });
+    });
+}
+
+void ParallelPushRelabel::runPhase(node target, node excluded) {
+    const count z = graph->upperNodeIdBound();
+    const count threshold = static_cast<count>(
+        globalRelabelFrequency
+        * static_cast<double>(6 * graph->numberOfNodes() + offsets.back()));
+
+    Aux::SignalHandler handler;
+    std::vector<std::vector<node>> discovered(omp_get_max_threads());
+    std::vector<index> oldLabels;
+    std::vector<node> nextActive;
+    count work = 0;
+    bool relabeled = false;
+
+    while (true) {
+        handler.assureRunning();
+
+        // Recompute the labels periodically, and before stopping to make sure that no node with
+        // excess can still reach the target.
+        if (!relabeled && (activeNodes.empty() || work > threshold)) {
+            globalRelabel(target, excluded);
+            collectActiveNodes(target, excluded);
+            relabeled = true;
+            work = 0;
+            continue;
+        }
+        if (activeNodes.empty())
+            break;
+        relabeled = false;
+
+        const omp_index active = static_cast<omp_index>(activeNodes.size());
+
+#pragma omp parallel reduction(+ : work)
+        {
+            auto &local = discovered[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 16)
+            for (omp_index i = 0; i < active; ++i)
+                discharge(activeNodes[i], target, local, work);
+        }
+
+        // Apply the new labels and excesses. The nodes discharged in this round are updated
+        // first, so that they do not take their own excess into account twice.
+        oldLabels.resize(activeNodes.size());
+#pragma omp parallel for
+        for (omp_index i = 0; i < active; ++i) {
+            const node v = activeNodes[i];
+            oldLabels[i] = labels[v];
+            if (newLabels[v] != labels[v]) {
+#pragma omp atomic
+                --labelCount[labels[v]];
+                if (newLabels[v] < z) {
+#pragma omp atomic
+                    ++labelCount[newLabels[v]];
+                }
+                labels[v] = newLabels[v];
+            }
+            excess[v] += addedExcess[v];
+            addedExcess[v] = 0;
+        }
+
+        nextActive.clear();
+        concatenate(discovered, nextActive);
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(nextActive.size()); ++i) {
+            const node w = nextActive[i];
+            excess[w] += addedExcess[w];
+            addedExcess[w] = 0;
+            isDiscovered[w].store(false, std::memory_order_relaxed);
+        }
+        excess[target] += addedExcess[target];
+        addedExcess[target] = 0;
+
+        // Gap heuristic: if no node is left with some label, the nodes with larger labels
+        // cannot reach the target anymore.
+        index newGap = gap;
+#pragma omp parallel for reduction(min : newGap)
+        for (omp_index i = 0; i < active; ++i) {
+            const index old = oldLabels[i];
+            if (old < newGap && old != labels[activeNodes[i]] && labelCount[old] == 0)
+                newGap = old;
+        }
+        gap = newGap;
+
+        activeNodes.clear();
+        for (const node w : nextActive) {
+            if (labels[w] < gap)
+                activeNodes.push_back(w);
+            else
+                labels[w] = z;
+        }
+    }
+}
+
+void ParallelPushRelabel::discharge(node v, node target, std::vector<node> &discovered,
+                                    count &work) {
+    const count z = graph->upperNodeIdBound();
+    const index oldLabel = labels[v];
+    index label = oldLabel;
+    edgeweight e = excess[v];
+
+    // Decides which of two active neighbors may push to the other in this round, so that no
+    // arc is used in both directions at the same time.
+    auto wins = [&](node w) {
+        const index wLabel = labels[w];
+        return oldLabel == wLabel + 1 || oldLabel + 1 < wLabel || (oldLabel == wLabel && v < w);
+    };
+
+    while (e > 0) {
+        index relabel = z;
+        bool skipped = false;
+        work += offsets[v + 1] - offsets[v] + dischargeOverhead;
+
+        for (index a = offsets[v]; a < offsets[v + 1] && e > 0; ++a) {
+            const edgeweight capacity = atomicRead(residual[a]);
+            if (capacity <= 0)
+                continue;
+            const node w = heads[a];
+            const index wLabel = labels[w];
+            if (label == wLabel + 1) {
+                if (w != target && excess[w] > 0 && !wins(w)) {
+                    skipped = true;
+                    continue;
+                }
+                const edgeweight delta = std::min(capacity, e);
+                atomicAdd(residual[a], -delta);
+                atomicAdd(residual[reverseArcs[a]], delta);
+                atomicAdd(addedExcess[w], delta);
+                e -= delta;
+                if (w != target && !isDiscovered[w].exchange(true, std::memory_order_relaxed))
+                    discovered.push_back(w);
+            } else if (wLabel >= label) {
+                relabel = std::min(relabel, wLabel + 1);
+            }
+        }
+
+        if (e <= 0 || skipped)
+            break;
+        label = relabel;
+        if (label >= gap) {
+            label = z;
+            break;
+        }
+    }
+
+    newLabels[v] = label;
+    atomicAdd(addedExcess[v], e - excess[v]);
+    if (e > 0 && label < z && !isDiscovered[v].exchange(true, std::memory_order_relaxed))
+        discovered.push_back(v);
+}
+
+void ParallelPushRelabel::globalRelabel(node target, node excluded) {
+    const count z = graph->upperNodeIdBound();
+
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        labels[u] = z;
+
+    // Reverse breadth-first search from the target over the arcs with residual capacity.
+    isDiscovered[excluded].store(true, std::memory_order_relaxed);
+    std::vector<index> levelBegin;
+    const std::vector<node> order = parallelBFS(
+        target, isDiscovered,
+        [&](node u, auto visit) {
+            for (index a = offsets[u]; a < offsets[u + 1]; ++a)
+                if (residual[reverseArcs[a]] > 0)
+                    visit(heads[a]);
+        },
+        levelBegin);
+    isDiscovered[excluded].store(false, std::memory_order_relaxed);
+
+    labelCount.assign(levelBegin.size(), 0);
+    for (index d = 0; d + 1 < levelBegin.size(); ++d)
+        labelCount[d] = levelBegin[d + 1] - levelBegin[d];
+    gap = levelBegin.size() - 1;
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index d = 0; d < static_cast<omp_index>(gap); ++d)
+        for (index i = levelBegin[d]; i < levelBegin[d + 1]; ++i) {
+            labels[order[i]] = d;
+            isDiscovered[order[i]].store(false, std::memory_order_relaxed);
+        }
+}
+
+void ParallelPushRelabel::collectActiveNodes(node target, node excluded) {
+    std::vector<std::vector<node>> local(omp_get_max_threads());
+    graph->parallelForNodes([&](node u) {
+        if (excess[u] > 0 && labels[u] < gap && u != target && u != excluded)
+            local[omp_get_thread_num()].push_back(u);
+    });
+    activeNodes.clear();
+    concatenate(local, activeNodes);
+}
+
+edgeweight ParallelPushRelabel::getMaxFlow() const {
+    assureFinished();
+    return flowValue;
+}
+
+std::vector<node> ParallelPushRelabel::getSourceSet() const {
+    assureFinished();
+    std::vector<std::atomic<bool>> visited(graph->upperNodeIdBound());
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(visited.size()); ++u)
+        visited[u].store(false, std::memory_order_relaxed);
+
+    std::vector<index> levelBegin;
+    return parallelBFS(
+        source, visited,
+        [&](node u, auto visit) {
+            for (index a = offsets[u]; a < offsets[u + 1]; ++a)
+                if (residual[a] > 0)
+                    visit(heads[a]);
+        },
+        levelBegin);
+}
+
+edgeweight ParallelPushRelabel::getFlow(node u, node v) const {
+    assureFinished();
+    const edgeweight f = flow[graph->edgeId(u, v)];
+    if (graph->isDirected())
+        return f;
+    if (u >= v)
+        return f > 0 ? f : 0;
+    return f < 0 ? -f : 0;
+}
+
+const std::vector<edgeweight> &ParallelPushRelabel::getFlowVector() const {
+    assureFinished();
+    return flow;
+}
+
+} /* namespace NetworKit */
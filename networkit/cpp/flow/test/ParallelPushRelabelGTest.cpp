@@ -0,0 +1,162 @@
+/*
+ * ParallelPushRelabelGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/flow/EdmondsKarp.hpp>
+#include <networkit/flow/ParallelPushRelabel.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+class ParallelPushRelabelGTest : public testing::Test {
+protected:
+    // Checks that the flow respects the capacities, is conserved at all nodes other than source
+    // and sink and that its value equals the capacity of the cut around the source set.
+    static void checkFlow(const Graph &G, const ParallelPushRelabel &algo, node source, node sink) {
+        std::vector<edgeweight> balance(G.upperNodeIdBound(), 0);
+        G.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+            const edgeweight f = algo.getFlow(eid);
+            EXPECT_LE(std::abs(f), w + 1e-9);
+            if (G.isDirected()) {
+                EXPECT_GE(f, -1e-9);
+                balance[u] -= f;
+                balance[v] += f;
+            } else {
+                // positive flow goes from the larger to the smaller node id
+                balance[std::max(u, v)] -= f;
+                balance[std::min(u, v)] += f;
+            }
+        });
+        G.forNodes([&](node u) {
+            if (u != source && u != sink) {
+                EXPECT_NEAR(0, balance[u], 1e-9) << "flow is not conserved at node " << u;
+            }
+        });
+        EXPECT_NEAR(algo.getMaxFlow(), balance[sink], 1e-9);
+
+        std::vector<bool> inSourceSet(G.upperNodeIdBound(), false);
+        for (const node u : algo.getSourceSet())
+            inSourceSet[u] = true;
+        EXPECT_TRUE(inSourceSet[source]);
+        EXPECT_FALSE(inSourceSet[sink]);
+
+        edgeweight cut = 0;
+        G.forEdges([&](node u, node v, edgeweight w) {
+            if (inSourceSet[u] != inSourceSet[v] && (!G.isDirected() || inSourceSet[u]))
+                cut += w;
+        });
+        EXPECT_NEAR(algo.getMaxFlow(), cut, 1e-9);
+    }
+};
+
+TEST_F(ParallelPushRelabelGTest, testUndirected) {
+    Graph G(7, false);
+    G.addEdge(0, 1);
+    G.addEdge(0, 2);
+    G.addEdge(0, 3);
+    G.addEdge(1, 2);
+    G.addEdge(1, 4);
+    G.addEdge(2, 3);
+    G.addEdge(2, 4);
+    G.addEdge(3, 4);
+    G.addEdge(3, 5);
+    G.addEdge(4, 6);
+    G.addEdge(5, 6);
+    G.indexEdges();
+
+    ParallelPushRelabel algo(G, 0, 6);
+    algo.run();
+    EXPECT_DOUBLE_EQ(2, algo.getMaxFlow());
+    EXPECT_DOUBLE_EQ(1, algo.getFlow(4, 6));
+    EXPECT_DOUBLE_EQ(1, algo.getFlow(5, 6));
+    EXPECT_DOUBLE_EQ(0, algo.getFlow(6, 5));
+    EXPECT_THAT(algo.getSourceSet(), testing::UnorderedElementsAre(0, 1, 2, 3, 4));
+    checkFlow(G, algo, 0, 6);
+}
+
+TEST_F(ParallelPushRelabelGTest, testDirected) {
+    Graph G(6, true, true);
+    G.addEdge(0, 1, 5);
+    G.addEdge(0, 2, 15);
+    G.addEdge(1, 3, 5);
+    G.addEdge(1, 4, 5);
+    G.addEdge(2, 3, 5);
+    G.addEdge(2, 4, 5);
+    G.addEdge(3, 5, 15);
+    G.addEdge(4, 5, 5);
+    G.indexEdges();
+
+    ParallelPushRelabel algo(G, 0, 5);
+    algo.run();
+    EXPECT_DOUBLE_EQ(15, algo.getMaxFlow());
+    EXPECT_DOUBLE_EQ(5, algo.getFlow(4, 5));
+    checkFlow(G, algo, 0, 5);
+}
+
+TEST_F(ParallelPushRelabelGTest, testDirectedWithoutPath) {
+    Graph G(4, true, true);
+    G.addEdge(3, 2, 3.4);
+    G.addEdge(1, 2, 2.4);
+    G.addEdge(1, 0, 4.4);
+    G.indexEdges();
+
+    ParallelPushRelabel algo(G, 3, 0);
+    algo.run();
+    EXPECT_DOUBLE_EQ(0, algo.getMaxFlow());
+    EXPECT_THAT(algo.getSourceSet(), testing::UnorderedElementsAre(3, 2));
+    checkFlow(G, algo, 3, 0);
+}
+
+TEST_F(ParallelPushRelabelGTest, testRandomUndirected) {
+    Aux::Random::setSeed(42, false);
+    for (const count n : {50, 300}) {
+        Graph G = ErdosRenyiGenerator(n, 8.0 / n).generate();
+        Graph H(G, true, false);
+        H.forEdges([&](node u, node v) { H.setWeight(u, v, Aux::Random::integer(1, 10)); });
+        H.indexEdges();
+
+        for (index trial = 0; trial < 3; ++trial) {
+            const node source = Aux::Random::integer(n - 1);
+            node sink = Aux::Random::integer(n - 1);
+            if (sink == source)
+                sink = (source + 1) % n;
+
+            EdmondsKarp reference(H, source, sink);
+            reference.run();
+            ParallelPushRelabel algo(H, source, sink);
+            algo.run();
+
+            EXPECT_DOUBLE_EQ(reference.getMaxFlow(), algo.getMaxFlow());
+            auto expected = reference.getSourceSet(), actual = algo.getSourceSet();
+            std::sort(expected.begin(), expected.end());
+            std::sort(actual.begin(), actual.end());
+            EXPECT_EQ(expected, actual);
+            checkFlow(H, algo, source, sink);
+        }
+    }
+}
+
+TEST_F(ParallelPushRelabelGTest, testRandomDirected) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(500, 0.02, true).generate();
+    Graph H(G, true, true);
+    H.forEdges([&](node u, node v) { H.setWeight(u, v, Aux::Random::real(0.5, 2.0)); });
+    H.indexEdges();
+
+    ParallelPushRelabel algo(H, 0, 1);
+    algo.run();
+    EXPECT_GT(algo.getMaxFlow(), 0);
+    checkFlow(H, algo, 0, 1);
+}
+
+} // namespace NetworKit
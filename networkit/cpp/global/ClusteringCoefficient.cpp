@@ -13,6 +13,7 @@
 #include <networkit/centrality/LocalClusteringCoefficient.hpp>
 #include <networkit/global/ClusteringCoefficient.hpp>
 #include <networkit/graph/GraphTools.hpp>
+#include <networkit/graph/TriangleCounting.hpp>
 
 namespace NetworKit {
 
@@ -103,9 +104,9 @@ double ClusteringCoefficient::sequentialAvgLocal(const Graph &G) {
     return coefficient / size;
 }
 
-double ClusteringCoefficient::avgLocal(Graph &G, bool turbo) {
+double ClusteringCoefficient::avgLocal(Graph &G, bool) {
     WARN("DEPRECATED: use centrality.LocalClusteringCoefficient and take average");
-    LocalClusteringCoefficient lcc(G, turbo);
+    LocalClusteringCoefficient lcc(G);
     lcc.run();
     // $c(u) := \frac{2 \cdot |E(N(u))| }{\deg(u) \cdot ( \deg(u) - 1)}$
     auto coefficients = lcc.scores();
@@ -162,40 +163,40 @@ double ClusteringCoefficient::approxAvgLocal(Graph &G, const count trials) {
 }
 
 double ClusteringCoefficient::exactGlobal(Graph &G) {
-    count z = G.upperNodeIdBound();
-    // triangles including node u (every triangle is counted six times)
-    std::vector<count> triangles(z);
-
-    std::vector<std::vector<bool>> nodeMarker(omp_get_max_threads());
-    for (auto &nm : nodeMarker) {
-        nm.resize(z, false);
-    }
-
-    G.balancedParallelForNodes([&](node u) {
-        size_t tid = omp_get_thread_num();
-        count tr = 0;
-
-        if (G.degree(u) > 1) {
-            G.forEdgesOf(u, [&](node, node v) { nodeMarker[tid][v] = true; });
-
-            G.forEdgesOf(u, [&](node, node v) {
-                G.forEdgesOf(v, [&](node, node w) {
-                    if (nodeMarker[tid][w]) {
-                        tr += 1;
-                    }
-                });
-            });
-
-            G.forEdgesOf(u, [&](node, node v) { nodeMarker[tid][v] = false; });
-        }
-
-        triangles[u] = tr;
-    });
-
     double denominator =
         G.parallelSumForNodes([&](node u) { return G.degree(u) * (G.degree(u) - 1); });
 
-    double cc = G.parallelSumForNodes([&](node u) { return triangles[u]; });
+    double cc;
+    if (G.isDirected()) {
+        // TriangleCounting only supports undirected graphs: count the closed paths u -> v -> w
+        // with u -> w directly.
+        std::vector<std::vector<bool>> nodeMarker(omp_get_max_threads());
+        for (auto &nm : nodeMarker) {
+            nm.resize(G.upperNodeIdBound(), false);
+        }
+
+        cc = G.parallelSumForNodes([&](node u) {
+            size_t tid = omp_get_thread_num();
+            count tr = 0;
+            if (G.degree(u) > 1) {
+                G.forEdgesOf(u, [&](node, node v) { nodeMarker[tid][v] = true; });
+                G.forEdgesOf(u, [&](node, node v) {
+                    G.forEdgesOf(v, [&](node, node w) {
+                        if (nodeMarker[tid][w]) {
+                            tr += 1;
+                        }
+                    });
+                });
+                G.forEdgesOf(u, [&](node, node v) { nodeMarker[tid][v] = false; });
+            }
+            return tr;
+        });
+    } else {
+        TriangleCounting triangleCounting(G);
+        triangleCounting.run();
+        // every triangle closes six of the paths of length two counted by the denominator
+        cc = 6.0 * static_cast<double>(triangleCounting.numberOfTriangles());
+    }
 
     if (denominator == 0) {
         return 0; // no triangle exists
@@ -41,4 +41,15 @@ TEST_F(GlobalGTest, testGlobalClusteringCoefficient) {
     EXPECT_NEAR(ccg, 18.0 / 34.0, 1e-9);
 }
 
+TEST_F(GlobalGTest, testGlobalClusteringCoefficientDirected) {
+    // Out-edges are treated like undirected edges: of the paths 0 -> 1 -> 2 and 0 -> 2 -> 1
+    // only the first one exists, and it is closed by 0 -> 2.
+    Graph G(3, false, true);
+    G.addEdge(0, 1);
+    G.addEdge(0, 2);
+    G.addEdge(1, 2);
+
+    EXPECT_NEAR(ClusteringCoefficient::exactGlobal(G), 0.5, 1e-9);
+}
+
 } /* namespace NetworKit */
@@ -0,0 +1,192 @@
+/*
+ * CSRGraph.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <numeric>
+
+#include <networkit/graph/CSRGraph.hpp>
+
+namespace NetworKit {
+
+CSRGraph::CSRGraph(count n, bool weighted, bool directed, bool edgesIndexed)
+    : n(n), m(0), storedNumberOfSelfLoops(0), z(n), omega(0), weighted(weighted),
+      directed(directed), edgesIndexed(edgesIndexed) {}
+
+CSRGraph::CSRGraph(const Graph &G, bool parallel)
+    : n(G.numberOfNodes()), m(G.numberOfEdges()), storedNumberOfSelfLoops(G.numberOfSelfLoops()),
+      z(G.upperNodeIdBound()), omega(G.upperEdgeIdBound()), weighted(G.isWeighted()),
+      directed(G.isDirected()), edgesIndexed(G.hasEdgeIds()) {
+
+    std::vector<uint8_t> nodeExists(z, 0);
+    G.forNodes([&](node u) { nodeExists[u] = 1; });
+
+    std::vector<index> outOffsets(z + 1, 0), inOffsets(directed ? z + 1 : 0, 0);
+
+    // Degrees are stored shifted by one, so that the prefix sum yields the offsets.
+#pragma omp parallel for if (parallel)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        if (!G.hasNode(u))
+            continue;
+        outOffsets[u + 1] = G.degreeOut(u);
+        if (directed)
+            inOffsets[u + 1] = G.degreeIn(u);
+    }
+
+    std::partial_sum(outOffsets.begin(), outOffsets.end(), outOffsets.begin());
+    std::vector<node> outNeighbors(outOffsets.back());
+    std::vector<edgeweight> outWeights(weighted ? outOffsets.back() : 0);
+    std::vector<edgeid> outIds(edgesIndexed ? outOffsets.back() : 0);
+
+    std::vector<node> inNeighbors;
+    std::vector<edgeweight> inWeights;
+    std::vector<edgeid> inIds;
+    if (directed) {
+        std::partial_sum(inOffsets.begin(), inOffsets.end(), inOffsets.begin());
+        inNeighbors.resize(inOffsets.back());
+        if (weighted)
+            inWeights.resize(inOffsets.back());
+        if (edgesIndexed)
+            inIds.resize(inOffsets.back());
+    }
+
+    // Each node writes to its own (disjoint) range of the arrays.
+#pragma omp parallel for schedule(guided) if (parallel)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        if (!G.hasNode(u))
+            continue;
+
+        index i = outOffsets[u];
+        G.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+            outNeighbors[i] = v;
+            if (weighted)
+                outWeights[i] = w;
+            if (edgesIndexed)
+                outIds[i] = eid;
+            ++i;
+        });
+        assert(i == outOffsets[u + 1]);
+
+        if (!directed)
+            continue;
+
+        i = inOffsets[u];
+        G.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+            inNeighbors[i] = v;
+            if (weighted)
+                inWeights[i] = w;
+            if (edgesIndexed)
+                inIds[i] = eid;
+            ++i;
+        });
+        assert(i == inOffsets[u + 1]);
+    }
+
+    exists = std::move(nodeExists);
+    outBegin = std::move(outOffsets);
+    outEdges = std::move(outNeighbors);
+    outEdgeWeights = std::move(outWeights);
+    outEdgeIds = std::move(outIds);
+    inBegin = std::move(inOffsets);
+    inEdges = std::move(inNeighbors);
+    inEdgeWeights = std::move(inWeights);
+    inEdgeIds = std::move(inIds);
+}
+
+CSRGraph::CSRGraph(std::vector<index> offsets, std::vector<node> neighbors,
+                   std::vector<edgeweight> weights)
+    : CSRGraph(offsets.size() - 1, true, false, false) {
+    assert(!offsets.empty() && offsets.front() == 0 && offsets.back() == neighbors.size());
+    assert(weights.size() == neighbors.size());
+
+    count selfLoops = 0;
+#pragma omp parallel for schedule(guided) reduction(+ : selfLoops)
+    for (omp_index u = 0; u < static_cast<omp_index>(n); ++u)
+        for (index i = offsets[u]; i < offsets[u + 1]; ++i)
+            selfLoops += (neighbors[i] == static_cast<node>(u));
+
+    m = (neighbors.size() - selfLoops) / 2 + selfLoops;
+    storedNumberOfSelfLoops = selfLoops;
+
+    exists = std::vector<uint8_t>(n, 1);
+    outBegin = std::move(offsets);
+    outEdges = std::move(neighbors);
+    outEdgeWeights = std::move(weights);
+}
+
+Graph CSRGraph::toGraph() const {
+    Graph G(z, weighted, directed, edgesIndexed);
+
+    forNodes([&](node u) {
+        if (directed)
+            G.preallocateDirected(u, degreeOut(u), degreeIn(u));
+        else
+            G.preallocateUndirected(u, degree(u));
+
+        for (index i = outBegin[u]; i < outBegin[u + 1]; ++i)
+            G.addPartialOutEdge(unsafe, u, outEdges[i],
+                                weighted ? outEdgeWeights[i] : defaultEdgeWeight,
+                                edgesIndexed ? outEdgeIds[i] : 0);
+
+        if (!directed)
+            return;
+
+        for (index i = inBegin[u]; i < inBegin[u + 1]; ++i)
+            G.addPartialInEdge(unsafe, u, inEdges[i],
+                               weighted ? inEdgeWeights[i] : defaultEdgeWeight,
+                               edgesIndexed ? inEdgeIds[i] : 0);
+    });
+
+    for (node u = 0; u < z; ++u)
+        if (!exists[u])
+            G.removeNode(u);
+
+    G.setEdgeCount(unsafe, m);
+    G.setNumberOfSelfLoops(unsafe, storedNumberOfSelfLoops);
+    G.setUpperEdgeIdBound(unsafe, omega);
+
+    return G;
+}
+
+edgeweight CSRGraph::weightedDegree(node u, bool countSelfLoopsTwice) const {
+    edgeweight sum = 0.0;
+    for (index i = outBegin[u]; i < outBegin[u + 1]; ++i) {
+        const edgeweight w = weighted ? outEdgeWeights[i] : defaultEdgeWeight;
+        sum += (countSelfLoopsTwice && outEdges[i] == u) ? 2. * w : w;
+    }
+    return sum;
+}
+
+edgeweight CSRGraph::weightedDegreeIn(node u, bool countSelfLoopsTwice) const {
+    if (!directed)
+        return weightedDegree(u, countSelfLoopsTwice);
+
+    edgeweight sum = 0.0;
+    for (index i = inBegin[u]; i < inBegin[u + 1]; ++i) {
+        const edgeweight w = weighted ? inEdgeWeights[i] : defaultEdgeWeight;
+        sum += (countSelfLoopsTwice && inEdges[i] == u) ? 2. * w : w;
+    }
+    return sum;
+}
+
+bool CSRGraph::hasEdge(node u, node v) const noexcept {
+    if (!hasNode(u) || !hasNode(v))
+        return false;
+    return std::find(neighborsBegin(u), neighborsEnd(u), v) != neighborsEnd(u);
+}
+
+edgeweight CSRGraph::weight(node u, node v) const {
+    const auto it = std::find(neighborsBegin(u), neighborsEnd(u), v);
+    if (it == neighborsEnd(u))
+        return nullWeight;
+    return weighted ? outEdgeWeights[static_cast<index>(it - outEdges.data())] : defaultEdgeWeight;
+}
+
+edgeweight CSRGraph::totalEdgeWeight() const noexcept {
+    if (weighted)
+        return parallelSumForEdges([](node, node, edgeweight ew) { return ew; });
+    return numberOfEdges() * defaultEdgeWeight;
+}
+
+} // namespace NetworKit
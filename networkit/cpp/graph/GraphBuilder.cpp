@@ -5,6 +5,8 @@
  *      Author: Marvin Ritter (marvin.ritter@gmail.com)
  */
 
+#include <algorithm>
+#include <numeric>
 #include <omp.h>
 #include <stdexcept>
 
@@ -174,6 +176,119 @@ Graph GraphBuilder::completeGraph(bool parallel) {
     return G;
 }
 
+CSRGraph GraphBuilder::completeCSRGraph() {
+    CSRGraph G(n, weighted, directed, false);
+
+    // number of 'second' half edges that end in each node
+    std::vector<count> missingEdgesCounts(n, 0);
+    parallelForNodes([&](node v) {
+        for (const node u : outEdges[v]) {
+            if (directed || u != v) {
+#pragma omp atomic
+                ++missingEdgesCounts[u];
+            }
+        }
+    });
+
+    // offsets; degrees are stored shifted by one so that the prefix sum yields the offsets
+    std::vector<index> outBegin(n + 1, 0), inBegin(directed ? n + 1 : 0, 0);
+    parallelForNodes([&](node u) {
+        if (directed) {
+            outBegin[u + 1] = outEdges[u].size();
+            inBegin[u + 1] = missingEdgesCounts[u];
+        } else {
+            outBegin[u + 1] = outEdges[u].size() + missingEdgesCounts[u];
+        }
+    });
+
+    std::partial_sum(outBegin.begin(), outBegin.end(), outBegin.begin());
+    std::vector<node> csrOutEdges(outBegin.back());
+    std::vector<edgeweight> csrOutEdgeWeights(weighted ? outBegin.back() : 0);
+
+    std::vector<node> csrInEdges;
+    std::vector<edgeweight> csrInEdgeWeights;
+    if (directed) {
+        std::partial_sum(inBegin.begin(), inBegin.end(), inBegin.begin());
+        csrInEdges.resize(inBegin.back());
+        if (weighted)
+            csrInEdgeWeights.resize(inBegin.back());
+    }
+
+    auto &secondBegin = directed ? inBegin : outBegin;
+    auto &secondEdges = directed ? csrInEdges : csrOutEdges;
+    auto &secondWeights = directed ? csrInEdgeWeights : csrOutEdgeWeights;
+
+    // 'first' half of the edges; for undirected graphs, the 'second' half is appended to it
+    std::vector<index> cursor(n);
+    parallelForNodes([&](node u) {
+        std::copy(outEdges[u].begin(), outEdges[u].end(), csrOutEdges.begin() + outBegin[u]);
+        if (weighted)
+            std::copy(outEdgeWeights[u].begin(), outEdgeWeights[u].end(),
+                      csrOutEdgeWeights.begin() + outBegin[u]);
+        cursor[u] = directed ? inBegin[u] : outBegin[u] + outEdges[u].size();
+    });
+
+    // 'second' half of the edges
+    parallelForNodes([&](node v) {
+        for (index i = 0; i < outEdges[v].size(); ++i) {
+            const node u = outEdges[v][i];
+            if (!directed && u == v)
+                continue;
+            index pos;
+#pragma omp atomic capture
+            pos = cursor[u]++;
+            secondEdges[pos] = v;
+            if (weighted)
+                secondWeights[pos] = outEdgeWeights[v][i];
+        }
+    });
+
+    // The atomic cursors produce an arbitrary order; restore the order of completeGraph(false),
+    // i.e., sort the 'second' half edges by their source node.
+    std::vector<std::vector<index>> permPerThread(omp_get_max_threads());
+    std::vector<std::vector<edgeweight>> weightsPerThread(omp_get_max_threads());
+    parallelForNodes([&](node u) {
+        const index first = directed ? secondBegin[u] : outBegin[u] + outEdges[u].size();
+        const index last = secondBegin[u + 1];
+        if (last - first < 2)
+            return;
+
+        auto &perm = permPerThread[omp_get_thread_num()];
+        perm.resize(last - first);
+        std::iota(perm.begin(), perm.end(), first);
+        // ties (multi-edges) are inserted by the same thread in order, keep that order
+        std::stable_sort(perm.begin(), perm.end(),
+                         [&](index a, index b) { return secondEdges[a] < secondEdges[b]; });
+
+        if (weighted) {
+            auto &weights = weightsPerThread[omp_get_thread_num()];
+            weights.resize(perm.size());
+            for (index i = 0; i < perm.size(); ++i)
+                weights[i] = secondWeights[perm[i]];
+            std::copy(weights.begin(), weights.end(), secondWeights.begin() + first);
+        }
+        std::sort(secondEdges.begin() + first, secondEdges.begin() + last);
+    });
+
+    if (directed)
+        G.m = outBegin.back();
+    else
+        G.m = (outBegin.back() - selfloops) / 2 + selfloops;
+    G.storedNumberOfSelfLoops = selfloops;
+
+    G.exists = std::vector<uint8_t>(n, 1);
+    G.outBegin = std::move(outBegin);
+    G.outEdges = std::move(csrOutEdges);
+    G.outEdgeWeights = std::move(csrOutEdgeWeights);
+    G.inBegin = std::move(inBegin);
+    G.inEdges = std::move(csrInEdges);
+    G.inEdgeWeights = std::move(csrInEdgeWeights);
+
+    reset();
+
+    return G;
+}
+
 void GraphBuilder::toGraphParallel(Graph &G) {
     // basic idea of the parallelization:
     // 1) each threads collects its own data
@@ -0,0 +1,161 @@
+/*
+ * TriangleCounting.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include <networkit/auxiliary/SetIntersector.hpp>
+#include <networkit/graph/TriangleCounting.hpp>
+
+namespace NetworKit {
+
+TriangleCounting::TriangleCounting(const Graph &G, bool nodeCounts, bool edgeCounts)
+    : G(&G), nodeCounts(nodeCounts), edgeCounts(edgeCounts) {
+    if (G.isDirected())
+        throw std::runtime_error("Error, triangle counting is only implemented for undirected "
+                                 "graphs");
+    if (edgeCounts && !G.hasEdgeIds())
+        throw std::runtime_error("edges have not been indexed - call indexEdges first");
+}
+
+void TriangleCounting::run() {
+    const count z = G->upperNodeIdBound();
+    const count n = G->numberOfNodes();
+
+    // Rank the nodes by degree (ties broken by id) with a counting sort.
+    count maxDegree = 0;
+    G->forNodes([&](node u) { maxDegree = std::max(maxDegree, G->degree(u)); });
+    std::vector<index> degreeBegin(maxDegree + 2, 0);
+    G->forNodes([&](node u) { ++degreeBegin[G->degree(u) + 1]; });
+    std::partial_sum(degreeBegin.begin(), degreeBegin.end(), degreeBegin.begin());
+    std::vector<node> order(n);
+    std::vector<index> rank(z, none);
+    G->forNodes([&](node u) {
+        const index r = degreeBegin[G->degree(u)]++;
+        order[r] = u;
+        rank[u] = r;
+    });
+
+    // Every edge is oriented towards the endpoint of higher rank. The out-neighbors are stored
+    // as sorted ranks, together with the ids of the out-edges.
+    std::vector<index> outBegin(n + 1, 0);
+#pragma omp parallel for
+    for (omp_index r = 0; r < static_cast<omp_index>(n); ++r) {
+        count deg = 0;
+        G->forNeighborsOf(order[r], [&](node v) { deg += rank[v] > static_cast<index>(r); });
+        outBegin[r + 1] = deg;
+    }
+    std::partial_sum(outBegin.begin(), outBegin.end(), outBegin.begin());
+
+    std::vector<index> outRanks(outBegin[n]);
+    std::vector<edgeid> outEdges(edgeCounts ? outBegin[n] : 0);
+#pragma omp parallel
+    {
+        std::vector<std::pair<index, edgeid>> local;
+#pragma omp for schedule(guided)
+        for (omp_index r = 0; r < static_cast<omp_index>(n); ++r) {
+            const auto begin = static_cast<std::ptrdiff_t>(outBegin[r]);
+            if (!edgeCounts) {
+                index pos = outBegin[r];
+                G->forNeighborsOf(order[r], [&](node v) {
+                    if (rank[v] > static_cast<index>(r))
+                        outRanks[pos++] = rank[v];
+                });
+                std::sort(outRanks.begin() + begin, outRanks.begin() + outBegin[r + 1]);
+                continue;
+            }
+
+            local.clear();
+            G->forNeighborsOf(order[r], [&](node, node v, edgeweight, edgeid eid) {
+                if (rank[v] > static_cast<index>(r))
+                    local.emplace_back(rank[v], eid);
+            });
+            std::sort(local.begin(), local.end());
+            for (index i = 0; i < local.size(); ++i) {
+                outRanks[outBegin[r] + i] = local[i].first;
+                outEdges[outBegin[r] + i] = local[i].second;
+            }
+        }
+    }
+
+    nodeData.assign(nodeCounts ? z : 0, 0);
+    // Triangles of each out-edge, in the order of outRanks
+    std::vector<count> outEdgeTriangles(edgeCounts ? outBegin[n] : 0, 0);
+    total = 0;
+
+    count maxOutDegree = 0;
+    for (index r = 0; r < n; ++r)
+        maxOutDegree = std::max(maxOutDegree, outBegin[r + 1] - outBegin[r]);
+
+    count sum = 0;
+#pragma omp parallel reduction(+ : sum)
+    {
+        // Number of triangles of u that contain the out-edge to the i-th out-neighbor of u;
+        // this is also the count that u adds to that neighbor.
+        std::vector<count> local(maxOutDegree, 0);
+
+#pragma omp for schedule(dynamic, 64)
+        for (omp_index r = 0; r < static_cast<omp_index>(n); ++r) {
+            const index beginU = outBegin[r];
+            const index *outU = outRanks.data() + beginU;
+            const count degU = outBegin[r + 1] - beginU;
+            count trianglesOfU = 0;
+
+            // Triangle {u, v, w}: rank(u) < rank(v) < rank(w), so w comes after v in the
+            // out-neighbors of u.
+            for (index i = 0; i + 1 < degU; ++i) {
+                const index beginV = outBegin[outU[i]];
+                count trianglesOfUV = 0;
+                Aux::forSortedIntersection(
+                    outU + i + 1, degU - i - 1, outRanks.data() + beginV,
+                    outBegin[outU[i] + 1] - beginV, [&](index j, index k) {
+                        ++trianglesOfUV;
+                        ++local[i + 1 + j];
+                        if (edgeCounts) {
+#pragma omp atomic
+                            ++outEdgeTriangles[beginV + k];
+                        }
+                    });
+                local[i] += trianglesOfUV;
+                trianglesOfU += trianglesOfUV;
+            }
+
+            if (trianglesOfU == 0)
+                continue;
+            sum += trianglesOfU;
+            if (nodeCounts) {
+#pragma omp atomic
+                nodeData[order[r]] += trianglesOfU;
+            }
+            for (index i = 0; i < degU; ++i) {
+                const count c = local[i];
+                if (c == 0)
+                    continue;
+                local[i] = 0;
+                if (nodeCounts) {
+#pragma omp atomic
+                    nodeData[order[outU[i]]] += c;
+                }
+                if (edgeCounts) {
+#pragma omp atomic
+                    outEdgeTriangles[beginU + i] += c;
+                }
+            }
+        }
+    }
+    total = sum;
+
+    if (edgeCounts) {
+        edgeData.assign(G->upperEdgeIdBound(), 0);
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(outEdges.size()); ++i)
+            edgeData[outEdges[i]] = outEdgeTriangles[i];
+    }
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,224 @@
+/*
+ * CSRGraphGTest.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/BFS.hpp>
+#include <networkit/graph/CSRGraph.hpp>
+#include <networkit/graph/Dijkstra.hpp>
+#include <networkit/graph/GraphBuilder.hpp>
+#include <networkit/graph/GraphTools.hpp>
+
+namespace NetworKit {
+
+class CSRGraphGTest : public testing::TestWithParam<std::pair<bool, bool>> {
+protected:
+    bool weighted() const noexcept { return GetParam().first; }
+    bool directed() const noexcept { return GetParam().second; }
+
+    Graph generateGraph(count n, double p, bool indexEdges = false) const {
+        Graph G = ErdosRenyiGenerator(n, p, directed()).generate();
+        if (weighted()) {
+            G = GraphTools::toWeighted(G);
+            G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::probability()); });
+        }
+        if (indexEdges)
+            G.indexEdges();
+        return G;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, CSRGraphGTest,
+                         testing::Values(std::make_pair(false, false), std::make_pair(true, false),
+                                         std::make_pair(false, true), std::make_pair(true, true)));
+
+TEST_P(CSRGraphGTest, testSnapshotMatchesGraph) {
+    Aux::Random::setSeed(42, false);
+    Graph G = generateGraph(300, 0.05, true);
+    G.addEdge(3, 3);
+    G.removeNode(7);
+    G.removeNode(42);
+
+    for (bool parallel : {false, true}) {
+        const CSRGraph C(G, parallel);
+        EXPECT_EQ(C.numberOfNodes(), G.numberOfNodes());
+        EXPECT_EQ(C.numberOfEdges(), G.numberOfEdges());
+        EXPECT_EQ(C.numberOfSelfLoops(), G.numberOfSelfLoops());
+        EXPECT_EQ(C.upperNodeIdBound(), G.upperNodeIdBound());
+        EXPECT_EQ(C.upperEdgeIdBound(), G.upperEdgeIdBound());
+        EXPECT_EQ(C.isWeighted(), G.isWeighted());
+        EXPECT_EQ(C.isDirected(), G.isDirected());
+        EXPECT_TRUE(C.hasEdgeIds());
+        EXPECT_FALSE(C.hasNode(7));
+        EXPECT_DOUBLE_EQ(C.totalEdgeWeight(), G.totalEdgeWeight());
+
+        count nodes = 0;
+        C.forNodes([&](node u) {
+            ++nodes;
+            EXPECT_TRUE(G.hasNode(u));
+            ASSERT_EQ(C.degree(u), G.degree(u));
+            ASSERT_EQ(C.degreeIn(u), G.degreeIn(u));
+            EXPECT_DOUBLE_EQ(C.weightedDegree(u, true), G.weightedDegree(u, true));
+            EXPECT_DOUBLE_EQ(C.weightedDegreeIn(u), G.weightedDegreeIn(u));
+
+            std::vector<WeightedEdgeWithId> expected, actual;
+            G.forNeighborsOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+                expected.emplace_back(u, v, w, eid);
+            });
+            C.forNeighborsOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+                actual.emplace_back(u, v, w, eid);
+            });
+            ASSERT_EQ(actual.size(), expected.size());
+            for (index i = 0; i < actual.size(); ++i) {
+                EXPECT_EQ(actual[i].v, expected[i].v);
+                EXPECT_EQ(actual[i].weight, expected[i].weight);
+                EXPECT_EQ(actual[i].eid, expected[i].eid);
+                EXPECT_EQ(C.getIthNeighbor(u, i), G.getIthNeighbor(u, i));
+            }
+
+            expected.clear();
+            actual.clear();
+            G.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+                expected.emplace_back(u, v, w, eid);
+            });
+            C.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+                actual.emplace_back(u, v, w, eid);
+            });
+            ASSERT_EQ(actual.size(), expected.size());
+            for (index i = 0; i < actual.size(); ++i) {
+                EXPECT_EQ(actual[i].v, expected[i].v);
+                EXPECT_EQ(actual[i].weight, expected[i].weight);
+                EXPECT_EQ(actual[i].eid, expected[i].eid);
+            }
+        });
+        EXPECT_EQ(nodes, G.numberOfNodes());
+
+        count edges = 0;
+        C.forEdges([&](node u, node v, edgeweight w) {
+            ++edges;
+            EXPECT_TRUE(G.hasEdge(u, v));
+            EXPECT_TRUE(C.hasEdge(u, v));
+            EXPECT_EQ(G.weight(u, v), w);
+            EXPECT_EQ(C.weight(u, v), w);
+        });
+        EXPECT_EQ(edges, G.numberOfEdges());
+
+        EXPECT_DOUBLE_EQ(C.parallelSumForEdges([](node, node, edgeweight w) { return w; }),
+                         G.parallelSumForEdges([](node, node, edgeweight w) { return w; }));
+        EXPECT_EQ(C.parallelSumForNodes([&](node u) { return C.degree(u); }),
+                  G.parallelSumForNodes([&](node u) { return G.degree(u); }));
+    }
+}
+
+TEST_P(CSRGraphGTest, testToGraph) {
+    Aux::Random::setSeed(42, false);
+    Graph G = generateGraph(200, 0.05, true);
+    G.removeNode(5);
+
+    const Graph H = CSRGraph(G).toGraph();
+    EXPECT_EQ(H.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(H.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(H.upperEdgeIdBound(), G.upperEdgeIdBound());
+    EXPECT_TRUE(H.checkConsistency());
+    G.forEdges([&](node u, node v, edgeweight w, edgeid eid) {
+        EXPECT_TRUE(H.hasEdge(u, v));
+        EXPECT_EQ(H.weight(u, v), w);
+        EXPECT_EQ(H.edgeId(u, v), eid);
+    });
+}
+
+TEST_P(CSRGraphGTest, testTraversals) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = generateGraph(300, 0.02);
+    const CSRGraph C(G);
+
+    for (node source : {0, 17, 123}) {
+        std::vector<std::pair<node, count>> expected, actual;
+        Traversal::BFSfrom(G, source, [&](node u, count d) { expected.emplace_back(u, d); });
+        Traversal::BFSfrom(C, source, [&](node u, count d) { actual.emplace_back(u, d); });
+        EXPECT_EQ(actual, expected);
+
+        std::vector<std::pair<node, edgeweight>> expectedDist, actualDist;
+        Traversal::DijkstraFrom(G, source,
+                                [&](node u, edgeweight d) { expectedDist.emplace_back(u, d); });
+        Traversal::DijkstraFrom(C, source,
+                                [&](node u, edgeweight d) { actualDist.emplace_back(u, d); });
+        EXPECT_EQ(actualDist, expectedDist);
+    }
+}
+
+TEST_P(CSRGraphGTest, testCompleteCSRGraph) {
+    Aux::Random::setSeed(42, false);
+    constexpr count n = 250;
+    GraphBuilder b1(n, weighted(), directed()), b2(n, weighted(), directed());
+    for (node u = 0; u < n; ++u) {
+        for (node v = 0; v < n; ++v) {
+            if ((directed() || u <= v) && Aux::Random::probability() < 0.05) {
+                const edgeweight w = weighted() ? Aux::Random::probability() : defaultEdgeWeight;
+                b1.addHalfEdge(u, v, w);
+                b2.addHalfEdge(u, v, w);
+            }
+        }
+    }
+
+    const Graph G = b1.completeGraph(false);
+    const CSRGraph C = b2.completeCSRGraph();
+
+    EXPECT_EQ(C.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(C.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(C.numberOfSelfLoops(), G.numberOfSelfLoops());
+    G.forNodes([&](node u) {
+        ASSERT_EQ(C.degree(u), G.degree(u));
+        ASSERT_EQ(C.degreeIn(u), G.degreeIn(u));
+        for (index i = 0; i < G.degree(u); ++i) {
+            EXPECT_EQ(C.getIthNeighbor(u, i), G.getIthNeighbor(u, i));
+            EXPECT_EQ(C.getIthNeighborWeight(u, i), G.getIthNeighborWeight(u, i));
+        }
+        if (!directed())
+            return;
+        for (index i = 0; i < G.degreeIn(u); ++i)
+            EXPECT_EQ(C.getIthInNeighbor(u, i), G.getIthInNeighbor(u, i));
+    });
+}
+
+TEST_P(CSRGraphGTest, testFromAdjacencyArrays) {
+    if (directed())
+        return;
+
+    Graph G = ErdosRenyiGenerator(200, 0.05).generate();
+    G = Graph(G, true, false);
+    G.forNodes([&](node u) {
+        if (u % 10 == 0)
+            G.addEdge(u, u);
+    });
+    G.forEdges([&](node u, node v) { G.setWeight(u, v, static_cast<edgeweight>(u + v + 1)); });
+
+    std::vector<index> offsets(G.upperNodeIdBound() + 1, 0);
+    std::vector<node> neighbors;
+    std::vector<edgeweight> weights;
+    G.forNodes([&](node u) {
+        G.forNeighborsOf(u, [&](node v, edgeweight ew) {
+            neighbors.push_back(v);
+            weights.push_back(ew);
+        });
+        offsets[u + 1] = neighbors.size();
+    });
+
+    const CSRGraph C(std::move(offsets), std::move(neighbors), std::move(weights));
+    EXPECT_EQ(C.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(C.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(C.numberOfSelfLoops(), G.numberOfSelfLoops());
+    EXPECT_TRUE(C.isWeighted());
+    EXPECT_FALSE(C.isDirected());
+    EXPECT_DOUBLE_EQ(C.totalEdgeWeight(), G.totalEdgeWeight());
+    G.forNodes([&](node u) {
+        EXPECT_DOUBLE_EQ(C.weightedDegree(u, true), G.weightedDegree(u, true));
+        G.forNeighborsOf(u, [&](node v, edgeweight ew) { EXPECT_EQ(C.weight(u, v), ew); });
+    });
+}
+
+} // namespace NetworKit
@@ -0,0 +1,66 @@
+/*
+ * TriangleCountingGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/TriangleCounting.hpp>
+
+namespace NetworKit {
+
+class TriangleCountingGTest : public testing::Test {};
+
+TEST_F(TriangleCountingGTest, testTriangleCounting) {
+    Aux::Random::setSeed(42, false);
+    for (const double p : {0.01, 0.1, 0.5}) {
+        Graph G = ErdosRenyiGenerator(200, p).generate();
+        // Deleted nodes and high-degree hubs, such that neighborhoods of very different sizes
+        // are intersected
+        for (node u = 0; u < 200; u += 11)
+            G.removeNode(u);
+        for (const node hub : {1, 2}) {
+            G.forNodes([&](node v) {
+                if (v != hub && !G.hasEdge(hub, v))
+                    G.addEdge(hub, v);
+            });
+        }
+        G.indexEdges();
+
+        std::vector<count> nodeRef(G.upperNodeIdBound()), edgeRef(G.upperEdgeIdBound());
+        count totalRef = 0;
+        G.forEdges([&](node u, node v, edgeweight, edgeid eid) {
+            G.forNeighborsOf(u, [&](node w) {
+                if (G.hasEdge(v, w))
+                    ++edgeRef[eid];
+            });
+        });
+        G.forNodes([&](node u) {
+            G.forNeighborsOf(u, [&](node v) {
+                G.forNeighborsOf(u, [&](node w) {
+                    if (v < w && G.hasEdge(v, w))
+                        ++nodeRef[u];
+                });
+            });
+            totalRef += nodeRef[u];
+        });
+
+        TriangleCounting triangles(G, true, true);
+        triangles.run();
+        EXPECT_EQ(triangles.numberOfTriangles(), totalRef / 3);
+        G.forNodes([&](node u) { EXPECT_EQ(triangles.nodeTriangles()[u], nodeRef[u]); });
+        G.forEdges([&](node, node, edgeweight, edgeid eid) {
+            EXPECT_EQ(triangles.edgeTriangles()[eid], edgeRef[eid]);
+        });
+
+        TriangleCounting nodesOnly(G);
+        nodesOnly.run();
+        EXPECT_EQ(nodesOnly.nodeTriangles(), triangles.nodeTriangles());
+        EXPECT_THROW(nodesOnly.edgeTriangles(), std::runtime_error);
+    }
+}
+
+} // namespace NetworKit
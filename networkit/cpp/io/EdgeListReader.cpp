@@ -5,11 +5,19 @@
  *      Author: cls
  */
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <fstream>
+#include <numeric>
 #include <sstream>
 
+#include <omp.h>
+
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/NumberParsing.hpp>
+#include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/EdgeListReader.hpp>
 #include <networkit/io/MemoryMappedFile.hpp>
@@ -17,9 +25,9 @@
 namespace NetworKit {
 
 EdgeListReader::EdgeListReader(char separator, node firstNode, const std::string &commentPrefix,
-                               bool continuous, bool directed)
+                               bool continuous, bool directed, bool parallel)
     : separator(separator), commentPrefix(commentPrefix), firstNode(firstNode),
-      continuous(continuous), mapNodeIds(), directed(directed) {
+      continuous(continuous), mapNodeIds(), directed(directed), parallel(parallel) {
     if (!continuous && firstNode != 0) {
         // firstNode not being 0 in the continuous = false case leads to a segmentation fault
         WARN("firstNode set to 0 since continuous is false");
@@ -35,6 +43,9 @@ const std::map<std::string, node> &EdgeListReader::getNodeMap() const {
 }
 
 Graph EdgeListReader::read(const std::string &path) {
+    if (parallel)
+        return readParallel(path);
+
     this->mapNodeIds.clear();
     MemoryMappedFile mmfile(path);
     auto it = mmfile.cbegin();
@@ -165,4 +176,411 @@ Graph EdgeListReader::read(const std::string &path) {
     return graph;
 }
 
+namespace {
+
+// An edge as parsed from a line: either two node ids (continuous case) or the file offsets of
+// the two id tokens, which are later replaced by their mapped ids.
+struct ParsedEdge {
+    uint64_t source;
+    uint64_t target;
+    edgeweight weight;
+};
+
+// Half-edge stored at one of its endpoints. The index of the line it stems from is used to
+// reproduce the order (and the duplicate handling) of the sequential reader.
+struct HalfEdge {
+    node neighbor;
+    index line;
+    edgeweight weight;
+};
+
+class LineTokenizer {
+public:
+    LineTokenizer(const char *begin, const char *end, char separator)
+        : begin(begin), end(end), separator(separator) {}
+
+    bool isLineEnd(char c) const noexcept { return c == '\n' || c == '\r'; }
+
+    bool isDelimiter(char c) const noexcept { return c == ' ' || c == separator; }
+
+    const char *skipDelimiters(const char *it) const noexcept {
+        while (it != end && isDelimiter(*it))
+            ++it;
+        return it;
+    }
+
+    const char *tokenEnd(const char *it) const noexcept {
+        while (it != end && !isDelimiter(*it) && !isLineEnd(*it))
+            ++it;
+        return it;
+    }
+
+    const char *lineEnd(const char *it) const noexcept {
+        while (it != end && !isLineEnd(*it))
+            ++it;
+        return it;
+    }
+
+    // Returns the first position after the next line ending at or behind it.
+    const char *nextLine(const char *it) const noexcept {
+        it = lineEnd(it);
+        return it == end ? end : it + 1;
+    }
+
+    const char *const begin;
+    const char *const end;
+
+private:
+    const char separator;
+};
+
+uint64_t parseId(const char *it, const char *end) {
+    if (it == end || !std::isdigit(static_cast<unsigned char>(*it)))
+        throw std::runtime_error("Scanning node failed. The file may be corrupt.");
+    uint64_t value;
+    std::tie(value, it) = Aux::Parsing::strTo<uint64_t>(it, end);
+    if (it != end)
+        throw std::runtime_error("Scanning node failed. The file may be corrupt.");
+    return value;
+}
+
+edgeweight parseWeight(const char *it, const char *end) {
+    if (it == end)
+        throw std::runtime_error("Error in parsing file - looking for weight failed");
+    edgeweight value;
+    try {
+        std::tie(value, it) = Aux::Parsing::strTo<edgeweight>(it, end);
+    } catch (std::invalid_argument &) {
+        it = nullptr;
+    }
+    if (it != end)
+        throw std::runtime_error("Error in parsing file - looking for weight failed");
+    return value;
+}
+
+/**
+ * Open addressing hash table that maps the text of id tokens to the first position at which
+ * they occur in the file. Slots store offset + 1, so that zero marks an empty slot. Concurrent
+ * insertions are resolved with compare-and-swap; if the same token is inserted from several
+ * positions, the slot keeps the smallest one.
+ */
+class ConcurrentTokenMap {
+public:
+    ConcurrentTokenMap(const LineTokenizer &tokenizer, count numberOfTokens)
+        : tokenizer(tokenizer) {
+        count capacity = 1;
+        while (capacity < 2 * numberOfTokens)
+            capacity *= 2;
+        mask = capacity - 1;
+        slots = std::vector<std::atomic<uint64_t>>(capacity);
+
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(capacity); ++i)
+            slots[i].store(0, std::memory_order_relaxed);
+    }
+
+    // Inserts the token starting at the given file offset and returns the index of its slot.
+    index insert(uint64_t offset) {
+        const char *token = tokenizer.begin + offset;
+        const char *tokenEnd = tokenizer.tokenEnd(token);
+
+        for (index slot = hash(token, tokenEnd) & mask;; slot = (slot + 1) & mask) {
+            uint64_t current = slots[slot].load(std::memory_order_relaxed);
+            if (current == 0) {
+                if (slots[slot].compare_exchange_strong(current, offset + 1))
+                    return slot;
+                // Another thread claimed the slot, current now holds its offset.
+            }
+            if (equals(current - 1, token, tokenEnd)) {
+                Aux::Parallel::atomic_min(slots[slot], offset + 1);
+                return slot;
+            }
+        }
+    }
+
+    count capacity() const noexcept { return slots.size(); }
+
+    // Returns the offset of the first occurrence of the slot's token or none if it is empty.
+    uint64_t firstOccurrence(index slot) const noexcept {
+        const uint64_t value = slots[slot].load(std::memory_order_relaxed);
+        return value == 0 ? none : value - 1;
+    }
+
+private:
+    const LineTokenizer &tokenizer;
+    std::vector<std::atomic<uint64_t>> slots;
+    uint64_t mask;
+
+    static uint64_t hash(const char *it, const char *end) noexcept {
+        // 64-bit FNV-1a
+        uint64_t h = 14695981039346656037ULL;
+        for (; it != end; ++it) {
+            h ^= static_cast<unsigned char>(*it);
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    bool equals(uint64_t offset, const char *token, const char *tokenEnd) const noexcept {
+        const char *other = tokenizer.begin + offset;
+        const auto length = static_cast<size_t>(tokenEnd - token);
+        return static_cast<size_t>(tokenizer.tokenEnd(other) - other) == length
+               && std::equal(token, tokenEnd, other);
+    }
+};
+
+// Sorts the half-edges by neighbor, drops all but the first one (w.r.t. the line) per neighbor
+// and restores the line order. Returns the new end of the range.
+HalfEdge *removeMultiEdges(HalfEdge *first, HalfEdge *last) {
+    std::sort(first, last, [](const HalfEdge &a, const HalfEdge &b) {
+        return a.neighbor < b.neighbor || (a.neighbor == b.neighbor && a.line < b.line);
+    });
+    last = std::unique(first, last, [](const HalfEdge &a, const HalfEdge &b) {
+        return a.neighbor == b.neighbor;
+    });
+    std::sort(first, last, [](const HalfEdge &a, const HalfEdge &b) { return a.line < b.line; });
+    return last;
+}
+
+/**
+ * Builds a graph with nodes 0, ..., n-1 from edges whose endpoints are node ids. The adjacency
+ * lists have the same content and order as if the edges were inserted one after another with
+ * addEdge, skipping edges that are already present.
+ */
+Graph buildGraph(count n, bool weighted, bool directed, std::vector<ParsedEdge> &edges) {
+    const auto numEdges = static_cast<omp_index>(edges.size());
+
+    // Count the half-edges of each node, shifted by one to obtain offsets by a prefix sum.
+    std::vector<index> outBegin(n + 1, 0), inBegin(directed ? n + 1 : 0, 0);
+#pragma omp parallel for
+    for (omp_index e = 0; e < numEdges; ++e) {
+        const node u = edges[e].source, v = edges[e].target;
+#pragma omp atomic
+        ++outBegin[u + 1];
+        if (directed) {
+#pragma omp atomic
+            ++inBegin[v + 1];
+        } else if (u != v) {
+#pragma omp atomic
+            ++outBegin[v + 1];
+        }
+    }
+
+    std::partial_sum(outBegin.begin(), outBegin.end(), outBegin.begin());
+    if (directed)
+        std::partial_sum(inBegin.begin(), inBegin.end(), inBegin.begin());
+
+    std::vector<HalfEdge> outHalves(outBegin.back()), inHalves(directed ? inBegin.back() : 0);
+    {
+        std::vector<index> outPos(outBegin.begin(), outBegin.end() - 1);
+        std::vector<index> inPos(directed ? inBegin.begin() : inBegin.end(),
+                                 directed ? inBegin.end() - 1 : inBegin.end());
+
+        auto place = [](std::vector<HalfEdge> &halves, std::vector<index> &pos, node u,
+                        HalfEdge half) {
+            index i;
+#pragma omp atomic capture
+            i = pos[u]++;
+            halves[i] = half;
+        };
+
+#pragma omp parallel for
+        for (omp_index e = 0; e < numEdges; ++e) {
+            const auto &edge = edges[e];
+            place(outHalves, outPos, edge.source,
+                  HalfEdge{edge.target, static_cast<index>(e), edge.weight});
+            if (directed)
+                place(inHalves, inPos, edge.target,
+                      HalfEdge{edge.source, static_cast<index>(e), edge.weight});
+            else if (edge.source != edge.target)
+                place(outHalves, outPos, edge.target,
+                      HalfEdge{edge.source, static_cast<index>(e), edge.weight});
+        }
+    }
+
+    // The parsed edges are not needed anymore.
+    std::vector<ParsedEdge>().swap(edges);
+
+    Graph G(n, weighted, directed);
+    count halfEdges = 0, selfLoops = 0;
+
+#pragma omp parallel for schedule(guided) reduction(+ : halfEdges, selfLoops)
+    for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+        HalfEdge *outFirst = outHalves.data() + outBegin[u];
+        HalfEdge *outLast = removeMultiEdges(outFirst, outHalves.data() + outBegin[u + 1]);
+
+        if (directed) {
+            HalfEdge *inFirst = inHalves.data() + inBegin[u];
+            HalfEdge *inLast = removeMultiEdges(inFirst, inHalves.data() + inBegin[u + 1]);
+
+            G.preallocateDirected(u, outLast - outFirst, inLast - inFirst);
+            for (auto it = inFirst; it != inLast; ++it)
+                G.addPartialInEdge(unsafe, u, it->neighbor, it->weight);
+            for (auto it = outFirst; it != outLast; ++it)
+                G.addPartialOutEdge(unsafe, u, it->neighbor, it->weight);
+        } else {
+            G.preallocateUndirected(u, outLast - outFirst);
+            for (auto it = outFirst; it != outLast; ++it)
+                G.addPartialEdge(unsafe, u, it->neighbor, it->weight);
+        }
+
+        halfEdges += outLast - outFirst;
+        selfLoops += std::count_if(outFirst, outLast,
+                                   [u](const HalfEdge &half) { return half.neighbor == u; });
+    }
+
+    G.setEdgeCount(unsafe, directed ? halfEdges : (halfEdges - selfLoops) / 2 + selfLoops);
+    G.setNumberOfSelfLoops(unsafe, selfLoops);
+    return G;
+}
+
+} // namespace
+
+Graph EdgeListReader::readParallel(const std::string &path) {
+    this->mapNodeIds.clear();
+    MemoryMappedFile mmfile(path);
+    const LineTokenizer tokenizer(mmfile.cbegin(), mmfile.cend(), separator);
+
+    auto isSkipped = [&](const char *it) -> bool {
+        return it == tokenizer.end || tokenizer.isLineEnd(*it)
+               || (!commentPrefix.empty() && *it == commentPrefix[0]);
+    };
+
+    // As in the sequential reader, the first edge line decides whether the graph is weighted.
+    bool weighted = false;
+    for (const char *it = tokenizer.begin; it != tokenizer.end; it = tokenizer.nextLine(it)) {
+        const char *first = tokenizer.skipDelimiters(it);
+        if (isSkipped(first))
+            continue;
+        const char *second = tokenizer.skipDelimiters(tokenizer.tokenEnd(first));
+        const char *third = tokenizer.skipDelimiters(tokenizer.tokenEnd(second));
+        weighted = third != tokenizer.end && !tokenizer.isLineEnd(*third);
+        break;
+    }
+
+    // Split the file into chunks that start at line boundaries.
+    const auto fileSize = static_cast<count>(tokenizer.end - tokenizer.begin);
+    const count numChunks = std::max<count>(
+        1, std::min<count>(fileSize >> 16, 16 * static_cast<count>(omp_get_max_threads())));
+    std::vector<const char *> chunkBegin(numChunks + 1, tokenizer.end);
+    chunkBegin[0] = tokenizer.begin;
+    for (count c = 1; c < numChunks; ++c) {
+        const char *it = std::max(chunkBegin[c - 1], tokenizer.begin + c * (fileSize / numChunks));
+        // Step behind the line ending, unless we already are at the beginning of a line.
+        if (it != tokenizer.begin && !tokenizer.isLineEnd(*(it - 1)))
+            it = tokenizer.nextLine(it);
+        chunkBegin[c] = it;
+    }
+
+    std::vector<std::vector<ParsedEdge>> chunkEdges(numChunks);
+    std::vector<std::exception_ptr> chunkErrors(numChunks);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+        try {
+            auto &edges = chunkEdges[c];
+            for (const char *it = chunkBegin[c]; it < chunkBegin[c + 1];
+                 it = tokenizer.nextLine(it)) {
+                const char *first = tokenizer.skipDelimiters(it);
+                if (isSkipped(first))
+                    continue;
+                const char *firstEnd = tokenizer.tokenEnd(first);
+                const char *second = tokenizer.skipDelimiters(firstEnd);
+                if (second == tokenizer.end || tokenizer.isLineEnd(*second))
+                    throw std::runtime_error("Unexpected end of line, expected two node ids");
+                const char *secondEnd = tokenizer.tokenEnd(second);
+
+                ParsedEdge edge;
+                if (continuous) {
+                    edge.source = parseId(first, firstEnd);
+                    edge.target = parseId(second, secondEnd);
+                    if (edge.source < firstNode || edge.target < firstNode)
+                        throw std::runtime_error("Node id is smaller than the first node id");
+                    edge.source -= firstNode;
+                    edge.target -= firstNode;
+                } else {
+                    edge.source = static_cast<uint64_t>(first - tokenizer.begin);
+                    edge.target = static_cast<uint64_t>(second - tokenizer.begin);
+                }
+
+                edge.weight = defaultEdgeWeight;
+                if (weighted) {
+                    const char *third = tokenizer.skipDelimiters(secondEnd);
+                    edge.weight = parseWeight(third, tokenizer.tokenEnd(third));
+                }
+
+                edges.push_back(edge);
+                it = secondEnd;
+            }
+        } catch (...) {
+            chunkErrors[c] = std::current_exception();
+        }
+    }
+
+    // Report the error that occurs first in the file.
+    for (const auto &error : chunkErrors)
+        if (error)
+            std::rethrow_exception(error);
+
+    // Concatenate the chunks, preserving the order of the lines.
+    std::vector<index> chunkOffset(numChunks + 1, 0);
+    for (count c = 0; c < numChunks; ++c)
+        chunkOffset[c + 1] = chunkOffset[c] + chunkEdges[c].size();
+
+    std::vector<ParsedEdge> edges(chunkOffset.back());
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+        std::copy(chunkEdges[c].begin(), chunkEdges[c].end(), edges.begin() + chunkOffset[c]);
+        std::vector<ParsedEdge>().swap(chunkEdges[c]);
+    }
+
+    const auto numEdges = static_cast<omp_index>(edges.size());
+    count n = 0;
+
+    if (continuous) {
+        node maxId = 0;
+#pragma omp parallel for reduction(max : maxId)
+        for (omp_index e = 0; e < numEdges; ++e)
+            maxId = std::max<node>(maxId, std::max(edges[e].source, edges[e].target));
+        n = edges.empty() ? 0 : maxId + 1;
+    } else {
+        ConcurrentTokenMap tokenMap(tokenizer, 2 * edges.size());
+
+        // Replace the token offsets by slot indices.
+#pragma omp parallel for
+        for (omp_index e = 0; e < numEdges; ++e) {
+            edges[e].source = tokenMap.insert(edges[e].source);
+            edges[e].target = tokenMap.insert(edges[e].target);
+        }
+
+        // Ids are assigned in the order of the first occurrence, as in the sequential reader.
+        std::vector<index> usedSlots;
+        for (index slot = 0; slot < tokenMap.capacity(); ++slot)
+            if (tokenMap.firstOccurrence(slot) != none)
+                usedSlots.push_back(slot);
+        Aux::Parallel::sort(usedSlots.begin(), usedSlots.end(), [&](index a, index b) {
+            return tokenMap.firstOccurrence(a) < tokenMap.firstOccurrence(b);
+        });
+
+        n = usedSlots.size();
+        std::vector<node> slotToNode(tokenMap.capacity(), none);
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i)
+            slotToNode[usedSlots[i]] = static_cast<node>(i);
+
+#pragma omp parallel for
+        for (omp_index e = 0; e < numEdges; ++e) {
+            edges[e].source = slotToNode[edges[e].source];
+            edges[e].target = slotToNode[edges[e].target];
+        }
+
+        for (node u = 0; u < n; ++u) {
+            const char *token = tokenizer.begin + tokenMap.firstOccurrence(usedSlots[u]);
+            mapNodeIds.emplace(std::string(token, tokenizer.tokenEnd(token)), u);
+        }
+    }
+
+    return buildGraph(n, weighted, directed, edges);
+}
+
 } /* namespace NetworKit */
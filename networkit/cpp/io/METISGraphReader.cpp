@@ -5,15 +5,25 @@
  *      Author: Christian Staudt
  */
 
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+#include <omp.h>
+
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/NumberParsing.hpp>
 #include <networkit/auxiliary/StringTools.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 #include <networkit/io/METISParser.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
 
 namespace NetworKit {
 
 Graph METISGraphReader::read(const std::string &path) {
+    if (parallel)
+        return readParallel(path);
 
     METISParser parser(path);
 
@@ -124,4 +134,190 @@ Graph METISGraphReader::read(const std::string &path) {
     return G;
 }
 
+namespace {
+
+// Returns the end of the line starting at it (the position of '\n' or end).
+const char *lineEnd(const char *it, const char *end) {
+    const auto *pos = static_cast<const char *>(std::memchr(it, '\n', end - it));
+    return pos ? pos : end;
+}
+
+// Parses the adjacencies of one line in the same way as METISParser::getNext and
+// METISParser::getNextWithWeights.
+void parseAdjacencies(const char *it, const char *end, count ignoreFirst, bool weighted,
+                      std::vector<std::pair<node, edgeweight>> &adjacencies) {
+    adjacencies.clear();
+    for (index i = 0; i < ignoreFirst; ++i) {
+        double dummy;
+        std::tie(dummy, it) = Aux::Parsing::strTo<double>(it, end);
+    }
+
+    node v;
+    while (it != end) {
+        if (!weighted) {
+            std::tie(v, it) = Aux::Parsing::strTo<node>(it, end);
+            adjacencies.emplace_back(v, defaultEdgeWeight);
+            continue;
+        }
+
+        try {
+            double weight;
+            std::tie(v, it) = Aux::Parsing::strTo<node>(it, end);
+            std::tie(weight, it) =
+                Aux::Parsing::strTo<double, decltype(it), Aux::Checkers::Enforcer>(it, end);
+            adjacencies.emplace_back(v, weight);
+        } catch (const std::exception &e) {
+            ERROR("malformed line; not all edges have been read correctly");
+            break;
+        }
+    }
+}
+
+} // namespace
+
+Graph METISGraphReader::readParallel(const std::string &path) {
+    MemoryMappedFile mmfile(path);
+    const char *const begin = mmfile.cbegin();
+    const char *const end = mmfile.cend();
+
+    // Header, preceded by optional comment lines
+    const char *it = begin;
+    while (it != end && *it == '%')
+        it = std::min(lineEnd(it, end) + 1, end);
+    if (it == end) {
+        ERROR("getline not successful");
+        throw std::runtime_error("getting METIS file header failed");
+    }
+
+    const char *const headerEnd = lineEnd(it, end);
+    std::vector<count> tokens;
+    while (it != headerEnd) {
+        count token;
+        std::tie(token, it) = Aux::Parsing::strTo<count>(it, headerEnd);
+        tokens.push_back(token);
+    }
+    if (tokens.size() < 2)
+        throw std::runtime_error("getting METIS file header failed");
+
+    const count n = tokens[0];
+    const count m = tokens[1];
+    const index fmt = tokens.size() >= 3 ? tokens[2] : 0;
+    const count ncon = tokens.size() >= 4 ? tokens[3] : (tokens.size() == 3 ? 1 : 0);
+    if (fmt >= 2)
+        WARN("nodes are weighted; node weights will be ignored");
+
+    const bool weighted = fmt % 10 == 1;
+    const count ignoreFirst = fmt / 10 == 1 ? ncon : 0;
+
+    Graph G(n, weighted);
+    std::string graphName =
+        Aux::StringTools::split(Aux::StringTools::split(path, '/').back(), '.').front();
+
+    INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);
+
+    // Find the beginnings of all non-comment lines. The i-th of them is the adjacency line of
+    // node i. Each chunk collects the lines starting within it.
+    const char *const body = std::min(headerEnd + 1, end);
+    const auto bodySize = static_cast<count>(end - body);
+    const count numChunks = std::max<count>(
+        1, std::min<count>(bodySize >> 16, 16 * static_cast<count>(omp_get_max_threads())));
+    std::vector<std::vector<const char *>> chunkLines(numChunks);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+        const char *pos = body + c * (bodySize / numChunks);
+        const char *const chunkEnd =
+            c + 1 == static_cast<omp_index>(numChunks) ? end : pos + bodySize / numChunks;
+
+        // Move to the first line starting in this chunk.
+        if (pos != body && *(pos - 1) != '\n')
+            pos = std::min(lineEnd(pos, end) + 1, end);
+
+        for (; pos < chunkEnd; pos = std::min(lineEnd(pos, end) + 1, end))
+            if (*pos != '%')
+                chunkLines[c].push_back(pos);
+    }
+
+    std::vector<const char *> lines;
+    for (auto &chunk : chunkLines) {
+        lines.insert(lines.end(), chunk.begin(), chunk.end());
+        std::vector<const char *>().swap(chunk);
+    }
+    // Missing lines correspond to nodes without neighbors.
+    const count numLines = std::min(n, static_cast<count>(lines.size()));
+
+    count edgeCounter = 0;
+    count selfLoops = 0;
+    node errorNode = none;
+    std::exception_ptr error;
+
+#pragma omp parallel reduction(+ : edgeCounter, selfLoops)
+    {
+        std::vector<std::pair<node, edgeweight>> adjacencies;
+        std::vector<node> sortedNeighbors;
+
+#pragma omp for schedule(dynamic, 64)
+        for (omp_index i = 0; i < static_cast<omp_index>(numLines); ++i) {
+            const auto u = static_cast<node>(i);
+            try {
+                parseAdjacencies(lines[u], lineEnd(lines[u], end), ignoreFirst, weighted,
+                                 adjacencies);
+                edgeCounter += adjacencies.size();
+
+                // Only check for multi-edges when the line actually contains some.
+                sortedNeighbors.clear();
+                for (const auto &adjacency : adjacencies)
+                    sortedNeighbors.push_back(adjacency.first);
+                std::sort(sortedNeighbors.begin(), sortedNeighbors.end());
+                const bool hasDuplicates =
+                    std::adjacent_find(sortedNeighbors.begin(), sortedNeighbors.end())
+                    != sortedNeighbors.end();
+
+                G.preallocateUndirected(u, adjacencies.size());
+                for (const auto &adjacency : adjacencies) {
+                    if (adjacency.first == 0) {
+                        ERROR("METIS Node ID should not be 0, edge ignored.");
+                        continue;
+                    }
+                    Aux::Checkers::Enforcer::enforce(adjacency.first > 0 && adjacency.first <= n);
+                    const node v = adjacency.first - 1; // METIS-indices are 1-based
+                    // correct edgeCounter for selfloops
+                    if (u == v) {
+                        ++edgeCounter;
+                        ++selfLoops;
+                    }
+                    if (!G.addPartialEdge(unsafe, u, v, adjacency.second, 0, hasDuplicates))
+                        WARN("Not adding edge ", u, "-", v, " since it is already present.");
+                }
+            } catch (...) {
+#pragma omp critical
+                {
+                    // Report the error of the first affected line.
+                    if (u < errorNode) {
+                        errorNode = u;
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+
+    G.setEdgeCount(unsafe, edgeCounter / 2);
+    G.setNumberOfSelfLoops(unsafe, selfLoops);
+    if (G.numberOfEdges() != m) {
+        ERROR("METIS file ", path,
+              " is corrupted: actual number of added edges doesn't match the specifed number of "
+              "edges");
+    }
+    if (edgeCounter != 2 * m) {
+        WARN("METIS file is corrupted: not every edge is listed twice");
+    }
+
+    INFO("\n[DONE]\n");
+    return G;
+}
+
 } /* namespace NetworKit */
@@ -0,0 +1,124 @@
+/*
+ * NetworkitBinaryFixedWidthReader.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#include <networkit/io/MemoryMappedFile.hpp>
+#include <networkit/io/NetworkitBinaryFixedWidthReader.hpp>
+#include <networkit/io/NetworkitBinaryGraph.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+template <typename T>
+const T *arrayAt(const MemoryMappedFile &file, uint64_t offset, count size) {
+    if (!offset || offset % alignof(T) || offset > file.size()
+        || size > (file.size() - offset) / sizeof(T))
+        throw std::runtime_error("Fixed-width graph file is truncated or corrupt");
+    return reinterpret_cast<const T *>(file.cbegin() + offset);
+}
+
+// Checks that the offsets start at 0 and do not decrease, so that all lists lie within the array.
+void checkOffsets(const index *begin, count z) {
+    bool valid = begin[0] == 0;
+#pragma omp parallel for reduction(&& : valid)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        valid = valid && begin[u] <= begin[u + 1];
+    if (!valid)
+        throw std::runtime_error("Fixed-width graph file has invalid adjacency offsets");
+}
+
+// Checks that all node or edge ids are smaller than bound, as they are used as indices.
+void checkIds(const uint64_t *ids, count size, uint64_t bound) {
+    bool valid = true;
+#pragma omp parallel for reduction(&& : valid)
+    for (omp_index i = 0; i < static_cast<omp_index>(size); ++i)
+        valid = valid && ids[i] < bound;
+    if (!valid)
+        throw std::runtime_error("Fixed-width graph file contains out-of-range ids");
+}
+
+} // namespace
+
+CSRGraph NetworkitBinaryFixedWidthReader::map(const std::string &path, bool validate) {
+    auto file = std::make_shared<MemoryMappedFile>(path);
+    if (file->size() < sizeof(nkbg::FixedWidthHeader))
+        throw std::runtime_error("Fixed-width graph file is truncated or corrupt");
+
+    nkbg::FixedWidthHeader header;
+    std::memcpy(&header, file->cbegin(), sizeof(header));
+    if (std::memcmp(header.magic, nkbg::FIXED_WIDTH_MAGIC, 8))
+        throw std::runtime_error("Reader expected another magic value");
+
+    const bool directed = header.features & nkbg::DIR_MASK;
+    const auto weightFormat =
+        static_cast<nkbg::WeightFormat>((header.features & nkbg::WGHT_MASK) >> nkbg::WGHT_SHIFT);
+    if (weightFormat != nkbg::WeightFormat::NONE && weightFormat != nkbg::WeightFormat::DOUBLE)
+        throw std::runtime_error("Unsupported weight format in fixed-width graph file");
+    const bool weighted = weightFormat == nkbg::WeightFormat::DOUBLE;
+    const bool indexed = header.features & nkbg::INDEX_MASK;
+
+    const count z = header.nodes;
+    if (z >= (file->size() - sizeof(header)) / sizeof(index))
+        throw std::runtime_error("Fixed-width graph file is truncated or corrupt");
+    CSRGraph G(z, weighted, directed, indexed);
+    G.n = header.numberOfNodes;
+    G.m = header.numberOfEdges;
+    G.storedNumberOfSelfLoops = header.numberOfSelfLoops;
+    G.omega = header.upperEdgeIdBound;
+
+    G.exists = {arrayAt<uint8_t>(*file, header.offsetNodeFlags, z), z, file};
+
+    const auto *adjBegin = arrayAt<index>(*file, header.offsetAdjBegin, z + 1);
+    if (validate)
+        checkOffsets(adjBegin, z);
+    const count adjSize = adjBegin[z];
+    G.outBegin = {adjBegin, z + 1, file};
+    G.outEdges = {arrayAt<node>(*file, header.offsetAdjLists, adjSize), adjSize, file};
+    if (validate)
+        checkIds(G.outEdges.data(), adjSize, z);
+    if (weighted)
+        G.outEdgeWeights = {arrayAt<edgeweight>(*file, header.offsetWeightLists, adjSize),
+                            adjSize, file};
+    if (indexed) {
+        G.outEdgeIds = {arrayAt<edgeid>(*file, header.offsetAdjIdLists, adjSize), adjSize, file};
+        if (validate)
+            checkIds(G.outEdgeIds.data(), adjSize, G.omega);
+    }
+
+    if (directed) {
+        const auto *transposeBegin = arrayAt<index>(*file, header.offsetTransposeBegin, z + 1);
+        if (validate)
+            checkOffsets(transposeBegin, z);
+        const count transposeSize = transposeBegin[z];
+        G.inBegin = {transposeBegin, z + 1, file};
+        G.inEdges = {arrayAt<node>(*file, header.offsetAdjTranspose, transposeSize),
+                     transposeSize, file};
+        if (validate)
+            checkIds(G.inEdges.data(), transposeSize, z);
+        if (weighted)
+            G.inEdgeWeights = {
+                arrayAt<edgeweight>(*file, header.offsetWeightTranspose, transposeSize),
+                transposeSize, file};
+        if (indexed) {
+            G.inEdgeIds = {arrayAt<edgeid>(*file, header.offsetAdjIdTranspose, transposeSize),
+                           transposeSize, file};
+            if (validate)
+                checkIds(G.inEdgeIds.data(), transposeSize, G.omega);
+        }
+    }
+
+    return G;
+}
+
+Graph NetworkitBinaryFixedWidthReader::read(const std::string &path) {
+    return map(path, true).toGraph();
+}
+
+} // namespace NetworKit
@@ -0,0 +1,140 @@
+/*
+ * NetworkitBinaryFixedWidthWriter.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <networkit/auxiliary/Enforce.hpp>
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/io/NetworkitBinaryFixedWidthWriter.hpp>
+#include <networkit/io/NetworkitBinaryGraph.hpp>
+
+namespace NetworKit {
+
+void NetworkitBinaryFixedWidthWriter::write(const Graph &G, const std::string &path) {
+    std::ofstream outStream(path, std::ios::binary);
+    Aux::enforceOpened(outStream);
+
+    const count z = G.upperNodeIdBound();
+    const bool directed = G.isDirected();
+    const bool weighted = G.isWeighted();
+    const bool indexed = G.hasEdgeIds();
+
+    count adjSize = 0, transposeSize = 0;
+    G.forNodes([&](node u) {
+        adjSize += G.degreeOut(u);
+        if (directed)
+            transposeSize += G.degreeIn(u);
+    });
+
+    auto align = [](uint64_t offset) -> uint64_t { return (offset + 7) / 8 * 8; };
+
+    nkbg::FixedWidthHeader header;
+    std::memcpy(header.magic, nkbg::FIXED_WIDTH_MAGIC, 8);
+    const auto weightFormat = weighted ? nkbg::WeightFormat::DOUBLE : nkbg::WeightFormat::NONE;
+    header.features =
+        (directed & nkbg::DIR_MASK)
+        | ((static_cast<uint64_t>(weightFormat) << nkbg::WGHT_SHIFT) & nkbg::WGHT_MASK)
+        | ((static_cast<uint64_t>(indexed) << nkbg::INDEX_SHIFT) & nkbg::INDEX_MASK);
+    header.nodes = z;
+    header.numberOfNodes = G.numberOfNodes();
+    header.numberOfEdges = G.numberOfEdges();
+    header.numberOfSelfLoops = G.numberOfSelfLoops();
+    header.upperEdgeIdBound = G.upperEdgeIdBound();
+
+    uint64_t nextOffset = sizeof(nkbg::FixedWidthHeader);
+    auto reserve = [&](bool present, uint64_t bytes) -> uint64_t {
+        if (!present)
+            return 0;
+        const uint64_t offset = nextOffset;
+        nextOffset = align(nextOffset + bytes);
+        return offset;
+    };
+
+    header.offsetNodeFlags = reserve(true, z * sizeof(uint8_t));
+    header.offsetAdjBegin = reserve(true, (z + 1) * sizeof(index));
+    header.offsetAdjLists = reserve(true, adjSize * sizeof(node));
+    header.offsetWeightLists = reserve(weighted, adjSize * sizeof(edgeweight));
+    header.offsetAdjIdLists = reserve(indexed, adjSize * sizeof(edgeid));
+    header.offsetTransposeBegin = reserve(directed, (z + 1) * sizeof(index));
+    header.offsetAdjTranspose = reserve(directed, transposeSize * sizeof(node));
+    header.offsetWeightTranspose = reserve(directed && weighted, transposeSize * sizeof(edgeweight));
+    header.offsetAdjIdTranspose = reserve(directed && indexed, transposeSize * sizeof(edgeid));
+
+    static_assert(sizeof(nkbg::FixedWidthHeader) % 8 == 0, "header must keep the alignment");
+    outStream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    uint64_t written = sizeof(header);
+    auto writeArray = [&](const auto *data, count size) {
+        const auto bytes = size * sizeof(*data);
+        outStream.write(reinterpret_cast<const char *>(data), bytes);
+        written += bytes;
+    };
+    auto pad = [&]() {
+        static constexpr char zeros[8] = {};
+        outStream.write(zeros, align(written) - written);
+        written = align(written);
+    };
+
+    // Node flags
+    std::vector<uint8_t> nodeFlags(z, 0);
+    G.forNodes([&](node u) { nodeFlags[u] = 1; });
+    writeArray(nodeFlags.data(), z);
+    pad();
+
+    std::vector<node> neighbors;
+    std::vector<edgeweight> weights;
+    std::vector<edgeid> ids;
+
+    // Writes the offsets followed by the neighbors, weights and edge ids of all nodes.
+    auto writeLists = [&](bool transpose) {
+        index offset = 0;
+        writeArray(&offset, 1);
+        for (node u = 0; u < z; ++u) {
+            if (G.hasNode(u))
+                offset += transpose ? G.degreeIn(u) : G.degreeOut(u);
+            writeArray(&offset, 1);
+        }
+        pad();
+
+        for (int pass = 0; pass < 3; ++pass) {
+            if ((pass == 1 && !weighted) || (pass == 2 && !indexed))
+                continue;
+            G.forNodes([&](node u) {
+                neighbors.clear();
+                weights.clear();
+                ids.clear();
+                auto collect = [&](node, node v, edgeweight w, edgeid id) {
+                    neighbors.push_back(v);
+                    weights.push_back(w);
+                    ids.push_back(id);
+                };
+                if (transpose)
+                    G.forInEdgesOf(u, collect);
+                else
+                    G.forEdgesOf(u, collect);
+
+                if (pass == 0)
+                    writeArray(neighbors.data(), neighbors.size());
+                else if (pass == 1)
+                    writeArray(weights.data(), weights.size());
+                else
+                    writeArray(ids.data(), ids.size());
+            });
+            pad();
+        }
+    };
+
+    writeLists(false);
+    if (directed)
+        writeLists(true);
+
+    assert(written == nextOffset);
+    INFO("Written graph to ", path);
+}
+
+} // namespace NetworKit
@@ -14,11 +14,14 @@
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
 #include <networkit/algebraic/CSRMatrix.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/BinaryEdgeListPartitionReader.hpp>
 #include <networkit/io/BinaryEdgeListPartitionWriter.hpp>
 #include <networkit/io/BinaryPartitionReader.hpp>
@@ -39,6 +42,8 @@
 #include <networkit/io/KONECTGraphReader.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 #include <networkit/io/METISGraphWriter.hpp>
+#include <networkit/io/NetworkitBinaryFixedWidthReader.hpp>
+#include <networkit/io/NetworkitBinaryFixedWidthWriter.hpp>
 #include <networkit/io/MatrixMarketReader.hpp>
 #include <networkit/io/NetworkitBinaryGraph.hpp>
 #include <networkit/io/NetworkitBinaryReader.hpp>
@@ -247,6 +252,28 @@ TEST_F(IOGTest, testMETISGraphReaderWithTinyGraphs) {
     }
 }
 
+TEST_F(IOGTest, testMETISGraphReaderParallel) {
+    for (const auto &path :
+         {"input/jazz.graph", "input/PGPgiantcompo.graph", "input/lesmis.graph",
+          "input/jazz2double.graph", "input/tiny_01.graph", "input/tiny_02.graph",
+          "input/tiny_03.graph", "input/tiny_04.graph", "input/power.graph"}) {
+        const Graph expected = METISGraphReader{}.read(path);
+        const Graph actual = METISGraphReader{true}.read(path);
+
+        ASSERT_EQ(expected.numberOfNodes(), actual.numberOfNodes());
+        EXPECT_EQ(expected.numberOfEdges(), actual.numberOfEdges());
+        EXPECT_EQ(expected.numberOfSelfLoops(), actual.numberOfSelfLoops());
+        EXPECT_EQ(expected.isWeighted(), actual.isWeighted());
+        expected.forNodes([&](node u) {
+            ASSERT_EQ(expected.degree(u), actual.degree(u));
+            for (index i = 0; i < expected.degree(u); ++i) {
+                EXPECT_EQ(expected.getIthNeighbor(u, i), actual.getIthNeighbor(u, i));
+                EXPECT_EQ(expected.getIthNeighborWeight(u, i), actual.getIthNeighborWeight(u, i));
+            }
+        });
+    }
+}
+
 TEST_F(IOGTest, testMETISGraphWriter) {
     std::string path = "output/jazz1.graph";
     Graph G = Graph(3);
@@ -416,6 +443,68 @@ TEST_F(IOGTest, testEdgeListReader) {
     EXPECT_EQ(1, G5.weight(2, 3));
 }
 
+TEST_F(IOGTest, testEdgeListReaderParallel) {
+    auto expectSameGraph = [](const Graph &expected, const Graph &actual) {
+        ASSERT_EQ(expected.upperNodeIdBound(), actual.upperNodeIdBound());
+        EXPECT_EQ(expected.numberOfNodes(), actual.numberOfNodes());
+        EXPECT_EQ(expected.numberOfEdges(), actual.numberOfEdges());
+        EXPECT_EQ(expected.numberOfSelfLoops(), actual.numberOfSelfLoops());
+        EXPECT_EQ(expected.isWeighted(), actual.isWeighted());
+        EXPECT_EQ(expected.isDirected(), actual.isDirected());
+        expected.forNodes([&](node u) {
+            ASSERT_EQ(expected.degreeOut(u), actual.degreeOut(u));
+            ASSERT_EQ(expected.degreeIn(u), actual.degreeIn(u));
+            for (index i = 0; i < expected.degreeOut(u); ++i) {
+                EXPECT_EQ(expected.getIthNeighbor(u, i), actual.getIthNeighbor(u, i));
+                EXPECT_EQ(expected.getIthNeighborWeight(u, i), actual.getIthNeighborWeight(u, i));
+            }
+        });
+    };
+
+    // Multiple chunks, duplicates in both directions, self-loops and non-numeric ids
+    const std::string path = "output/parallelEdgeList.txt";
+    {
+        std::ofstream file(path);
+        file << "# generated edge list\n";
+        Aux::Random::setSeed(42, false);
+        for (count i = 0; i < 50000; ++i) {
+            const auto u = Aux::Random::integer(2000), v = Aux::Random::integer(2000);
+            file << "n" << u << " \tn" << v << '\t' << Aux::Random::integer(1, 9) << "\r\n";
+            if (i % 1000 == 0)
+                file << "\n# comment\n";
+        }
+    }
+
+    for (bool directed : {false, true}) {
+        EdgeListReader sequential('\t', 0, "#", false, directed);
+        EdgeListReader parallel('\t', 0, "#", false, directed, true);
+        expectSameGraph(sequential.read(path), parallel.read(path));
+        EXPECT_EQ(sequential.getNodeMap(), parallel.getNodeMap());
+    }
+
+    for (const auto &file :
+         {"input/network.dat", "input/example.edgelist", "input/comments.edgelist"}) {
+        expectSameGraph(EdgeListReader('\t', 1).read(file),
+                        EdgeListReader('\t', 1, "#", true, false, true).read(file));
+        expectSameGraph(EdgeListReader('\t', 1, "#", true, true).read(file),
+                        EdgeListReader('\t', 1, "#", true, true, true).read(file));
+    }
+
+    expectSameGraph(EdgeListReader('\t', 0).read("input/MIT8.edgelist"),
+                    EdgeListReader('\t', 0, "#", true, false, true).read("input/MIT8.edgelist"));
+
+    for (const auto &file :
+         {"input/spaceseparated.edgelist", "input/spaceseparated_weighted.edgelist"})
+        expectSameGraph(EdgeListReader(' ', 1).read(file),
+                        EdgeListReader(' ', 1, "#", true, false, true).read(file));
+
+    EdgeListReader sequential('\t', 0, "#", false, false);
+    EdgeListReader parallel('\t', 0, "#", false, false, true);
+    expectSameGraph(sequential.read("input/alphabet.edgelist"),
+                    parallel.read("input/alphabet.edgelist"));
+    EXPECT_EQ(sequential.getNodeMap(), parallel.getNodeMap());
+}
+
 TEST_F(IOGTest, testEdgeListPartitionReader) {
     EdgeListPartitionReader reader(1);
 
@@ -1245,6 +1334,114 @@ TEST_F(IOGTest, testNetworkitWriterNonContinuousNodesIds) {
     });
 }
 
+TEST_F(IOGTest, testNetworkitBinaryFixedWidth) {
+    for (bool directed : {false, true}) {
+        for (bool weighted : {false, true}) {
+            Graph G = ErdosRenyiGenerator(200, 0.05, directed).generate();
+            if (weighted) {
+                G = GraphTools::toWeighted(G);
+                G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::real()); });
+            }
+            G.indexEdges();
+            G.addEdge(3, 3);
+            G.removeNode(7);
+            G.removeNode(42);
+
+            const std::string path = "output/fixedWidth.nkbg";
+            NetworkitBinaryFixedWidthWriter{}.write(G, path);
+
+            const CSRGraph view = NetworkitBinaryFixedWidthReader{}.map(path);
+            EXPECT_EQ(view.numberOfNodes(), G.numberOfNodes());
+            EXPECT_EQ(view.upperNodeIdBound(), G.upperNodeIdBound());
+            EXPECT_EQ(view.numberOfEdges(), G.numberOfEdges());
+            EXPECT_EQ(view.numberOfSelfLoops(), G.numberOfSelfLoops());
+            EXPECT_EQ(view.upperEdgeIdBound(), G.upperEdgeIdBound());
+            EXPECT_EQ(view.isDirected(), directed);
+            EXPECT_EQ(view.isWeighted(), weighted);
+            EXPECT_TRUE(view.hasEdgeIds());
+
+            G.forNodes([&](node u) {
+                EXPECT_TRUE(view.hasNode(u));
+                std::vector<std::tuple<node, edgeweight, edgeid>> expected, actual;
+                G.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) {
+                    expected.emplace_back(v, w, id);
+                });
+                view.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) {
+                    actual.emplace_back(v, w, id);
+                });
+                EXPECT_EQ(expected, actual);
+
+                expected.clear();
+                actual.clear();
+                G.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) {
+                    expected.emplace_back(v, w, id);
+                });
+                view.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) {
+                    actual.emplace_back(v, w, id);
+                });
+                EXPECT_EQ(expected, actual);
+            });
+            EXPECT_FALSE(view.hasNode(7));
+            EXPECT_FALSE(view.hasNode(42));
+
+            const Graph G2 = NetworkitBinaryFixedWidthReader{}.read(path);
+            EXPECT_EQ(G2.numberOfNodes(), G.numberOfNodes());
+            EXPECT_EQ(G2.numberOfEdges(), G.numberOfEdges());
+            G.forEdges([&](node u, node v, edgeweight w, edgeid id) {
+                EXPECT_TRUE(G2.hasEdge(u, v));
+                EXPECT_EQ(G2.weight(u, v), w);
+                EXPECT_EQ(G2.edgeId(u, v), id);
+            });
+        }
+    }
+}
+
+TEST_F(IOGTest, testNetworkitBinaryFixedWidthRejectsOtherFormats) {
+    const Graph G = ErdosRenyiGenerator(20, 0.2).generate();
+    NetworkitBinaryWriter{}.write(G, "output/varint.nkbg");
+    EXPECT_THROW(NetworkitBinaryFixedWidthReader{}.map("output/varint.nkbg"), std::runtime_error);
+}
+
+TEST_F(IOGTest, testNetworkitBinaryFixedWidthRejectsCorruptFiles) {
+    Graph G = ErdosRenyiGenerator(20, 0.3).generate();
+    G.indexEdges();
+    const std::string path = "output/corrupt.nkbg";
+    NetworkitBinaryFixedWidthWriter{}.write(G, path);
+
+    std::string contents;
+    {
+        std::ifstream in(path, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    nkbg::FixedWidthHeader header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+
+    // Overwrites the index-th 64-bit entry of the array at offset and tries to map the file.
+    const auto mapCorrupted = [&](uint64_t offset, index i, uint64_t value) {
+        std::string corrupted = contents;
+        std::memcpy(&corrupted[offset + i * sizeof(uint64_t)], &value, sizeof(value));
+        std::ofstream(path, std::ios::binary) << corrupted;
+        NetworkitBinaryFixedWidthReader{}.map(path, true);
+    };
+
+    uint64_t adjBegin2;
+    std::memcpy(&adjBegin2, &contents[header.offsetAdjBegin + 2 * sizeof(uint64_t)],
+                sizeof(adjBegin2));
+    EXPECT_THROW(mapCorrupted(header.offsetAdjBegin, 1, adjBegin2 + 1), std::runtime_error);
+    EXPECT_THROW(mapCorrupted(header.offsetAdjBegin, 0, 1), std::runtime_error);
+    EXPECT_THROW(mapCorrupted(header.offsetAdjLists, 0, G.upperNodeIdBound()),
+                 std::runtime_error);
+    EXPECT_THROW(mapCorrupted(header.offsetAdjIdLists, 0, G.upperEdgeIdBound()),
+                 std::runtime_error);
+    EXPECT_NO_THROW(mapCorrupted(header.offsetAdjLists, 0, G.upperNodeIdBound() - 1));
+
+    // Without validation, only the header and the array bounds are checked.
+    EXPECT_THROW(mapCorrupted(header.offsetAdjLists, 0, G.upperNodeIdBound()),
+                 std::runtime_error);
+    EXPECT_NO_THROW(NetworkitBinaryFixedWidthReader{}.map(path));
+    EXPECT_THROW(NetworkitBinaryFixedWidthReader{}.read(path), std::runtime_error);
+}
+
 TEST_F(IOGTest, testMatrixMarketReaderUnweightedUndirected) {
     CSRMatrix csr = MatrixMarketReader{}.read("input/chesapeake.mtx");
     EXPECT_EQ(csr.numberOfRows(), 39);
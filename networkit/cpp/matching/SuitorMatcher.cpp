@@ -52,94 +52,94 @@ bool SuitorMatcher::hasEdgesSortedByWeight(const Graph &G) {
     return isSorted.load(std::memory_order_relaxed);
 }
 
-void SuitorMatcher::findSuitor(node current) {
-    bool done = false;
+bool SuitorMatcher::beatsSuitor(node u, edgeweight weight, node v, node &currentSuitor) const {
+    currentSuitor = suitor[v].load(std::memory_order_acquire);
+    const edgeweight currentWeight =
+        currentSuitor == none ? 0 : proposedWeight[currentSuitor].load(std::memory_order_relaxed);
+    return weight > currentWeight || (weight == currentWeight && u < currentSuitor);
+}
 
-    do {
+bool SuitorMatcher::propose(node current, node partner, edgeweight weight, node &displaced) {
+    proposedWeight[current].store(weight, std::memory_order_relaxed);
+    return suitor[partner].compare_exchange_strong(displaced, current, std::memory_order_acq_rel,
+                                                   std::memory_order_acquire);
+}
 
-        node partner = suitor[current];
-        edgeweight heaviest = ws[current];
+void SuitorMatcher::findSuitor(node current) {
+    while (current != none) {
+        node partner = none, displaced = none;
+        edgeweight heaviest = 0;
 
         G->forNeighborsOf(current, [&](const node v, const edgeweight weight) {
+            node currentSuitor;
             if ((weight > heaviest || (weight == heaviest && v < partner))
-                && (weight > ws[v] || (weight == ws[v] && current < suitor[v]))) {
+                && beatsSuitor(current, weight, v, currentSuitor)) {
                 partner = v;
                 heaviest = weight;
+                displaced = currentSuitor;
             }
         });
 
-        done = true;
-
-        if (partner != none
-            && (heaviest > ws[partner] || (heaviest == ws[partner] && current < suitor[partner]))) {
-            node y = suitor[partner];
-            suitor[partner] = current;
-            ws[partner] = heaviest;
+        if (partner == none)
+            return;
 
-            // if the current vertex already has a suitor
-            if (y != none) {
-                current = y;
-                done = false;
-            }
-        }
-    } while (!done);
+        // If another node became the suitor of partner in the meantime, search again.
+        if (propose(current, partner, heaviest, displaced))
+            current = displaced;
+    }
 }
 
 void SuitorMatcher::findSortSuitor(node current) {
-    bool done = false;
-
-    do {
-        node partner = suitor[current];
-        edgeweight heaviest = ws[current];
+    while (current != none) {
+        node partner = none, displaced = none;
+        edgeweight heaviest = 0;
 
         for (index &iter = neighborIterators[current]; iter < G->degree(current); ++iter) {
             const node v = G->getIthNeighbor(current, iter);
             const edgeweight weight = G->getIthNeighborWeight(current, iter);
-            if ((weight > heaviest || (weight == heaviest && v < partner))
-                && (weight > ws[v] || (weight == ws[v] && current < suitor[v]))) {
+            if (beatsSuitor(current, weight, v, displaced)) {
                 partner = v;
                 heaviest = weight;
-                ++iter;
                 break;
             }
         }
 
-        done = true;
-
-        if (partner != none
-            && (heaviest > ws[partner] || (heaviest == ws[partner] && current < suitor[partner]))) {
-            const node y = suitor[partner];
-            suitor[partner] = current;
-            ws[partner] = heaviest;
+        if (partner == none)
+            return;
 
-            // if the current vertex already has a suitor
-            if (y != none) {
-                current = y;
-                done = false;
-            }
+        // If another node became the suitor of partner in the meantime, partner is checked again.
+        if (propose(current, partner, heaviest, displaced)) {
+            ++neighborIterators[current];
+            current = displaced;
         }
-    } while (!done);
+    }
 }
 
 void SuitorMatcher::run() {
     const auto n = G->upperNodeIdBound();
-    suitor.assign(n, none);
-    ws.assign(n, 0);
+    suitor = std::vector<std::atomic<node>>(n);
+    proposedWeight = std::vector<std::atomic<edgeweight>>(n);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+        suitor[u].store(none, std::memory_order_relaxed);
+        proposedWeight[u].store(0, std::memory_order_relaxed);
+    }
 
     if (sortSuitor)
         neighborIterators.assign(n, 0);
 
     if (sortSuitor)
-        G->forNodes([&](node u) { findSortSuitor(u); });
+        G->balancedParallelForNodes([&](node u) { findSortSuitor(u); });
     else
-        G->forNodes([&](node u) { findSuitor(u); });
+        G->balancedParallelForNodes([&](node u) { findSuitor(u); });
 
     G->parallelForNodes([&suitor = suitor, &M = M](node u) {
-        if (suitor[u] == none) {
+        const node s = suitor[u].load(std::memory_order_relaxed);
+        if (s == none) {
             if (M.isMatched(u))
                 M.unmatch(u, M.mate(u));
-        } else if (u < suitor[u]) // Ensure we match a pair of nodes only once
-            M.match(u, suitor[u]);
+        } else if (u < s) // Ensure we match a pair of nodes only once
+            M.match(u, s);
     });
 
     hasRun = true;
@@ -5,9 +5,13 @@
  *      Author: Henning
  */
 
+#include <algorithm>
+#include <tuple>
+
 #include <gtest/gtest.h>
 
 #include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/DibapGraphReader.hpp>
@@ -185,4 +189,36 @@ TEST_F(MatcherGTest, testSuitorMatcher) {
     }
 }
 
+TEST_F(MatcherGTest, testSuitorMatcherIsGreedy) {
+    // The suitor matching is the greedy matching that considers the edges by non-increasing
+    // weight, ties broken by the smaller and then by the larger endpoint.
+    Aux::Random::setSeed(42, true);
+    Graph G = GraphTools::toWeighted(ErdosRenyiGenerator(2000, 0.005).generate());
+    G.forEdges([&G](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 3)); });
+
+    std::vector<std::tuple<edgeweight, node, node>> edges;
+    G.forEdges([&edges](node u, node v, edgeweight w) {
+        edges.emplace_back(-w, std::min(u, v), std::max(u, v));
+    });
+    std::sort(edges.begin(), edges.end());
+    std::vector<node> mate(G.upperNodeIdBound(), none);
+    for (const auto &[w, u, v] : edges) {
+        if (mate[u] == none && mate[v] == none) {
+            mate[u] = v;
+            mate[v] = u;
+        }
+    }
+
+    SuitorMatcher sm(G, false);
+    sm.run();
+    const auto M1 = sm.getMatching();
+    G.forNodes([&](node u) { EXPECT_EQ(mate[u], M1.mate(u)); });
+
+    GraphTools::sortEdgesByWeight(G, true);
+    SuitorMatcher ssm(G, true, true);
+    ssm.run();
+    const auto M2 = ssm.getMatching();
+    G.forNodes([&](node u) { EXPECT_EQ(mate[u], M2.mate(u)); });
+}
+
 } // namespace NetworKit
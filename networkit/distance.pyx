@@ -1431,6 +1431,50 @@ cdef class BFS(SSSP):
 		self._G = G
 		self._this = new _BFS(G._this, source, storePaths, storeNodesSortedByDistance, target)
 
+cdef extern from "<networkit/distance/DirectionOptimizingBFS.hpp>":
+
+	cdef cppclass _DirectionOptimizingBFS "NetworKit::DirectionOptimizingBFS"(_SSSP):
+		_DirectionOptimizingBFS(_Graph G, node source, bool_t storePaths, bool_t storeNodesSortedByDistance, node target) except +
+		count getNumberOfBottomUpSteps() except +
+
+cdef class DirectionOptimizingBFS(SSSP):
+	"""
+	DirectionOptimizingBFS(G, source, storePaths=True, storeNodesSortedByDistance=False, target=None)
+
+	Parallel breadth-first search that switches between top-down and bottom-up steps
+	(Beamer et al., SC 2012). Computes the same results as BFS.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The graph.
+	source : int
+		The source node of the breadth-first search.
+	storePaths : bool, optional
+		Controls whether to store paths and number of paths. Default: True
+	storeNodesSortedByDistance : bool, optional
+		Controls whether to store nodes sorted by distance. Default: False
+	target: int or None, optional
+		Terminate search when the level of the target has been completed. In default-mode, this target is set to None.
+	"""
+
+	def __cinit__(self, Graph G, source, storePaths=True, storeNodesSortedByDistance=False, target=none):
+		self._G = G
+		self._this = new _DirectionOptimizingBFS(G._this, source, storePaths, storeNodesSortedByDistance, target)
+
+	def getNumberOfBottomUpSteps(self):
+		"""
+		getNumberOfBottomUpSteps()
+
+		Returns the number of levels that have been explored bottom-up.
+
+		Returns
+		-------
+		int
+			Number of bottom-up steps.
+		"""
+		return (<_DirectionOptimizingBFS*>(self._this)).getNumberOfBottomUpSteps()
+
 cdef extern from "<networkit/distance/Dijkstra.hpp>":
 
 	cdef cppclass _Dijkstra "NetworKit::Dijkstra"(_SSSP):
@@ -1460,6 +1504,51 @@ cdef class Dijkstra(SSSP):
 		self._G = G
 		self._this = new _Dijkstra(G._this, source, storePaths, storeNodesSortedByDistance, target)
 
+cdef extern from "<networkit/distance/DeltaStepping.hpp>":
+
+	cdef cppclass _DeltaStepping "NetworKit::DeltaStepping"(_SSSP):
+		_DeltaStepping(_Graph G, node source, bool_t storePaths, bool_t storeNodesSortedByDistance, node target, edgeweight delta) except +
+		edgeweight getDelta() except +
+
+cdef class DeltaStepping(SSSP):
+	"""
+	DeltaStepping(G, source, storePaths=True, storeNodesSortedByDistance=False, target=None, delta=0)
+
+	Parallel delta-stepping SSSP algorithm (Meyer and Sanders) for graphs with non-negative
+	edge weights. Computes the same distances as Dijkstra.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The graph.
+	source : int
+		The source node.
+	storePaths : bool, optional
+		Controls whether to store paths and number of paths. Default: True
+	storeNodesSortedByDistance : bool, optional
+		Controls whether to store nodes sorted by distance. Default: False
+	target: int or None, optional
+		Terminate search when the bucket of the target has been settled. In default-mode, this target is set to None.
+	delta : float, optional
+		Width of the distance buckets. If 0, it is chosen automatically. Default: 0
+	"""
+	def __cinit__(self, Graph G, source, storePaths=True, storeNodesSortedByDistance=False, node target=none, edgeweight delta=0):
+		self._G = G
+		self._this = new _DeltaStepping(G._this, source, storePaths, storeNodesSortedByDistance, target, delta)
+
+	def getDelta(self):
+		"""
+		getDelta()
+
+		Returns the bucket width used in the last run.
+
+		Returns
+		-------
+		float
+			The bucket width.
+		"""
+		return (<_DeltaStepping*>(self._this)).getDelta()
+
 cdef extern from "<networkit/distance/MultiTargetBFS.hpp>":
 	cdef cppclass _MultiTargetBFS "NetworKit::MultiTargetBFS"(_STSP):
 		_MultiTargetBFS(_Graph G, node source, vector[node].iterator targetsFirst, vector[node].iterator targetsLast) except +
@@ -105,3 +105,101 @@ cdef class EdmondsKarp(Algorithm):
 			The flow values of all edges indexed by edge id.
 		"""
 		return (<_EdmondsKarp*>(self._this)).getFlowVector()
+
+cdef extern from "<networkit/flow/ParallelPushRelabel.hpp>":
+
+	cdef cppclass _ParallelPushRelabel "NetworKit::ParallelPushRelabel"(_Algorithm):
+		_ParallelPushRelabel(const _Graph &graph, node source, node sink) except +
+		edgeweight getMaxFlow() except +
+		vector[node] getSourceSet() except +
+		edgeweight getFlow(node u, node v) except +
+		edgeweight getFlow(edgeid eid) except +
+		vector[edgeweight] getFlowVector() except +
+
+cdef class ParallelPushRelabel(Algorithm):
+	"""
+	ParallelPushRelabel(graph, source, sink)
+
+	Parallel maximum flow algorithm based on the synchronous push-relabel algorithm by
+	Baumstark, Blelloch and Shun, with global relabeling and the gap heuristic. The edges of the
+	graph need to be indexed, edge weights are used as capacities.
+
+	Parameters
+	----------
+	graph : networkit.Graph
+		The graph
+	source : int
+		The source node for the flow calculation
+	sink : int
+		The sink node for the flow calculation
+	"""
+	cdef Graph _graph
+
+	def __cinit__(self, Graph graph not None, node source, node sink):
+		self._graph = graph
+		self._this = new _ParallelPushRelabel(graph._this, source, sink)
+
+	def getMaxFlow(self):
+		"""
+		getMaxFlow()
+
+		Returns the value of the maximum flow from source to sink.
+
+		Returns
+		-------
+		float
+			The maximum flow value
+		"""
+		return (<_ParallelPushRelabel*>(self._this)).getMaxFlow()
+
+	def getSourceSet(self):
+		"""
+		getSourceSet()
+
+		Returns the set of the nodes on the source side of the flow/minimum cut.
+
+		Returns
+		-------
+		list(int)
+			The set of nodes that form the (smallest) source side of the flow/minimum cut.
+		"""
+		return (<_ParallelPushRelabel*>(self._this)).getSourceSet()
+
+	def getFlow(self, node u, node v = none):
+		"""
+		getFlow(u, v = None)
+
+		Get the flow value between two nodes u and v or an edge identified by the edge id u.
+		Warning: The variant with two edge ids is linear in the degree of u.
+
+		Parameters
+		----------
+		u : int
+			The first node incident to the edge or the edge id.
+		v : int, optional
+			The second node incident to the edge (optional if edge id is specified). Default: None
+
+		Returns
+		-------
+		float
+			The flow on the specified edge.
+		"""
+		if v == none: # Assume that node and edge ids are the same type
+			return (<_ParallelPushRelabel*>(self._this)).getFlow(u)
+		else:
+			return (<_ParallelPushRelabel*>(self._this)).getFlow(u, v)
+
+	def getFlowVector(self):
+		"""
+		getFlowVector()
+
+		Return a copy of the flow values of all edges. On undirected graphs, a positive value is a
+		flow from the endpoint with the larger id to the one with the smaller id. On directed
+		graphs, the value is the flow along the edge.
+
+		Returns
+		-------
+		list(float)
+			The flow values of all edges indexed by edge id.
+		"""
+		return (<_ParallelPushRelabel*>(self._this)).getFlowVector()
@@ -141,17 +141,24 @@ cdef extern from "<networkit/io/METISGraphReader.hpp>":
 
 	cdef cppclass _METISGraphReader "NetworKit::METISGraphReader" (_GraphReader):
 		_METISGraphReader() nogil except +
+		_METISGraphReader(bool_t parallel) nogil except +
 
 cdef class METISGraphReader(GraphReader):
 	"""
-	METISGraphReader()
+	METISGraphReader(parallel=False)
 	
 	Reads the METIS adjacency file format [1]. If the Fast reader fails,
 	use readGraph(path, graphio.formats.metis) as an alternative.
 	[1]: http://people.sc.fsu.edu/~jburkardt/data/metis_graph/metis_graph.html
+
+	Parameters
+	----------
+	parallel : bool, optional
+		Parse the adjacency lines in parallel. The resulting graph is the same as with the
+		sequential reader. Default: False
 	"""
-	def __cinit__(self):
-		self._this = new _METISGraphReader()
+	def __cinit__(self, parallel=False):
+		self._this = new _METISGraphReader(parallel)
 
 cdef extern from "<networkit/io/NetworkitBinaryReader.hpp>":
 	cdef cppclass _NetworkitBinaryReader "NetworKit::NetworkitBinaryReader" (_GraphReader):
@@ -302,12 +309,12 @@ cdef extern from "<networkit/io/EdgeListReader.hpp>":
 
 	cdef cppclass _EdgeListReader "NetworKit::EdgeListReader"(_GraphReader):
 		_EdgeListReader() except +
-		_EdgeListReader(char separator, node firstNode, string commentPrefix, bool_t continuous, bool_t directed)
+		_EdgeListReader(char separator, node firstNode, string commentPrefix, bool_t continuous, bool_t directed, bool_t parallel)
 		cmap[string,node] getNodeMap() except +
 
 cdef class EdgeListReader(GraphReader):
 	""" 
-	EdgeListReader(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False)
+	EdgeListReader(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False, parallel=False)
 
 	Reads a graph from various text-based edge list formats.
 
@@ -343,12 +350,15 @@ cdef class EdgeListReader(GraphReader):
 		File uses continuous node ids. Default: True 
 	directed : bool, optional
 		Treat input file as a directed graph. Default: False
+	parallel : bool, optional
+		Parse the file in parallel chunks. The resulting graph is the same as with the
+		sequential reader. Default: False
 	"""
-	def __cinit__(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False):
+	def __cinit__(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False, parallel=False):
 		if len(separator) != 1 or ord(separator[0]) > 255:
 			raise RuntimeError("separator has to be exactly one ascii character");
 
-		self._this = new _EdgeListReader(stdstring(separator)[0], firstNode, stdstring(commentPrefix), continuous, directed)
+		self._this = new _EdgeListReader(stdstring(separator)[0], firstNode, stdstring(commentPrefix), continuous, directed, parallel)
 
 	def getNodeMap(self):
 		""" 
@@ -262,6 +262,8 @@ cdef class SuitorMatcher(Matcher):
 	only works on graphs with adjacency lists sorted by non-increasing edge weight) and Suitor
 	(works on generic graphs). If using SortSuitor, call nk.graphtools.sortEdgesByWeight(G, True)
 	to sort the adjacency lists by non-increasing edge weight.
+	The nodes propose in parallel without locks; the resulting matching is the same as the one of
+	the sequential algorithm.
 
 	Parameters
 	----------
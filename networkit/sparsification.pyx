@@ -157,6 +157,59 @@ cdef class TriangleEdgeScore(EdgeScore):
 	cdef bool_t isDoubleValue(self):
 		return False
 
+cdef extern from "<networkit/edgescores/TrussDecomposition.hpp>":
+
+	cdef cppclass _TrussDecomposition "NetworKit::TrussDecomposition"(_EdgeScore[count]):
+		_TrussDecomposition(const _Graph& G) except +
+		count maxTrussness() except +
+		_Graph maxTrussSubgraph() except +
+
+cdef class TrussDecomposition(EdgeScore):
+	"""
+	TrussDecomposition(G)
+
+	Computes the trussness of each edge in parallel: the largest k such that the edge belongs to
+	the k-truss, the largest subgraph in which every edge is contained in at least k - 2 triangles.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		An undirected graph with indexed edges.
+	"""
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _TrussDecomposition(G._this)
+
+	cdef bool_t isDoubleValue(self):
+		return False
+
+	def maxTrussness(self):
+		"""
+		maxTrussness()
+
+		Returns the maximum trussness of any edge, 0 if the graph has no edges.
+
+		Returns
+		-------
+		int
+			The maximum trussness.
+		"""
+		return (<_TrussDecomposition*>(self._this)).maxTrussness()
+
+	def maxTrussSubgraph(self):
+		"""
+		maxTrussSubgraph()
+
+		Returns the subgraph of all edges with maximum trussness. Node ids are kept.
+
+		Returns
+		-------
+		networkit.Graph
+			The k-truss for the largest k for which it is not empty.
+		"""
+		return Graph().setThis((<_TrussDecomposition*>(self._this)).maxTrussSubgraph())
+
 cdef extern from "<networkit/edgescores/EdgeScoreLinearizer.hpp>":
 
 	cdef cppclass _EdgeScoreLinearizer "NetworKit::EdgeScoreLinearizer"(_EdgeScore[double]):